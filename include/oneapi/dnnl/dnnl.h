@@ -274,6 +274,25 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
         const_dnnl_primitive_t primitive,
         const_dnnl_primitive_desc_t *primitive_desc);
 
+/// Retrieves execution statistics of a primitive and optionally resets them.
+///
+/// The statistics are always collected and are specific to a primitive
+/// object: primitives created from the same primitive descriptor don't share
+/// them. The execution time is measured on the host around the submission to
+/// the stream. Unless the verbose mode is enabled the stream is not waited
+/// for, so for asynchronous streams the time may not include the
+/// computations.
+///
+/// @param primitive Primitive to query for the statistics.
+/// @param reset If non-zero, the statistics are reset to zero after being
+///     read.
+/// @param stats Output statistics. May be NULL if @p reset is non-zero.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_get_stats(
+        const_dnnl_primitive_t primitive, int reset,
+        dnnl_primitive_stats_t *stats);
+
 /// Retrieves a cache blob associated with the given primitive.
 ///
 /// @param primitive Primitive to query for the cache blob.
@@ -349,6 +368,31 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_fpmath_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_fpmath_mode(
         dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t mode);
 
+/// Returns the accuracy mode primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output accuracy mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_accuracy_mode(
+        const_dnnl_primitive_attr_t attr, dnnl_accuracy_mode_t *mode);
+
+/// Sets the accuracy mode primitive attribute.
+///
+/// With #dnnl_accuracy_mode_fast the exp, logistic, tanh, swish, gelu_tanh,
+/// gelu_erf and mish forward elementwise functions, both in the eltwise
+/// primitive and in eltwise post-ops, may use faster approximations with the
+/// relative error below 1e-4.
+///
+/// @param attr Primitive attributes.
+/// @param mode Accuracy mode. The possible values are:
+///     #dnnl_accuracy_mode_strict (default),
+///     #dnnl_accuracy_mode_fast.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_accuracy_mode(
+        dnnl_primitive_attr_t attr, dnnl_accuracy_mode_t mode);
+
 /// Returns the primitive attributes scratchpad mode.
 ///
 /// @param attr Primitive attributes.
@@ -369,6 +413,99 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the number of threads primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param nthr Output number of threads. Zero means that the number of
+///     threads is defined by the threading runtime.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_num_threads(
+        const_dnnl_primitive_attr_t attr, int *nthr);
+
+/// Sets the number of threads primitive attribute.
+///
+/// A primitive created with the attribute chooses its implementation and
+/// work partitioning for @p nthr threads, and is executed with @p nthr
+/// threads regardless of the threading runtime settings. This is useful when
+/// the primitive runs in a thread team smaller than the whole machine, for
+/// example in a nested parallel region or in a dedicated threadpool.
+/// Primitives that only differ in the number of threads are cached
+/// separately.
+///
+/// @param attr Primitive attributes.
+/// @param nthr Number of threads. Zero (default) means that the number of
+///     threads is defined by the threading runtime.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_num_threads(
+        dnnl_primitive_attr_t attr, int nthr);
+
+/// Returns the weights decompression primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param group_size Output number of consecutive weights elements along the
+///     reduction dimension that share a scale and a zero point. Zero means
+///     that the weights are not decompressed.
+/// @param with_zero_points Output flag, non-zero if the zero points are
+///     applied.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_weights_decompression(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *group_size,
+        int *with_zero_points);
+
+/// Sets the weights decompression primitive attribute.
+///
+/// Weights of a lower precision data type (#dnnl_s4 or #dnnl_u4) are
+/// converted to the computational data type on the fly as
+/// `(weights - zero_point) * scale`. The scales and the zero points are
+/// defined per group of @p group_size consecutive elements along the
+/// reduction dimension K and per output channel N, and are passed at
+/// execution time as #DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES (#dnnl_f32)
+/// and #DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS (#dnnl_s8) memory
+/// objects of dimensions {ceil(K / @p group_size), N} in row-major order.
+///
+/// @param attr Primitive attributes.
+/// @param group_size Number of consecutive weights elements along the
+///     reduction dimension that share a scale and a zero point. Must be
+///     positive.
+/// @param with_zero_points Non-zero if the zero points are applied.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_weights_decompression(
+        dnnl_primitive_attr_t attr, dnnl_dim_t group_size,
+        int with_zero_points);
+
+/// Returns the softmax mask primitive attribute.
+///
+/// @param attr Primitive attributes.
+/// @param mask Output correspondence mask of the softmax mask dimensions.
+///     A negative value means that no mask is applied.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_softmax_mask(
+        const_dnnl_primitive_attr_t attr, int *mask);
+
+/// Sets the softmax mask primitive attribute.
+///
+/// The softmax mask is added to the source, after the source scale, before
+/// the maximum is computed: `dst = softmax(scale_src * src + softmax_mask)`.
+/// It is passed at execution time as a #DNNL_ARG_ATTR_SOFTMAX_MASK (#dnnl_f32)
+/// memory object of the source dimensions in row-major order, with the
+/// dimensions not in @p mask set to one and broadcast. For example, the
+/// `{1, 1, S, S}` mask of the `{B, H, S, S}` attention scores is set with
+/// @p mask equal to `(1 << 2) | (1 << 3)`.
+///
+/// @param attr Primitive attributes.
+/// @param mask Correspondence mask of the softmax mask dimensions. The i-th
+///     bit of the mask is set if the mask varies along the i-th dimension of
+///     the source.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_softmax_mask(
+        dnnl_primitive_attr_t attr, int mask);
+
 /// Returns primitive attributes output scaling factors correspondence mask
 /// and values.
 ///
@@ -1036,6 +1173,27 @@ dnnl_status_t DNNL_API dnnl_memory_desc_init_by_tag(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_format_tag_t tag);
 
+/// Initializes a memory descriptor for a 2D tensor of weights stored in a
+/// block-sparse format.
+///
+/// The memory is filled by a reorder from a dense tensor. Primitives that
+/// accept such weights skip the blocks that contain only zeros.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Must be 2.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param encoding Sparse encoding.
+/// @param block_dims Sizes of a block in each dimension.
+/// @param row_dim The dimension along which the blocks form rows, e.g. 0 for
+///     inner product weights and 1 for matmul weights.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_init_by_sparse_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_sparse_encoding_t encoding,
+        const dnnl_dims_t block_dims, int row_dim);
+
 /// Initializes a memory descriptor for a region inside an area
 /// described by an existing memory descriptor.
 ///
@@ -3692,6 +3850,44 @@ dnnl_status_t DNNL_API dnnl_reduction_desc_init(dnnl_reduction_desc_t *desc,
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+/// @{
+
+/// Initializes a descriptor for a scaled dot-product attention primitive.
+///
+/// The primitive computes `dst = softmax(scale * Q * K^T + mask) * V` for
+/// each of the batch (and heads) entries.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param desc Output descriptor for a scaled dot-product attention
+///     primitive.
+/// @param prop_kind Propagation kind. Possible values:
+///     #dnnl_forward_inference.
+/// @param q_desc Queries memory descriptor, [..., Sq, D].
+/// @param k_desc Keys memory descriptor, [..., Sk, D].
+/// @param v_desc Values memory descriptor, [..., Sk, Dv].
+/// @param mask_desc Attention mask memory descriptor, [..., Sq, Sk] with
+///     leading dimensions equal to the ones of queries or 1. Must be NULL
+///     or a zero memory descriptor unless @p mask_kind is
+///     #dnnl_sdpa_mask_buffer.
+/// @param dst_desc Destination memory descriptor, [..., Sq, Dv].
+/// @param scale Scale applied to the query-key products, usually
+///     1 / sqrt(D).
+/// @param mask_kind Attention mask kind.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_sdpa_forward_desc_init(dnnl_sdpa_desc_t *desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *q_desc,
+        const dnnl_memory_desc_t *k_desc, const dnnl_memory_desc_t *v_desc,
+        const dnnl_memory_desc_t *mask_desc,
+        const dnnl_memory_desc_t *dst_desc, float scale,
+        dnnl_sdpa_mask_kind_t mask_kind);
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -3730,6 +3926,34 @@ dnnl_status_t DNNL_API dnnl_engine_get_kind(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_engine_destroy(dnnl_engine_t engine);
 
+/// Sets user functions that allocate memory for a CPU engine: memory objects
+/// created with #DNNL_MEMORY_ALLOCATE and library-managed scratchpads.
+/// Memory allocated before the call is released with the functions it was
+/// allocated with.
+///
+/// @param engine CPU engine.
+/// @param malloc_fn Allocation function. Passing NULL together with a NULL
+///     @p free_fn restores the built-in allocator.
+/// @param free_fn Deallocation function.
+/// @param user_data Pointer passed to @p malloc_fn and @p free_fn.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_set_allocator(dnnl_engine_t engine,
+        dnnl_cpu_malloc_t malloc_fn, dnnl_cpu_free_t free_fn,
+        void *user_data);
+
+/// Configures the built-in allocator of a CPU engine. Replaces an allocator
+/// set with dnnl_cpu_engine_set_allocator().
+///
+/// @param engine CPU engine.
+/// @param flags Allocator flags, a combination of
+///     #dnnl_cpu_allocator_flags_t values. #dnnl_cpu_allocator_numa_interleave
+///     and #dnnl_cpu_allocator_numa_local are mutually exclusive.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_cpu_engine_set_allocator_flags(
+        dnnl_engine_t engine, unsigned flags);
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream
@@ -4035,6 +4259,47 @@ dnnl_status_t DNNL_API dnnl_sgemm(char transa, char transb, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A, dnnl_dim_t lda,
         const float *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc);
 
+/// Performs a group of independent single-precision floating-point
+/// matrix-matrix multiplications.
+///
+/// Every problem `i` of the group is defined as for dnnl_sgemm():
+///
+/// `C[i] := alpha[i] * op( A[i] ) * op( B[i] ) + beta[i] * C[i]`
+///
+/// The problems may have different shapes. Unlike calling dnnl_sgemm() for
+/// each of them, the whole group is computed in a single parallel region,
+/// with threads balanced over the work of all the problems. This is
+/// beneficial when the group consists of many small problems.
+///
+/// The matrices are assumed to be stored in row-major order (the elements in
+/// each of the matrix rows are contiguous in memory). The output matrices
+/// must not overlap.
+///
+/// @param group_size The number of problems in the group.
+/// @param transa An array of transposition flags for matrices A: 'N' or 'n'
+///     means A is not transposed, and 'T' or 't' means that A is transposed.
+/// @param transb An array of transposition flags for matrices B: 'N' or 'n'
+///     means B is not transposed, and 'T' or 't' means that B is transposed.
+/// @param M An array of the M dimensions.
+/// @param N An array of the N dimensions.
+/// @param K An array of the K dimensions.
+/// @param alpha An array of the alpha parameters.
+/// @param A An array of pointers to the A matrices data.
+/// @param lda An array of the leading dimensions for the matrices A.
+/// @param B An array of pointers to the B matrices data.
+/// @param ldb An array of the leading dimensions for the matrices B.
+/// @param beta An array of the beta parameters.
+/// @param C An array of pointers to the C matrices data.
+/// @param ldc An array of the leading dimensions for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_grouped(dnnl_dim_t group_size,
+        const char *transa, const char *transb, const dnnl_dim_t *M,
+        const dnnl_dim_t *N, const dnnl_dim_t *K, const float *alpha,
+        const float *const *A, const dnnl_dim_t *lda, const float *const *B,
+        const dnnl_dim_t *ldb, const float *beta, float *const *C,
+        const dnnl_dim_t *ldc);
+
 /// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
 /// signed matrix B, and 32-bit signed resulting matrix C.
 ///
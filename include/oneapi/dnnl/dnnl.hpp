@@ -315,6 +315,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         prelu = dnnl_prelu,
         /// A softmax version 2 primitive.
         softmax_v2 = dnnl_softmax_v2,
+        /// A scaled dot-product attention primitive.
+        sdpa = dnnl_sdpa,
     };
 
     using handle::handle;
@@ -365,6 +367,16 @@ struct primitive : public handle<dnnl_primitive_t> {
     ///     constructor.
     inline std::vector<uint8_t> get_cache_blob() const;
 
+    /// Returns execution statistics of the primitive.
+    ///
+    /// @sa dnnl_primitive_get_stats
+    ///
+    /// @param reset If true, the statistics are reset to zero after being
+    ///     read.
+    /// @returns Execution statistics accumulated since the primitive creation
+    ///     or the last reset.
+    inline dnnl_primitive_stats_t get_stats(bool reset = false) const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -419,6 +431,13 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+dnnl_primitive_stats_t primitive::get_stats(bool reset) const {
+    dnnl_primitive_stats_t stats;
+    error::wrap_c_api(dnnl_primitive_get_stats(get(), reset, &stats),
+            "could not get execution statistics of a primitive");
+    return stats;
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -453,6 +472,23 @@ inline dnnl_fpmath_mode_t convert_to_c(fpmath_mode mode) {
     return static_cast<dnnl_fpmath_mode_t>(mode);
 }
 
+/// Accuracy mode of the elementwise functions
+enum class accuracy_mode {
+    /// Default behavior, the functions are computed with the full accuracy
+    strict = dnnl_accuracy_mode_strict,
+    /// Faster approximations of the transcendental functions are allowed.
+    /// The relative error stays below 1e-4.
+    fast = dnnl_accuracy_mode_fast,
+};
+
+/// Converts an accuracy mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API accuracy mode enum value.
+/// @returns Corresponding C API accuracy mode enum value.
+inline dnnl_accuracy_mode_t convert_to_c(accuracy_mode mode) {
+    return static_cast<dnnl_accuracy_mode_t>(mode);
+}
+
 /// Scratchpad mode
 enum class scratchpad_mode {
     /// The library manages the scratchpad allocation according to the policy
@@ -911,6 +947,8 @@ enum class query {
     resampling_d = dnnl_query_resampling_d,
     /// reduction descriptor
     reduction_d = dnnl_query_reduction_d,
+    /// scaled dot-product attention descriptor
+    sdpa_d = dnnl_query_sdpa_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -1037,6 +1075,43 @@ struct engine : public handle<dnnl_engine_t> {
         return query(pd, dnnl::query::engine);
     }
 
+    /// Flags of the built-in allocator of a CPU engine.
+    enum class cpu_allocator_flags : unsigned {
+        /// Aligned allocation without any placement hints (default).
+        none = dnnl_cpu_allocator_flags_none,
+        /// Back large buffers with transparent huge pages.
+        huge_pages = dnnl_cpu_allocator_huge_pages,
+        /// Interleave pages of large buffers across all NUMA nodes.
+        numa_interleave = dnnl_cpu_allocator_numa_interleave,
+        /// Place pages of large buffers on the NUMA node of the thread that
+        /// first touches them.
+        numa_local = dnnl_cpu_allocator_numa_local,
+        /// Reuse freed buffers through size-class pools.
+        pool = dnnl_cpu_allocator_pool,
+    };
+
+    /// Sets user functions that allocate memory for a CPU engine.
+    ///
+    /// @param malloc_fn Allocation function. Passing nullptr together with
+    ///     a nullptr @p free_fn restores the built-in allocator.
+    /// @param free_fn Deallocation function.
+    /// @param user_data Pointer passed to @p malloc_fn and @p free_fn.
+    void set_cpu_allocator(dnnl_cpu_malloc_t malloc_fn,
+            dnnl_cpu_free_t free_fn, void *user_data = nullptr) {
+        error::wrap_c_api(dnnl_cpu_engine_set_allocator(
+                                  get(), malloc_fn, free_fn, user_data),
+                "could not set an allocator of a cpu engine");
+    }
+
+    /// Configures the built-in allocator of a CPU engine.
+    ///
+    /// @param flags Allocator flags.
+    void set_cpu_allocator_flags(cpu_allocator_flags flags) {
+        error::wrap_c_api(dnnl_cpu_engine_set_allocator_flags(
+                                  get(), static_cast<unsigned>(flags)),
+                "could not set allocator flags of a cpu engine");
+    }
+
 private:
     static dnnl_engine_kind_t convert_to_c(kind akind) {
         return static_cast<dnnl_engine_kind_t>(akind);
@@ -1060,6 +1135,8 @@ inline dnnl_engine_kind_t convert_to_c(engine::kind akind) {
     return static_cast<dnnl_engine_kind_t>(akind);
 }
 
+DNNL_DEFINE_BITMASK_OPS(engine::cpu_allocator_flags)
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
@@ -1243,6 +1320,10 @@ struct memory : public handle<dnnl_memory_t> {
         s8 = dnnl_s8,
         /// 8-bit unsigned integer.
         u8 = dnnl_u8,
+        /// 4-bit signed integer, packed two values per byte.
+        s4 = dnnl_s4,
+        /// 4-bit unsigned integer, packed two values per byte.
+        u4 = dnnl_u4,
     };
 
     /// Returns size of data type in bytes.
@@ -1266,6 +1347,17 @@ struct memory : public handle<dnnl_memory_t> {
         wino = dnnl_format_kind_wino,
         /// Packed weights format used in RNN.
         packed = dnnl_format_kind_rnn_packed,
+        /// Block-sparse weights format.
+        sparse = dnnl_format_kind_sparse,
+    };
+
+    /// Sparse encodings.
+    enum class sparse_encoding {
+        /// Undefined sparse encoding.
+        undef = dnnl_sparse_encoding_undef,
+        /// Block compressed sparse rows with a bitmask of non-zero blocks.
+        /// See #dnnl_sparse_encoding_bcsr_bitmask for more information.
+        bcsr_bitmask = dnnl_sparse_encoding_bcsr_bitmask,
     };
 
     /// Memory format tag specification.
@@ -2520,6 +2612,36 @@ struct memory : public handle<dnnl_memory_t> {
                         "strides");
         }
 
+        /// Constructs a memory descriptor for a 2D tensor of weights stored
+        /// in a block-sparse format.
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param aencoding Sparse encoding.
+        /// @param block_dims Sizes of a block in each dimension.
+        /// @param row_dim The dimension along which the blocks form rows,
+        ///     e.g. 0 for inner product weights and 1 for matmul weights.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        desc(const dims &adims, data_type adata_type,
+                sparse_encoding aencoding, const dims &block_dims, int row_dim,
+                bool allow_empty = false)
+            : data() {
+            validate_dims(adims);
+            validate_dims(block_dims, (int)adims.size());
+            dnnl_status_t status = dnnl_memory_desc_init_by_sparse_encoding(
+                    &data, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type),
+                    static_cast<dnnl_sparse_encoding_t>(aencoding),
+                    block_dims.data(), row_dim);
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not construct a memory descriptor using a "
+                        "sparse encoding");
+        }
+
         /// Constructs a memory descriptor from a C API data structure.
         ///
         /// @param data A C API ::dnnl_memory_desc_t structure.
@@ -3408,6 +3530,24 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set fpmath mode primitive attribute");
     }
 
+    /// Returns the accuracy mode.
+    accuracy_mode get_accuracy_mode() const {
+        dnnl_accuracy_mode_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_accuracy_mode(get(), &result),
+                "could not get accuracy mode primitive attribute");
+        return accuracy_mode(result);
+    }
+
+    /// Sets accuracy mode.
+    ///
+    /// @param mode Specified accuracy mode.
+    void set_accuracy_mode(accuracy_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_accuracy_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set accuracy mode primitive attribute");
+    }
+
     /// Returns the scratchpad mode.
     scratchpad_mode get_scratchpad_mode() const {
         dnnl_scratchpad_mode_t result;
@@ -3426,6 +3566,86 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the number of threads.
+    int get_num_threads() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_num_threads(get(), &result),
+                "could not get number of threads primitive attribute");
+        return result;
+    }
+
+    /// Sets the number of threads a primitive is created and executed with.
+    ///
+    /// @param nthr Number of threads. Zero (default) means that the number
+    ///     of threads is defined by the threading runtime.
+    void set_num_threads(int nthr) {
+        error::wrap_c_api(dnnl_primitive_attr_set_num_threads(get(), nthr),
+                "could not set number of threads primitive attribute");
+    }
+
+    /// Returns the weights decompression parameters.
+    ///
+    /// @param group_size Output number of consecutive weights elements along
+    ///     the reduction dimension that share a scale and a zero point. Zero
+    ///     means that the weights are not decompressed.
+    /// @param with_zero_points Output flag, true if the zero points are
+    ///     applied.
+    void get_weights_decompression(
+            memory::dim &group_size, bool &with_zero_points) const {
+        dnnl_dim_t c_group_size;
+        int c_with_zero_points;
+        error::wrap_c_api(dnnl_primitive_attr_get_weights_decompression(
+                                  get(), &c_group_size, &c_with_zero_points),
+                "could not get weights decompression primitive attribute");
+        group_size = c_group_size;
+        with_zero_points = c_with_zero_points != 0;
+    }
+
+    /// Sets the weights decompression parameters.
+    ///
+    /// The weights are converted on the fly as
+    /// `(weights - zero_point) * scale`. The scales and the zero points are
+    /// passed at execution time as
+    /// #DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES and
+    /// #DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS memory objects of
+    /// dimensions {ceil(K / @p group_size), N}.
+    ///
+    /// @param group_size Number of consecutive weights elements along the
+    ///     reduction dimension that share a scale and a zero point.
+    /// @param with_zero_points True if the zero points are applied.
+    void set_weights_decompression(
+            memory::dim group_size, bool with_zero_points = false) {
+        error::wrap_c_api(dnnl_primitive_attr_set_weights_decompression(
+                                  get(), group_size, with_zero_points),
+                "could not set weights decompression primitive attribute");
+    }
+
+    /// Returns the softmax mask correspondence mask.
+    ///
+    /// @returns Correspondence mask of the softmax mask dimensions. A negative
+    ///     value means that no mask is applied.
+    int get_softmax_mask() const {
+        int mask;
+        error::wrap_c_api(dnnl_primitive_attr_get_softmax_mask(get(), &mask),
+                "could not get softmax mask primitive attribute");
+        return mask;
+    }
+
+    /// Sets the softmax mask correspondence mask.
+    ///
+    /// The softmax mask is added to the scaled source before the maximum is
+    /// computed. It is passed at execution time as a
+    /// #DNNL_ARG_ATTR_SOFTMAX_MASK memory object of the source dimensions,
+    /// with the dimensions not in @p mask set to one.
+    ///
+    /// @param mask Correspondence mask of the softmax mask dimensions. The
+    ///     set i-th bit indicates that the mask varies along the i-th
+    ///     dimension of the source.
+    void set_softmax_mask(int mask) {
+        error::wrap_c_api(dnnl_primitive_attr_set_softmax_mask(get(), mask),
+                "could not set softmax mask primitive attribute");
+    }
+
     /// Returns output scaling factors correspondence mask and values.
     ///
     /// @param mask Scaling factors correspondence mask that defines the
@@ -12821,6 +13041,183 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa Scaled Dot-Product Attention
+///
+/// A primitive to compute the scaled dot-product attention
+/// `softmax(scale * Q * K^T + mask) * V` without materializing the
+/// attention scores in memory.
+///
+/// @sa @ref dev_guide_sdpa in developer guide
+///
+/// @{
+
+/// Attention mask kinds.
+enum class sdpa_mask_kind {
+    /// No mask: every query attends to every key.
+    none = dnnl_sdpa_mask_none,
+    /// Additive mask passed as a memory argument (#DNNL_ARG_ATTN_MASK).
+    buffer = dnnl_sdpa_mask_buffer,
+    /// Causal mask: query `i` attends to keys `j <= i`.
+    causal = dnnl_sdpa_mask_causal,
+};
+
+/// Converts attention mask kind enum value from C++ API to C API type.
+/// @param kind C++ API attention mask kind enum value.
+/// @returns Corresponding C API attention mask kind enum value.
+inline dnnl_sdpa_mask_kind_t convert_to_c(sdpa_mask_kind kind) {
+    return static_cast<dnnl_sdpa_mask_kind_t>(kind);
+}
+
+/// Scaled dot-product attention forward propagation primitive.
+struct sdpa_forward : public primitive {
+    /// Descriptor for a scaled dot-product attention forward propagation
+    /// primitive.
+    struct desc {
+        dnnl_sdpa_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// forward propagation primitive without an attention mask buffer.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values:
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the query-key products.
+        /// @param mask_kind Attention mask kind. Possible values:
+        ///     #dnnl::sdpa_mask_kind::none, #dnnl::sdpa_mask_kind::causal.
+        desc(prop_kind aprop_kind, const memory::desc &q_desc,
+                const memory::desc &k_desc, const memory::desc &v_desc,
+                const memory::desc &dst_desc, float scale,
+                sdpa_mask_kind mask_kind = sdpa_mask_kind::none) {
+            error::wrap_c_api(
+                    dnnl_sdpa_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &q_desc.data,
+                            &k_desc.data, &v_desc.data, nullptr,
+                            &dst_desc.data, scale,
+                            dnnl::convert_to_c(mask_kind)),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention forward propagation primitive");
+        }
+
+        /// Constructs a descriptor for a scaled dot-product attention
+        /// forward propagation primitive with an additive attention mask.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values:
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param q_desc Queries memory descriptor.
+        /// @param k_desc Keys memory descriptor.
+        /// @param v_desc Values memory descriptor.
+        /// @param mask_desc Attention mask memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param scale Scale applied to the query-key products.
+        desc(prop_kind aprop_kind, const memory::desc &q_desc,
+                const memory::desc &k_desc, const memory::desc &v_desc,
+                const memory::desc &mask_desc, const memory::desc &dst_desc,
+                float scale) {
+            error::wrap_c_api(
+                    dnnl_sdpa_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &q_desc.data,
+                            &k_desc.data, &v_desc.data, &mask_desc.data,
+                            &dst_desc.data, scale, dnnl_sdpa_mask_buffer),
+                    "could not create a descriptor for a scaled dot-product "
+                    "attention forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a scaled dot-product attention forward
+    /// propagation primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention
+        ///     forward propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a scaled dot-product attention
+        ///     forward propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a scaled dot-product
+        /// attention forward propagation primitive from a C API primitive
+        /// descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a scaled dot-product
+        ///     attention forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::sdpa,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// Returns a queries memory descriptor.
+        /// @returns Queries memory descriptor.
+        memory::desc queries_desc() const { return base::src_desc(0); }
+
+        /// Returns a keys memory descriptor.
+        /// @returns Keys memory descriptor.
+        memory::desc keys_desc() const { return base::src_desc(1); }
+
+        /// Returns a values memory descriptor.
+        /// @returns Values memory descriptor.
+        memory::desc values_desc() const { return base::src_desc(2); }
+
+        /// Returns an attention mask memory descriptor.
+        /// @returns Attention mask memory descriptor, or a zero memory
+        ///     descriptor if the primitive does not take an attention mask.
+        memory::desc mask_desc() const { return base::src_desc(3); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    sdpa_forward() = default;
+
+    /// Constructs a scaled dot-product attention forward propagation
+    /// primitive.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     forward propagation primitive.
+    sdpa_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a scaled dot-product attention forward propagation
+    /// primitive from a cache blob.
+    /// @param pd Primitive descriptor for a scaled dot-product attention
+    ///     forward propagation primitive.
+    /// @param cache_blob Cache blob.
+    sdpa_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -12988,6 +13385,16 @@ inline status sgemm(char transa, char transb, dnnl_dim_t M, dnnl_dim_t N,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
 }
 
+/// @copydoc dnnl_sgemm_grouped()
+inline status sgemm_grouped(dnnl_dim_t group_size, const char *transa,
+        const char *transb, const dnnl_dim_t *M, const dnnl_dim_t *N,
+        const dnnl_dim_t *K, const float *alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        const float *beta, float *const *C, const dnnl_dim_t *ldc) {
+    return static_cast<status>(dnnl_sgemm_grouped(group_size, transa, transb,
+            M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
 /// @copydoc dnnl_gemm_u8s8s32()
 inline status gemm_u8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
         dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint8_t *A,
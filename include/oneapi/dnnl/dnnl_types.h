@@ -76,6 +76,12 @@ typedef enum {
     dnnl_u8 = 6,
     /// 64-bit/double-precision floating point.
     dnnl_f64 = 7,
+    /// 4-bit signed integer, two values are packed into a byte with the
+    /// first one stored in the low nibble.
+    dnnl_s4 = 8,
+    /// 4-bit unsigned integer, two values are packed into a byte with the
+    /// first one stored in the low nibble.
+    dnnl_u4 = 9,
 } dnnl_data_type_t;
 
 /// Memory format kind
@@ -93,6 +99,9 @@ typedef enum {
     dnnl_format_kind_wino,
     /// Packed weights format used in RNN
     dnnl_format_kind_rnn_packed,
+    /// A 2D tensor of weights in a block-sparse format. See
+    /// @ref dnnl_sparse_desc_t for more information.
+    dnnl_format_kind_sparse,
 } dnnl_format_kind_t;
 
 /// Memory format tag specification.
@@ -1412,6 +1421,8 @@ typedef enum {
     /// A softmax version 2 primitive (softmax with destination memory
     /// descriptor and algorithm kind).
     dnnl_softmax_v2,
+    /// A scaled dot-product attention primitive.
+    dnnl_sdpa,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1763,6 +1774,43 @@ typedef struct {
     char reserved[200];
 } dnnl_rnn_packed_desc_t;
 
+/// Sparse encodings
+typedef enum {
+    /// Undefined sparse encoding, used for empty memory descriptors.
+    dnnl_sparse_encoding_undef = 0,
+    /// Block compressed sparse rows with a bitmask of non-zero blocks.
+    ///
+    /// The tensor is split into blocks of @p block_dims. The blocks that
+    /// share an index along @p row_dim form a row of blocks. Each row has a
+    /// bitmask with a bit set for every block that has a non-zero element,
+    /// and an offset to the first of its non-zero blocks. Only the non-zero
+    /// blocks are stored, one after another. The elements of a block are
+    /// laid out with @p row_dim innermost.
+    dnnl_sparse_encoding_bcsr_bitmask,
+} dnnl_sparse_encoding_t;
+
+/// Description of a 2D tensor of weights in a block-sparse format.
+///
+/// The buffer holds the row offsets (int64_t, number of rows of blocks + 1
+/// values, in blocks), the bitmasks (uint64_t, one set of words per row of
+/// blocks) and the values of the non-zero blocks. The size of the buffer
+/// accounts for a fully dense tensor, so it does not depend on the data.
+typedef struct {
+    /// Sparse encoding.
+    dnnl_sparse_encoding_t encoding;
+    /// The dimension along which the blocks form rows.
+    int row_dim;
+    /// The sizes of a block in each of the two dimensions.
+    dnnl_dim_t block_dims[2];
+    /// Offset of the bitmasks in bytes.
+    size_t bitmask_offset;
+    /// Offset of the values in bytes.
+    size_t values_offset;
+    /// Size of the buffer in bytes.
+    size_t size;
+    char reserved[64];
+} dnnl_sparse_desc_t;
+
 /// Flags for memory special features
 typedef enum {
     dnnl_memory_extra_flag_none = 0x0U,
@@ -1844,6 +1892,8 @@ typedef struct {
         dnnl_wino_desc_t wino_desc;
         /// Tensor of packed weights for RNN.
         dnnl_rnn_packed_desc_t rnn_packed_desc;
+        /// Tensor of weights in a block-sparse format.
+        dnnl_sparse_desc_t sparse_desc;
         // ... other descriptions possible
     } format_desc;
 
@@ -2529,6 +2579,45 @@ typedef struct {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_sdpa
+/// @{
+
+/// Kinds of attention masks.
+typedef enum {
+    /// No mask: every query attends to every key.
+    dnnl_sdpa_mask_none,
+    /// Additive mask passed as a memory argument (#DNNL_ARG_ATTN_MASK).
+    dnnl_sdpa_mask_buffer,
+    /// Causal mask: query `i` attends to keys `j <= i`.
+    dnnl_sdpa_mask_causal,
+} dnnl_sdpa_mask_kind_t;
+
+/// A descriptor of a scaled dot-product attention operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_sdpa.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_inference.
+    dnnl_prop_kind_t prop_kind;
+    /// Queries memory descriptor.
+    dnnl_memory_desc_t q_desc;
+    /// Keys memory descriptor.
+    dnnl_memory_desc_t k_desc;
+    /// Values memory descriptor.
+    dnnl_memory_desc_t v_desc;
+    /// Attention mask memory descriptor. Zero memory descriptor unless
+    /// @p mask_kind is #dnnl_sdpa_mask_buffer.
+    dnnl_memory_desc_t mask_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Scale applied to the query-key products.
+    float scale;
+    /// Attention mask kind.
+    dnnl_sdpa_mask_kind_t mask_kind;
+} dnnl_sdpa_desc_t;
+
+/// @} dnnl_api_sdpa
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_engine
@@ -2555,6 +2644,37 @@ typedef struct dnnl_engine *dnnl_engine_t;
 typedef const struct dnnl_engine *const_dnnl_engine_t;
 #endif
 
+/// @brief Flags of the built-in allocator of a CPU engine.
+typedef enum {
+    /// Aligned allocation without any placement hints (default).
+    dnnl_cpu_allocator_flags_none = 0x0U,
+    /// Back large buffers with transparent huge pages.
+    dnnl_cpu_allocator_huge_pages = 0x1U,
+    /// Interleave pages of large buffers across all NUMA nodes.
+    dnnl_cpu_allocator_numa_interleave = 0x2U,
+    /// Place pages of large buffers on the NUMA node of the thread that
+    /// first touches them regardless of the process memory policy.
+    dnnl_cpu_allocator_numa_local = 0x4U,
+    /// Keep freed buffers in size-class pools and reuse them for subsequent
+    /// allocations. The pool keeps up to ONEDNN_CPU_ALLOCATOR_POOL_CAPACITY
+    /// megabytes (1024 by default) of freed buffers and releases the
+    /// largest ones first.
+    dnnl_cpu_allocator_pool = 0x8U,
+} dnnl_cpu_allocator_flags_t;
+
+/// @brief A user-provided allocation function of a CPU engine.
+///
+/// Returns a pointer to at least @p size bytes aligned to @p alignment or
+/// NULL on failure. @p user_data is the pointer passed to
+/// dnnl_cpu_engine_set_allocator().
+typedef void *(*dnnl_cpu_malloc_t)(
+        size_t size, size_t alignment, void *user_data);
+
+/// @brief A user-provided deallocation function of a CPU engine.
+///
+/// Releases a pointer returned by the paired #dnnl_cpu_malloc_t function.
+typedef void (*dnnl_cpu_free_t)(void *ptr, void *user_data);
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_primitives
@@ -2600,6 +2720,15 @@ typedef enum {
     dnnl_fpmath_mode_any,
 } dnnl_fpmath_mode_t;
 
+/// Accuracy mode of the elementwise functions
+typedef enum {
+    /// Default behavior, the functions are computed with the full accuracy
+    dnnl_accuracy_mode_strict,
+    /// Faster approximations of the transcendental functions are allowed.
+    /// The relative error stays below 1e-4.
+    dnnl_accuracy_mode_fast,
+} dnnl_accuracy_mode_t;
+
 /// Scratchpad mode
 typedef enum {
     /// The library manages the scratchpad allocation according to the policy
@@ -2709,6 +2838,15 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// A special mnemonic for attention queries. An alias for #DNNL_ARG_SRC_0.
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
+/// A special mnemonic for attention keys. An alias for #DNNL_ARG_SRC_1.
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+/// A special mnemonic for attention values. An alias for #DNNL_ARG_SRC_2.
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+/// A special mnemonic for attention mask. An alias for #DNNL_ARG_SRC_3.
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SRC_3
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2895,6 +3033,18 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Input scaling factors provided at execution time.
 #define DNNL_ARG_ATTR_INPUT_SCALES 1048576
 
+/// Weights decompression scaling factors provided at execution time.
+/// See @ref dev_guide_attributes_weights_decompression
+#define DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES 2097152
+
+/// Weights decompression zero points provided at execution time.
+/// See @ref dev_guide_attributes_weights_decompression
+#define DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS 2097153
+
+/// Softmax additive mask provided at execution time.
+/// See @ref dev_guide_softmax
+#define DNNL_ARG_ATTR_SOFTMAX_MASK 2097154
+
 /// A structure that contains an index and a memory object, and is used to pass
 /// arguments to dnnl_primitive_execute().
 typedef struct {
@@ -2902,6 +3052,21 @@ typedef struct {
     dnnl_memory_t memory; ///< Input/output memory
 } dnnl_exec_arg_t;
 
+/// Execution statistics of a primitive, see dnnl_primitive_get_stats().
+typedef struct {
+    /// Number of successful executions.
+    uint64_t ncalls;
+    /// Cumulative execution time in milliseconds.
+    double total_ms;
+    /// Minimal execution time in milliseconds, 0 if @p ncalls is 0.
+    double min_ms;
+    /// Maximal execution time in milliseconds.
+    double max_ms;
+    /// Cumulative size in bytes of the memory objects passed to the
+    /// executions.
+    uint64_t bytes;
+} dnnl_primitive_stats_t;
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_primitives_common
@@ -2987,6 +3152,7 @@ typedef enum {
     dnnl_query_reduction_d, ///< reduction descriptor
     dnnl_query_prelu_d, ///< prelu descriptor
     dnnl_query_softmax_v2_d, ///< softmax version 2 descriptor
+    dnnl_query_sdpa_d, ///< scaled dot-product attention descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
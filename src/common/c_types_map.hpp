@@ -153,6 +153,8 @@ const data_type_t f16 = dnnl_f16;
 const data_type_t bf16 = dnnl_bf16;
 const data_type_t f32 = dnnl_f32;
 const data_type_t f64 = dnnl_f64;
+const data_type_t s4 = dnnl_s4;
+const data_type_t u4 = dnnl_u4;
 const data_type_t s32 = dnnl_s32;
 const data_type_t s8 = dnnl_s8;
 const data_type_t u8 = dnnl_u8;
@@ -166,6 +168,12 @@ const fpmath_mode_t f16 = dnnl_fpmath_mode_f16;
 const fpmath_mode_t any = dnnl_fpmath_mode_any;
 } // namespace fpmath_mode
 
+using accuracy_mode_t = dnnl_accuracy_mode_t;
+namespace accuracy_mode {
+const accuracy_mode_t strict = dnnl_accuracy_mode_strict;
+const accuracy_mode_t fast = dnnl_accuracy_mode_fast;
+} // namespace accuracy_mode
+
 using scratchpad_mode_t = dnnl_scratchpad_mode_t;
 namespace scratchpad_mode {
 const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
@@ -180,6 +188,19 @@ const rnn_packed_format_t ldgoi_p = dnnl_ldgoi_p;
 const rnn_packed_format_t ldio_p = dnnl_ldio_p;
 } // namespace rnn_packed_format
 
+using sparse_encoding_t = dnnl_sparse_encoding_t;
+namespace sparse_encoding {
+const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
+const sparse_encoding_t bcsr_bitmask = dnnl_sparse_encoding_bcsr_bitmask;
+} // namespace sparse_encoding
+
+using sdpa_mask_kind_t = dnnl_sdpa_mask_kind_t;
+namespace sdpa_mask_kind {
+const sdpa_mask_kind_t none = dnnl_sdpa_mask_none;
+const sdpa_mask_kind_t buffer = dnnl_sdpa_mask_buffer;
+const sdpa_mask_kind_t causal = dnnl_sdpa_mask_causal;
+} // namespace sdpa_mask_kind
+
 using format_kind_t = dnnl_format_kind_t;
 namespace format_kind {
 const format_kind_t undef = dnnl_format_kind_undef;
@@ -187,6 +208,7 @@ const format_kind_t any = dnnl_format_kind_any;
 const format_kind_t blocked = dnnl_blocked;
 const format_kind_t wino = dnnl_format_kind_wino;
 const format_kind_t rnn_packed = dnnl_format_kind_rnn_packed;
+const format_kind_t sparse = dnnl_format_kind_sparse;
 } // namespace format_kind
 
 using format_tag_t = dnnl_format_tag_t;
@@ -1259,6 +1281,7 @@ const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax_v2 = dnnl_softmax_v2;
+const primitive_kind_t sdpa = dnnl_sdpa;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -1312,6 +1335,7 @@ const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
 const query_t reduction_d = dnnl_query_reduction_d;
 const query_t softmax_v2_d = dnnl_query_softmax_v2_d;
+const query_t sdpa_d = dnnl_query_sdpa_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -1333,6 +1357,7 @@ const query_t zero_pad_d = internal_only_start;
 using blocking_desc_t = dnnl_blocking_desc_t;
 using rnn_packed_desc_t = dnnl_rnn_packed_desc_t;
 using wino_desc_t = dnnl_wino_desc_t;
+using sparse_desc_t = dnnl_sparse_desc_t;
 using memory_extra_desc_t = dnnl_memory_extra_desc_t;
 using memory_desc_t = dnnl_memory_desc_t;
 using convolution_desc_t = dnnl_convolution_desc_t;
@@ -1353,6 +1378,7 @@ using matmul_desc_t = dnnl_matmul_desc_t;
 using resampling_desc_t = dnnl_resampling_desc_t;
 using reduction_desc_t = dnnl_reduction_desc_t;
 using softmax_v2_desc_t = dnnl_softmax_v2_desc_t;
+using sdpa_desc_t = dnnl_sdpa_desc_t;
 
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
@@ -1394,6 +1420,7 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        sdpa_desc_t sdpa;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -1425,6 +1452,7 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -1487,6 +1515,7 @@ struct prelu_pd_t;
 struct reduction_pd_t;
 struct reorder_pd_t;
 struct resampling_pd_t;
+struct sdpa_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
@@ -46,14 +46,19 @@ struct cache_blob_impl_t {
 
     status_t get_binary(const uint8_t **binary, size_t *binary_size) {
         if (!binary || !binary_size) { return status::invalid_arguments; }
-        if (pos_ >= size_) { return status::invalid_arguments; }
+        if (pos_ + sizeof(*binary_size) > size_) {
+            return status::invalid_arguments;
+        }
         (*binary_size) = *reinterpret_cast<size_t *>(data_ + pos_);
         pos_ += sizeof(*binary_size);
+        if (*binary_size > size_ - pos_) { return status::invalid_arguments; }
         (*binary) = data_ + pos_;
         pos_ += *binary_size;
         return status::success;
     }
 
+    bool is_end() const { return pos_ == size_; }
+
 private:
     size_t pos_;
     uint8_t *data_;
@@ -75,12 +80,26 @@ struct cache_blob_t {
         return impl_->get_binary(binary, binary_size);
     }
 
+    bool is_end() const { return !impl_ || impl_->is_end(); }
+
     explicit operator bool() const { return bool(impl_); }
 
 private:
     std::shared_ptr<cache_blob_impl_t> impl_;
 };
 
+// Interface of an implementation-specific kernel (e.g. a CPU JIT kernel) that
+// can be stored in a cache blob and restored from it instead of being
+// generated again.
+struct cache_blob_kernel_t {
+    virtual ~cache_blob_kernel_t() = default;
+    virtual status_t get_cache_blob_size(size_t *size) const = 0;
+    virtual status_t get_cache_blob(cache_blob_t &cache_blob) const = 0;
+};
+
+// Returns true if primitives created on the engine support cache blobs.
+bool is_cache_blob_supported(const engine_t *engine);
+
 } // namespace impl
 } // namespace dnnl
 
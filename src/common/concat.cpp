@@ -20,6 +20,7 @@
 
 #include "c_types_map.hpp"
 #include "concat_pd.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -85,6 +86,7 @@ status_t concat_primitive_desc_create(primitive_desc_iface_t **concat_pd_iface,
 
     dnnl_concat_desc_t desc
             = {primitive_kind::concat, dst_md, n, concat_dim, src_mds};
+    scoped_max_threads_t scoped_nthr(attr->nthr_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {});
     auto pd = primitive_cache().get_pd(key);
@@ -45,6 +45,8 @@ const char *dnnl_dt2str(dnnl_data_type_t v) {
     if (v == dnnl_s8) return "s8";
     if (v == dnnl_u8) return "u8";
     if (v == dnnl_f64) return "f64";
+    if (v == dnnl_s4) return "s4";
+    if (v == dnnl_u4) return "u4";
     assert(!"unknown dt");
     return "unknown dt";
 }
@@ -55,6 +57,7 @@ const char *dnnl_fmt_kind2str(dnnl_format_kind_t v) {
     if (v == dnnl_blocked) return "blocked";
     if (v == dnnl_format_kind_wino) return "wino";
     if (v == dnnl_format_kind_rnn_packed) return "rnn_packed";
+    if (v == dnnl_format_kind_sparse) return "sparse";
     assert(!"unknown fmt_kind");
     return "unknown fmt_kind";
 }
@@ -1101,6 +1104,7 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_reduction) return "reduction";
     if (v == dnnl_prelu) return "prelu";
     if (v == dnnl_softmax_v2) return "softmax_v2";
+    if (v == dnnl_sdpa) return "sdpa";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -29,6 +29,23 @@
 namespace dnnl {
 namespace impl {
 
+namespace {
+thread_local int max_threads_override = 0;
+} // namespace
+
+int get_max_threads_override() {
+    return max_threads_override;
+}
+
+scoped_max_threads_t::scoped_max_threads_t(int nthr)
+    : prev_nthr_(max_threads_override) {
+    if (nthr > 0) max_threads_override = nthr;
+}
+
+scoped_max_threads_t::~scoped_max_threads_t() {
+    max_threads_override = prev_nthr_;
+}
+
 static int adjust_num_threads(int nthr, dim_t work_amount) {
     if (nthr == 0) nthr = dnnl_get_current_num_threads();
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
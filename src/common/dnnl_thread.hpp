@@ -26,7 +26,7 @@
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
-inline int dnnl_get_max_threads() {
+inline int dnnl_get_runtime_max_threads() {
     return 1;
 }
 inline int dnnl_in_parallel() {
@@ -37,7 +37,7 @@ inline void dnnl_thr_barrier() {}
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
 #include "omp.h"
 #define DNNL_THR_SYNC 1
-inline int dnnl_get_max_threads() {
+inline int dnnl_get_runtime_max_threads() {
     return omp_get_max_threads();
 }
 inline int dnnl_in_parallel() {
@@ -51,7 +51,7 @@ inline void dnnl_thr_barrier() {
 #include "tbb/parallel_for.h"
 #include "tbb/task_arena.h"
 #define DNNL_THR_SYNC 0
-inline int dnnl_get_max_threads() {
+inline int dnnl_get_runtime_max_threads() {
     return tbb::this_task_arena::max_concurrency();
 }
 inline int dnnl_in_parallel() {
@@ -92,7 +92,7 @@ dnnl::threadpool_interop::threadpool_iface *get_active_threadpool();
 } // namespace impl
 } // namespace dnnl
 
-inline int dnnl_get_max_threads() {
+inline int dnnl_get_runtime_max_threads() {
     using namespace dnnl::impl::threadpool_utils;
     dnnl::threadpool_interop::threadpool_iface *tp = get_active_threadpool();
     // This is the maximum number of threads oneDNN would use
@@ -124,9 +124,39 @@ inline void dnnl_thr_barrier() {
 }
 #endif
 
+namespace dnnl {
+namespace impl {
+
+// Returns the number of threads set with scoped_max_threads_t for the calling
+// thread, or 0 if it is not set.
+int DNNL_API get_max_threads_override();
+
+// Makes the library use nthr threads on the calling thread for the lifetime of
+// the object, regardless of the threading runtime settings. This lets the
+// kernels pick their blocking for the team size a primitive is going to be
+// executed with. nthr == 0 keeps the current setting.
+struct scoped_max_threads_t {
+    scoped_max_threads_t(int nthr);
+    ~scoped_max_threads_t();
+
+private:
+    int prev_nthr_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scoped_max_threads_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+inline int dnnl_get_max_threads() {
+    const int nthr = dnnl::impl::get_max_threads_override();
+    return nthr > 0 ? nthr : dnnl_get_runtime_max_threads();
+}
+
 /* The purpose of this function is to provide the number of threads the library
  * is aware of when this function is invoked. Since oneDNN does not allow nested
  * parallelism, inside a parallel region the number of available threads is 1.
+ * If the number of threads is set with scoped_max_threads_t, return it.
  * Otherwise, the number of current threads varies between threading runtimes:
  * - for OpenMP and TBB, return the max number of threads since the number of
  *   threads is held in a global object throughout the entire execution.
@@ -139,6 +169,8 @@ inline void dnnl_thr_barrier() {
  */
 inline int dnnl_get_current_num_threads() {
     if (dnnl_in_parallel()) return 1;
+    const int nthr = dnnl::impl::get_max_threads_override();
+    if (nthr > 0) return nthr;
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
     return omp_get_max_threads();
 #elif DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
@@ -91,6 +91,28 @@ status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     return success;
 }
 
+status_t dnnl_cpu_engine_set_allocator(engine_t *engine,
+        dnnl_cpu_malloc_t malloc_fn, dnnl_cpu_free_t free_fn,
+        void *user_data) {
+    bool args_ok = engine != nullptr && engine->kind() == engine_kind::cpu
+            && (malloc_fn == nullptr) == (free_fn == nullptr);
+    if (!args_ok) return invalid_arguments;
+    return engine->set_cpu_allocator(malloc_fn, free_fn, user_data);
+}
+
+status_t dnnl_cpu_engine_set_allocator_flags(engine_t *engine, unsigned flags) {
+    const unsigned all_flags = dnnl_cpu_allocator_huge_pages
+            | dnnl_cpu_allocator_numa_interleave | dnnl_cpu_allocator_numa_local
+            | dnnl_cpu_allocator_pool;
+    const unsigned numa_flags = dnnl_cpu_allocator_numa_interleave
+            | dnnl_cpu_allocator_numa_local;
+    bool args_ok = engine != nullptr && engine->kind() == engine_kind::cpu
+            && (flags & ~all_flags) == 0
+            && (flags & numa_flags) != numa_flags;
+    if (!args_ok) return invalid_arguments;
+    return engine->set_cpu_allocator_flags(flags);
+}
+
 status_t dnnl_engine_destroy(engine_t *engine) {
 #ifdef DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE
     if (engine != nullptr) engine->release();
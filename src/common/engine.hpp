@@ -89,6 +89,17 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     }
 #endif
 
+    /** set user functions allocating memory on a CPU engine */
+    virtual dnnl::impl::status_t set_cpu_allocator(dnnl_cpu_malloc_t malloc_fn,
+            dnnl_cpu_free_t free_fn, void *user_data) {
+        return dnnl::impl::status::unimplemented;
+    }
+
+    /** configure the built-in allocator of a CPU engine */
+    virtual dnnl::impl::status_t set_cpu_allocator_flags(unsigned flags) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t get_service_stream(
             dnnl::impl::stream_t *&stream) {
         stream = nullptr;
@@ -62,6 +62,20 @@ dnnl_status_t dnnl_sgemm(char transa, char transb, dim_t M, dim_t N, dim_t K,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_grouped(dim_t group_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_grouped, cpu::sgemm_grouped,
+            group_size, transb, transa, N, M, K, alpha, B, ldb, A, lda, beta,
+            C, ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 dnnl_status_t dnnl_gemm_u8s8s32(char transa, char transb, char offsetc, dim_t M,
         dim_t N, dim_t K, float alpha, const uint8_t *A, dim_t lda, uint8_t ao,
         const int8_t *B, dim_t ldb, int8_t bo, float beta, int32_t *C,
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -202,6 +202,16 @@ protected:
         return IMPLICATION(use_scaleshift() || use_scale() || use_shift(),
                 weights_md()->data_type == data_type::f32);
     }
+
+    // Output scales are applied to the normalized result and are supported
+    // only for integer data types with a common (mask 0) scale.
+    bool attr_oscale_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        return oscale.mask_ == 0 && oscale.defined()
+                && IMPLICATION(!utils::one_of(src_md()->data_type,
+                                       data_type::s8, data_type::u8),
+                        oscale.has_default_values());
+    }
 };
 
 struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
@@ -199,6 +199,54 @@ status_t dnnl_memory_desc_init_by_strides(memory_desc_t *memory_desc, int ndims,
     return success;
 }
 
+status_t dnnl_memory_desc_init_by_sparse_encoding(memory_desc_t *memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type,
+        sparse_encoding_t encoding, const dims_t block_dims, int row_dim) {
+    if (any_null(memory_desc, dims, block_dims)) return invalid_arguments;
+
+    bool args_ok = ndims == 2
+            && memory_desc_sanity_check(
+                    ndims, dims, data_type, format_kind::undef)
+            && !one_of(data_type, s4, u4)
+            && encoding == sparse_encoding::bcsr_bitmask
+            && one_of(row_dim, 0, 1);
+    if (!args_ok) return invalid_arguments;
+    for (int d = 0; d < ndims; d++)
+        if (dims[d] <= 0 || dims[d] == DNNL_RUNTIME_DIM_VAL
+                || block_dims[d] <= 0)
+            return invalid_arguments;
+
+    const int col_dim = 1 - row_dim;
+    const dim_t nrows = div_up(dims[row_dim], block_dims[row_dim]);
+    const dim_t ncols = div_up(dims[col_dim], block_dims[col_dim]);
+    const dim_t bitmask_words = div_up(ncols, 64);
+    const size_t block_size = block_dims[0] * block_dims[1]
+            * types::data_type_size(data_type);
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+
+    // The values start at a cache line boundary, so the blocks of f32 data
+    // with a multiple of 16 elements in a row can be loaded aligned
+    auto &sd = md.format_desc.sparse_desc;
+    sd.encoding = encoding;
+    sd.row_dim = row_dim;
+    sd.block_dims[0] = block_dims[0];
+    sd.block_dims[1] = block_dims[1];
+    sd.bitmask_offset = rnd_up((nrows + 1) * sizeof(int64_t), 64);
+    sd.values_offset = rnd_up(
+            sd.bitmask_offset + nrows * bitmask_words * sizeof(uint64_t), 64);
+    sd.size = sd.values_offset + nrows * ncols * block_size;
+
+    *memory_desc = md;
+
+    return success;
+}
+
 status_t dnnl_memory_desc_init_submemory(memory_desc_t *md,
         const memory_desc_t *parent_md, const dims_t dims,
         const dims_t offsets) {
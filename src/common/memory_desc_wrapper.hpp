@@ -57,6 +57,7 @@ struct memory_desc_wrapper : public c_compatible {
     bool is_rnn_packed_desc() const {
         return format_kind() == format_kind::rnn_packed;
     }
+    bool is_sparse_desc() const { return format_kind() == format_kind::sparse; }
 
     const blocking_desc_t &blocking_desc() const {
         assert(is_blocking_desc());
@@ -70,6 +71,10 @@ struct memory_desc_wrapper : public c_compatible {
         assert(is_rnn_packed_desc());
         return md_->format_desc.rnn_packed_desc;
     }
+    const sparse_desc_t &sparse_desc() const {
+        assert(is_sparse_desc());
+        return md_->format_desc.sparse_desc;
+    }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
 
@@ -97,6 +102,11 @@ struct memory_desc_wrapper : public c_compatible {
     /** return the size of data type (a shortcut) */
     size_t data_type_size() const { return types::data_type_size(data_type()); }
 
+    /** returns true if two elements are packed into a byte */
+    bool is_sub_byte() const {
+        return utils::one_of(data_type(), data_type::s4, data_type::u4);
+    }
+
     /** return the size of data type of additional buffer */
     size_t additional_buffer_data_size(uint64_t flag_select) const {
         if (flag_select & memory_extra_flags::compensation_conv_s8s8)
@@ -169,6 +179,8 @@ struct memory_desc_wrapper : public c_compatible {
             return wino_desc().size;
         } else if (format_kind() == format_kind::rnn_packed) {
             return rnn_packed_desc().size;
+        } else if (format_kind() == format_kind::sparse) {
+            return sparse_desc().size;
         } else {
             if (offset0() != 0) return 0;
 
@@ -189,7 +201,9 @@ struct memory_desc_wrapper : public c_compatible {
                 max_size = utils::array_product(bd.inner_blks, bd.inner_nblks);
             }
 
-            size_t data_size = max_size * data_type_size();
+            size_t data_size = is_sub_byte()
+                    ? utils::div_up(max_size, 2)
+                    : max_size * data_type_size();
             if (is_additional_buffer()) {
                 // The additional buffers, typically of data type int32_t, float
                 // are stored at the end of data. Pad the data, so that the
@@ -457,7 +471,8 @@ inline bool memory_desc_wrapper::similar_to(const memory_desc_wrapper &rhs,
 
     if (one_of(format_kind(), format_kind::undef, format_kind::any))
         return false;
-    if (is_wino_desc() || is_rnn_packed_desc()) return false;
+    if (is_wino_desc() || is_rnn_packed_desc() || is_sparse_desc())
+        return false;
 
     const int ds = dim_start;
     const auto &blk = blocking_desc();
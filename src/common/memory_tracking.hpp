@@ -205,6 +205,7 @@ enum {
     key_conv_tr_diff_dst_bctx,
     key_conv_tr_src,
     key_conv_tr_src_bctx,
+    key_conv_tr_src_rows,
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
@@ -262,6 +263,13 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_keys,
+    key_sdpa_probs,
+    key_sdpa_queries,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_values,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
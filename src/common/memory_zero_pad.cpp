@@ -284,6 +284,12 @@ static status_t zero_pad(const memory_t *memory, const exec_ctx_t &ctx) {
         case s32: return typed_zero_pad<s32>(memory, ctx);
         case s8: return typed_zero_pad<s8>(memory, ctx);
         case u8: return typed_zero_pad<u8>(memory, ctx);
+        case s4:
+        case u4:
+            // Packed sub-byte data is supported in plain layouts only, which
+            // have nothing to zero pad
+            if (mdw.nelems(false) == mdw.nelems(true)) return success;
+            return unimplemented;
         default: assert(!"memory is undefined"); return unimplemented;
     }
     return unimplemented;
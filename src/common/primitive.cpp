@@ -14,11 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
 #include <string>
 
 #include <assert.h>
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -30,9 +32,11 @@
 #include "primitive_exec_types.hpp"
 #include "reorder_pd.hpp"
 #include "scratchpad_debug.hpp"
+#include "serialization_stream.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
 #include "utils.hpp"
+#include "verbose_sink.hpp"
 
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
@@ -58,6 +62,86 @@ void unpoison_outputs(const exec_args_t &args) {
 namespace dnnl {
 namespace impl {
 
+namespace {
+thread_local primitive_t *initializing_primitive = nullptr;
+
+// Sets the primitive being initialized by the calling thread. The previous
+// value is restored on destruction to support nested primitives.
+struct initializing_primitive_guard_t {
+    initializing_primitive_guard_t(primitive_t *p)
+        : prev_(initializing_primitive) {
+        initializing_primitive = p;
+    }
+    ~initializing_primitive_guard_t() { initializing_primitive = prev_; }
+
+private:
+    primitive_t *prev_;
+};
+
+// Cache blobs created from registered kernels start with the version of the
+// library they were created by.
+std::vector<uint8_t> get_cache_blob_header() {
+    serialization_stream_t sstream;
+    auto version = dnnl_version();
+    sstream.write(&version->major);
+    sstream.write(&version->minor);
+    sstream.write(&version->patch);
+    sstream.write(version->hash, std::strlen(version->hash));
+    return sstream.get_data();
+}
+} // namespace
+
+status_t primitive_t::init(engine_t *engine, bool use_global_scratchpad,
+        const cache_blob_t &cache_blob) {
+    cache_blob_ = cache_blob;
+    // GPU primitives store kernels in their own format.
+    const bool use_kernels_blob = engine->kind() == engine_kind::cpu;
+    if (cache_blob_ && use_kernels_blob) {
+        const uint8_t *header = nullptr;
+        size_t header_size = 0;
+        CHECK(cache_blob_.get_binary(&header, &header_size));
+        const auto expected_header = get_cache_blob_header();
+        if (header_size != expected_header.size()
+                || std::memcmp(header, expected_header.data(), header_size)
+                        != 0)
+            return status::invalid_arguments;
+    }
+    {
+        initializing_primitive_guard_t guard(this);
+        CHECK(init(engine));
+    }
+    // All stored kernels must be consumed, otherwise the blob was created
+    // for a different primitive.
+    if (cache_blob_ && use_kernels_blob && !cache_blob_.is_end())
+        return status::invalid_arguments;
+    CHECK(init_cached_resource(engine));
+    use_global_scratchpad_ = use_global_scratchpad;
+    // The `cache_blob_` is no longer needed after primitive creation.
+    cache_blob_ = cache_blob_t();
+    return status::success;
+}
+
+primitive_t *primitive_t::get_initializing_primitive() {
+    return initializing_primitive;
+}
+
+status_t primitive_t::get_cache_blob_size(size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    (*size) += get_cache_blob_header().size() + sizeof(size_t);
+    for (const auto *k : cache_blob_kernels_)
+        CHECK(k->get_cache_blob_size(size));
+    return status::success;
+}
+
+status_t primitive_t::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    const auto header = get_cache_blob_header();
+    CHECK(cache_blob.add_binary(header.data(), header.size()));
+    for (const auto *k : cache_blob_kernels_)
+        CHECK(k->get_cache_blob(cache_blob));
+    return status::success;
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
@@ -89,6 +173,8 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         const cache_blob_t &cache_blob = cache_blob_t()) {
 
     std::pair<primitive_iface_t *, bool> p_iface;
+    scoped_max_threads_t scoped_nthr(
+            primitive_desc_iface->impl()->attr()->nthr_);
 
     if (get_verbose() >= 2) {
         double start_ms = get_msec();
@@ -115,6 +201,8 @@ status_t primitive_execute(
         const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
     auto stream = ctx.stream();
     status_t status = success;
+    scoped_max_threads_t scoped_nthr(
+            primitive_iface->pd()->impl()->attr()->nthr_);
 
     stream->before_exec_hook();
 
@@ -124,12 +212,17 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
+    // Without verbose the stream is not waited for, so on asynchronous
+    // streams the execution counters only account for the submission time
+    uint64_t duration_ns = 0;
     if (get_verbose()) {
         stream->wait();
+        const uint64_t start_ns = primitive_stats_t::now_ns();
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         double duration_ms = get_msec() - start_ms;
+        duration_ns = primitive_stats_t::now_ns() - start_ns;
         std::string stamp;
         if (get_verbose_timestamp()) stamp = "," + std::to_string(start_ms);
 
@@ -137,7 +230,17 @@ status_t primitive_execute(
                 primitive_iface->pd()->info(), duration_ms);
         fflush(stdout);
     } else {
+        const uint64_t start_ns = primitive_stats_t::now_ns();
         status = stream->enqueue_primitive(primitive_iface, ctx);
+        duration_ns = primitive_stats_t::now_ns() - start_ns;
+    }
+
+    if (status == success) {
+        primitive_iface->stats().record(
+                duration_ns, primitive_stats_t::get_bytes(ctx.args()));
+        if (verbose_sink_enabled())
+            verbose_sink_record(primitive_iface->pd()->impl()->kind(),
+                    primitive_iface->pd()->info(), duration_ns);
     }
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -188,13 +291,8 @@ status_t dnnl_primitive_create_from_cache_blob(
             || size == 0) {
         return invalid_arguments;
     }
-    const auto ekind = primitive_desc_iface->engine()->kind();
-    const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_desc_iface->engine()))
         return status::unimplemented;
-    }
 
     cache_blob_t cb(const_cast<uint8_t *>(cache_blob), size);
     return dnnl::impl::primitive_create(
@@ -241,13 +339,8 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
         return status::invalid_arguments;
     }
 
-    const auto ekind = primitive_iface->engine()->kind();
-    const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_iface->engine()))
         return status::unimplemented;
-    }
 
     if (!cache_blob) {
         size_t sz = 0;
@@ -260,6 +353,15 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
     return primitive_iface->get_cache_blob(cb);
 }
 
+status_t dnnl_primitive_get_stats(const primitive_iface_t *primitive_iface,
+        int reset, dnnl_primitive_stats_t *stats) {
+    if (primitive_iface == nullptr) return invalid_arguments;
+    if (stats == nullptr && !reset) return invalid_arguments;
+
+    primitive_iface->stats().get(stats, reset);
+    return success;
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -295,12 +397,20 @@ status_t dnnl_primitive::init() {
     const size_t scratchpad_size
             = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
 
-    if (scratchpad_size) {
+    const bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
+            ? false
+            : primitive_->use_global_scratchpad();
+    // The memory is taken from the stream scratchpad on execution
+    use_stream_scratchpad_ = scratchpad_size
+            && !scratchpad_debug::is_protect_scratchpad()
+            && use_stream_scratchpad(pd_->engine(), use_global_scratchpad);
+
+    if (use_stream_scratchpad_)
+        CHECK(check_scratchpad_allocation(pd_->engine(), scratchpad_size));
+
+    if (scratchpad_size && !use_stream_scratchpad_) {
         const memory_tracking::registry_t &registry
                 = primitive_->pd()->scratchpad_registry();
-        bool use_global_scratchpad = scratchpad_debug::is_protect_scratchpad()
-                ? false
-                : primitive_->use_global_scratchpad();
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
@@ -337,6 +447,18 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
         mem_storage = scratchpad_->get_memory_storage();
     }
 
+    // The stream scratchpad is taken for the duration of the execution
+    std::unique_ptr<memory_storage_t> stream_mem_storage;
+    size_t stream_scratchpad_size = 0;
+    if (use_stream_scratchpad_) {
+        stream_scratchpad_size
+                = primitive_->pd()->scratchpad_size(scratchpad_mode::library);
+        stream_mem_storage = ctx.stream()->scratchpad().acquire(
+                engine(), stream_scratchpad_size);
+        if (!stream_mem_storage) return out_of_memory;
+        mem_storage = stream_mem_storage.get();
+    }
+
     auto scratchpad_grantor
             = primitive_->pd()->scratchpad_registry().grantor(mem_storage, ctx);
     ctx.set_scratchpad_grantor(&scratchpad_grantor);
@@ -344,6 +466,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+
+    if (use_stream_scratchpad_)
+        ctx.stream()->scratchpad().release(
+                std::move(stream_mem_storage), stream_scratchpad_size);
     return status;
 }
 
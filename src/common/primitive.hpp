@@ -28,11 +28,13 @@
 #include "memory_tracking.hpp"
 #include "primitive_desc.hpp"
 #include "primitive_exec_types.hpp"
+#include "primitive_stats.hpp"
 #include "rw_mutex.hpp"
 #include "scratchpad.hpp"
 
 #include <future>
 #include <type_traits>
+#include <vector>
 
 namespace dnnl {
 namespace impl {
@@ -48,30 +50,18 @@ struct primitive_t : public c_compatible {
     virtual status_t init(engine_t *engine) { return status::success; }
 
     status_t init(engine_t *engine, bool use_global_scratchpad,
-            const cache_blob_t &cache_blob) {
-        cache_blob_ = cache_blob;
-        CHECK(init(engine));
-        CHECK(init_cached_resource(engine));
-        use_global_scratchpad_ = use_global_scratchpad;
-        // The `cache_blob_` is no longer needed after primitive creation.
-        cache_blob_ = cache_blob_t();
-        return status::success;
-    }
+            const cache_blob_t &cache_blob);
 
     const std::shared_ptr<primitive_desc_t> &pd() const { return pd_; }
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // The default implementation stores the kernels registered during
+    // primitive initialization (see `register_cache_blob_kernel()`).
     virtual status_t get_cache_blob(
-            engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
-    }
+            engine_t *engine, cache_blob_t &cache_blob) const;
 
-    virtual status_t get_cache_blob_size(size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
-    }
+    virtual status_t get_cache_blob_size(size_t *size) const;
 
     virtual status_t create_resource(
             engine_t *engine, resource_mapper_t &mapper) const {
@@ -98,6 +88,17 @@ struct primitive_t : public c_compatible {
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
     cache_blob_t cache_blob() const { return cache_blob_; }
 
+    // Returns the primitive being initialized by the calling thread, or
+    // nullptr if there is none. Kernels created during initialization use it
+    // to register themselves and to get the cache blob to restore from.
+    static primitive_t *get_initializing_primitive();
+
+    // The kernel must be owned by the primitive. Kernels are stored in the
+    // cache blob in the order of registration.
+    void register_cache_blob_kernel(const cache_blob_kernel_t *kernel) {
+        cache_blob_kernels_.push_back(kernel);
+    }
+
 protected:
     template <typename impl_type, typename pd_t>
     static status_t create_primitive_common(
@@ -131,7 +132,13 @@ protected:
             // we have to create it and notify the waiting threads
             // once the creation is done.
             p = std::make_shared<impl_type>(pd);
-            status = p->init(engine, use_global_scratchpad, cache_blob);
+            {
+                // Kernels are generated here, including the ones of nested
+                // primitives, which are created with their own attributes
+                scoped_accuracy_mode_t scoped_accuracy(
+                        pd->attr()->accuracy_mode_);
+                status = p->init(engine, use_global_scratchpad, cache_blob);
+            }
             if (status != status::success) {
                 // Communicate an error.
                 p_promise.set_value({nullptr, status});
@@ -166,6 +173,8 @@ protected:
     cache_blob_t cache_blob_;
 
 private:
+    std::vector<const cache_blob_kernel_t *> cache_blob_kernels_;
+
     primitive_t() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_t);
 };
@@ -273,12 +282,15 @@ status_t primitive_execute(
 // 1. impl::primitive_t - a primitive implementation that can be
 // stored in the primitive cache. Other data members are NOT stored in
 // the cache
-// 2. scratchpad_t - a memory for scratchpad
+// 2. scratchpad_t - a memory for scratchpad, unless the scratchpad is taken
+// from the stream at execution (see stream_scratchpad_t)
 // 3. primitive_desc_iface_t - an alias for dnnl_primitive_desc and is
 // a user facing primitive descriptor (the one a user should create prior
 // creating a primitive)
 // 4. resource_mapper_t - a resource mapper that provides a mapping between
 // impl::primitive_t and its resource
+// 5. primitive_stats_t - execution counters of this particular primitive
+// object, they are not shared with other primitives created from the cache
 //
 // Note: primitive_desc_iface_t and impl::primitive_t share the same
 // impl::primitive_desc_t
@@ -298,6 +310,7 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    dnnl::impl::primitive_stats_t &stats() const { return stats_; }
 
     void retain() { counter_++; }
 
@@ -312,8 +325,10 @@ private:
     std::atomic<int> counter_;
     std::shared_ptr<dnnl::impl::primitive_t> primitive_;
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
+    bool use_stream_scratchpad_ = false;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    mutable dnnl::impl::primitive_stats_t stats_;
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
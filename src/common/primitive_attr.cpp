@@ -33,6 +33,23 @@ const primitive_attr_t &default_attr() {
     return default_attr_instance;
 }
 
+namespace {
+thread_local accuracy_mode_t current_accuracy_mode = accuracy_mode::strict;
+} // namespace
+
+accuracy_mode_t get_accuracy_mode() {
+    return current_accuracy_mode;
+}
+
+scoped_accuracy_mode_t::scoped_accuracy_mode_t(accuracy_mode_t mode)
+    : prev_mode_(current_accuracy_mode) {
+    current_accuracy_mode = mode;
+}
+
+scoped_accuracy_mode_t::~scoped_accuracy_mode_t() {
+    current_accuracy_mode = prev_mode_;
+}
+
 status_t scales_t::set(dim_t count, int mask, const float *scales) {
     cleanup();
 
@@ -135,6 +152,8 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_MASK(smask_t::oscale, output_scales_);
     CHECK_MASK(smask_t::scales, scales_);
     CHECK_MASK(smask_t::zero_points, zero_points_);
+    CHECK_MASK(smask_t::wei_decomp, wei_decomp_);
+    CHECK_MASK(smask_t::softmax_mask, softmax_mask_);
     CHECK_MASK(smask_t::post_ops, post_ops_);
     CHECK_MASK(smask_t::rnn_data_qparams, rnn_data_qparams_);
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
@@ -359,6 +378,15 @@ status_t primitive_attr_t::set_fpmath_mode(fpmath_mode_t fpmath_mode) {
     return st;
 }
 
+status_t primitive_attr_t::set_accuracy_mode(accuracy_mode_t accuracy_mode) {
+    const bool ok = one_of(accuracy_mode, accuracy_mode::strict,
+            accuracy_mode::fast);
+    if (!ok) return invalid_arguments;
+
+    accuracy_mode_ = accuracy_mode;
+    return success;
+}
+
 status_t primitive_attr_t::set_scratchpad_mode(
         scratchpad_mode_t scratchpad_mode) {
     using namespace dnnl::impl::scratchpad_mode;
@@ -370,6 +398,21 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_num_threads(int nthr) {
+    if (nthr < 0) return invalid_arguments;
+    nthr_ = nthr;
+    return success;
+}
+
+status_t primitive_attr_t::set_weights_decompression(
+        dim_t group_size, bool with_zero_points) {
+    return wei_decomp_.set(group_size, with_zero_points);
+}
+
+status_t primitive_attr_t::set_softmax_mask(int mask) {
+    return softmax_mask_.set(mask);
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     return post_ops_.copy_from(post_ops);
 }
@@ -415,6 +458,19 @@ status_t dnnl_primitive_attr_set_fpmath_mode(
     return attr->set_fpmath_mode(mode);
 }
 
+status_t dnnl_primitive_attr_get_accuracy_mode(
+        const primitive_attr_t *attr, accuracy_mode_t *mode) {
+    if (any_null(attr, mode)) return invalid_arguments;
+    *mode = attr->accuracy_mode_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_accuracy_mode(
+        primitive_attr_t *attr, accuracy_mode_t mode) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_accuracy_mode(mode);
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -431,6 +487,46 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_num_threads(
+        const primitive_attr_t *attr, int *nthr) {
+    if (any_null(attr, nthr)) return invalid_arguments;
+    *nthr = attr->nthr_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_num_threads(primitive_attr_t *attr, int nthr) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_num_threads(nthr);
+}
+
+status_t dnnl_primitive_attr_get_weights_decompression(
+        const primitive_attr_t *attr, dim_t *group_size,
+        int *with_zero_points) {
+    if (any_null(attr, group_size, with_zero_points)) return invalid_arguments;
+    *group_size = attr->wei_decomp_.group_size_;
+    *with_zero_points = attr->wei_decomp_.with_zero_points_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_weights_decompression(
+        primitive_attr_t *attr, dim_t group_size, int with_zero_points) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_weights_decompression(group_size, with_zero_points != 0);
+}
+
+status_t dnnl_primitive_attr_get_softmax_mask(
+        const primitive_attr_t *attr, int *mask) {
+    if (any_null(attr, mask)) return invalid_arguments;
+    *mask = attr->softmax_mask_.mask_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_softmax_mask(
+        primitive_attr_t *attr, int mask) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_softmax_mask(mask);
+}
+
 status_t dnnl_primitive_attr_get_output_scales(const primitive_attr_t *attr,
         dim_t *count, int *mask, const float **scales) {
     if (any_null(attr, count, mask, scales)) return invalid_arguments;
@@ -32,6 +32,23 @@ namespace impl {
 
 const primitive_attr_t &default_attr();
 
+// Returns the accuracy mode of the primitive being created on the calling
+// thread. Kernel generators use it to pick the approximations of the
+// elementwise functions.
+accuracy_mode_t get_accuracy_mode();
+
+// Sets the accuracy mode returned by get_accuracy_mode() for the lifetime of
+// the object.
+struct scoped_accuracy_mode_t {
+    scoped_accuracy_mode_t(accuracy_mode_t mode);
+    ~scoped_accuracy_mode_t();
+
+private:
+    accuracy_mode_t prev_mode_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scoped_accuracy_mode_t);
+};
+
 struct rnn_data_qparams_t : public c_compatible {
     rnn_data_qparams_t() : scale_(1.), shift_(0.) {}
     bool has_default_values() const { return (scale_ == 1. && shift_ == 0.); }
@@ -55,6 +72,63 @@ struct rnn_data_qparams_t : public c_compatible {
     float shift_;
 };
 
+// Weights decompression parameters.
+//
+// Weights of a lower precision data type are up-converted on the fly as
+// (wei - zero_point) * scale, with a scale and an optional zero point per
+// group_size_ consecutive elements along the reduction dimension (K) and per
+// output channel (N). The scales and zero points are passed at execution time
+// with the DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_* arguments.
+struct wei_decomp_t : public c_compatible {
+    wei_decomp_t() : group_size_(0), with_zero_points_(false) {}
+
+    bool has_default_values() const { return group_size_ == 0; }
+    bool defined() const { return true; }
+
+    status_t set(dim_t group_size, bool with_zero_points) {
+        if (group_size <= 0) return status::invalid_arguments;
+        group_size_ = group_size;
+        with_zero_points_ = with_zero_points;
+        return status::success;
+    }
+
+    bool operator==(const wei_decomp_t &rhs) const {
+        return group_size_ == rhs.group_size_
+                && with_zero_points_ == rhs.with_zero_points_;
+    }
+
+    // The number of elements along K that share a scale and a zero point,
+    // 0 means that the weights are not decompressed
+    dim_t group_size_;
+    bool with_zero_points_;
+};
+
+// Softmax mask parameters.
+//
+// An f32 mask is added to the scaled source before the softmax. It has the
+// source dimensions, with the dimensions not in mask_ set to one and
+// broadcast, is dense in row-major order, and is passed at execution time
+// with the DNNL_ARG_ATTR_SOFTMAX_MASK argument.
+struct softmax_mask_t : public c_compatible {
+    softmax_mask_t() : mask_(-1) {}
+
+    bool has_default_values() const { return mask_ < 0; }
+
+    status_t set(int mask) {
+        if (mask < 0) return status::invalid_arguments;
+        mask_ = mask;
+        return status::success;
+    }
+
+    bool operator==(const softmax_mask_t &rhs) const {
+        return mask_ == rhs.mask_;
+    }
+
+    // The i-th bit is set if the mask varies along the i-th dimension,
+    // a negative value means that no mask is applied
+    int mask_;
+};
+
 struct rnn_tparams_t : public c_compatible {
     rnn_tparams_t()
         : test_mode_(false), scales_(nullptr), ngates_(0), cscale_(0.0f) {}
@@ -596,7 +670,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
-        , fpmath_mode_(dnnl::impl::get_fpmath_mode()) {}
+        , fpmath_mode_(dnnl::impl::get_fpmath_mode())
+        , accuracy_mode_(dnnl::impl::accuracy_mode::strict)
+        , nthr_(0) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -615,6 +691,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         zero_points_ = other.zero_points_;
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_mode_ = other.fpmath_mode_;
+        accuracy_mode_ = other.accuracy_mode_;
+        nthr_ = other.nthr_;
+        wei_decomp_ = other.wei_decomp_;
+        softmax_mask_ = other.softmax_mask_;
         CHECK(post_ops_.copy_from(other.post_ops_));
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -640,12 +720,15 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_weights_qparams = 1u << 8,
         rnn_tparams = 1u << 9,
         sum_dt = 1u << 10,
-        rnn_weights_projection_qparams = 1u << 11
+        rnn_weights_projection_qparams = 1u << 11,
+        wei_decomp = 1u << 12,
+        softmax_mask = 1u << 13
     };
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_, accuracy_mode_ and nthr_ are not taken into
+     * account */
     bool has_default_values(skip_mask_t mask = skip_mask_t::none,
             dnnl::impl::data_type_t dst_dt = dnnl_data_type_undef) const;
 
@@ -655,8 +738,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_mode_ == rhs.fpmath_mode_
+                && accuracy_mode_ == rhs.accuracy_mode_ && nthr_ == rhs.nthr_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
+                && wei_decomp_ == rhs.wei_decomp_
+                && softmax_mask_ == rhs.softmax_mask_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
@@ -667,8 +753,14 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     }
 
     dnnl::impl::status_t set_fpmath_mode(dnnl::impl::fpmath_mode_t fpmath_mode);
+    dnnl::impl::status_t set_accuracy_mode(
+            dnnl::impl::accuracy_mode_t accuracy_mode);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_num_threads(int nthr);
+    dnnl::impl::status_t set_weights_decompression(
+            dnnl::impl::dim_t group_size, bool with_zero_points);
+    dnnl::impl::status_t set_softmax_mask(int mask);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
     dnnl::impl::status_t set_default_formats(
             const dnnl::impl::memory_desc_t *dst_md);
@@ -699,6 +791,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_mode_t fpmath_mode_;
+    dnnl::impl::accuracy_mode_t accuracy_mode_;
+    // The number of threads the primitive is created and executed with,
+    // 0 means the threading runtime default
+    int nthr_;
+    dnnl::impl::wei_decomp_t wei_decomp_;
+    dnnl::impl::softmax_mask_t softmax_mask_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -21,13 +21,9 @@
 #include "rw_mutex.hpp"
 #include "z_magic.hpp"
 
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-#include "cpu/platform.hpp"
-#else
-#include <chrono>
-#endif
-
 #include <algorithm>
+#include <iterator>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -37,18 +33,6 @@
 namespace dnnl {
 namespace impl {
 
-namespace {
-
-size_t get_timestamp() {
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-    return cpu::platform::get_timestamp();
-#else
-    return std::chrono::steady_clock::now().time_since_epoch().count();
-#endif
-}
-
-} // namespace
-
 primitive_cache_t &primitive_cache() {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     static const int capacity
@@ -83,164 +67,189 @@ bool is_primitive_in_cache(const primitive_iface_t *p_iface) {
 
 size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     size_t old_capacity = primitive_cache().get_capacity();
-    static_cast<lru_primitive_cache_t &>((primitive_cache())).capacity_
-            = capacity;
+    static_cast<lru_primitive_cache_t &>((primitive_cache()))
+            .capacity_.store(capacity);
     return old_capacity;
 }
 
+int set_primitive_cache_n_shards(int n_shards) {
+    auto &cache = static_cast<lru_primitive_cache_t &>(primitive_cache());
+    n_shards = nstl::min(nstl::max(n_shards, 1), cache.n_shards_);
+    const int capacity = cache.get_capacity();
+    cache.set_capacity(0);
+    const int old_n_shards = cache.n_active_shards_.exchange(n_shards);
+    cache.set_capacity(capacity);
+    return old_n_shards;
+}
+
+constexpr int lru_primitive_cache_t::n_shards_;
+
+lru_primitive_cache_t::lru_primitive_cache_t(int capacity)
+    : capacity_(capacity), size_(0), n_active_shards_(n_shards_) {}
+
 status_t lru_primitive_cache_t::set_capacity(int capacity) {
-    utils::lock_write_t lock_w(rw_mutex());
-    capacity_ = (size_t)capacity;
-    // Check if number of entries exceeds the new capacity
-    if (cache_mapper().size() > capacity_) {
-        // Evict excess entries
-        size_t n_excess_entries = cache_mapper().size() - capacity_;
-        evict(n_excess_entries);
+    capacity_.store((size_t)capacity);
+    if (capacity == 0) {
+        // Clear the cache
+        for (auto &shard : shards_) {
+            utils::lock_write_t lock_w(shard.rw_mutex_);
+            size_ -= shard.cache_mapper().size();
+            shard.cache_mapper().clear();
+            shard.n_entries_ = 0;
+        }
+        return status::success;
+    }
+    // Evict excess entries if the number of entries exceeds the new capacity
+    while (size_.load() > capacity_.load()) {
+        if (!evict_one()) break;
     }
     return status::success;
 }
 
 int lru_primitive_cache_t::get_capacity() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)capacity_;
+    return (int)capacity_.load();
 }
 
 // For undocumented API
 int lru_primitive_cache_t::get_size() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)cache_mapper().size();
+    size_t size = 0;
+    for (const auto &shard : shards_) {
+        utils::lock_read_t lock_r(shard.rw_mutex_);
+        size += shard.cache_mapper().size();
+    }
+    return (int)size;
+}
+
+lru_primitive_cache_t::shard_t &lru_primitive_cache_t::get_shard(
+        const key_t &key) {
+    return shards_[std::hash<key_t>()(key) % n_active_shards_.load()];
 }
 
 lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
         const key_t &key, const value_t &value) {
-    // 1. Section with shared access (read lock)
-    lock_read();
     // Check if the cache is enabled.
-    if (capacity_ == 0) {
-        unlock_read();
-        return value_t();
-    }
+    if (capacity_.load() == 0) return value_t();
+
+    auto &shard = get_shard(key);
+
+    // 1. Section with shared access to the shard (read lock)
     // Check if the requested entry is present in the cache (likely cache_hit)
-    auto e = get(key);
-    if (e.valid()) {
-        unlock_read();
-        return e;
+    {
+        utils::lock_read_t lock_r(shard.rw_mutex_);
+        auto e = get(shard, key);
+        if (e.valid()) return e;
     }
 
-    unlock_read();
+    // 2. Reserve a slot for the new entry evicting other entries if needed.
+    if (!reserve_slot()) return value_t();
 
-    // 2. Section with exclusive access (write lock).
-    // In a multithreaded scenario, in the context of one thread the cache
+    // 3. Section with exclusive access to the shard (write lock).
+    // In a multithreaded scenario, in the context of one thread the shard
     // may have changed by another thread between releasing the read lock and
     // acquiring the write lock (a.k.a. ABA problem), therefore additional
     // checks have to be performed for correctness.
-    // Double check the capacity due to possible race condition
-    lock_write();
-    if (capacity_ == 0) {
-        unlock_write();
+    utils::lock_write_t lock_w(shard.rw_mutex_);
+    // Double check the capacity since the cache may have been cleared.
+    if (capacity_.load() == 0) {
+        release_slot();
         return value_t();
     }
 
     // Double check if the requested entry is present in the cache (unlikely
     // cache_hit).
-    e = get(key);
-    if (!e.valid()) {
-        // If the entry is missing in the cache then add it (cache_miss)
-        add(key, value);
+    auto e = get(shard, key);
+    if (e.valid()) {
+        release_slot();
+        return e;
     }
-    unlock_write();
+
+    // If the entry is missing in the cache then add it (cache_miss)
+    auto res = shard.cache_mapper().emplace(std::piecewise_construct,
+            std::forward_as_tuple(key), std::forward_as_tuple(value));
+    MAYBE_UNUSED(res);
+    assert(res.second);
+    shard.n_entries_++;
     return e;
 }
 
-void lru_primitive_cache_t::add(const key_t &key, const value_t &value) {
-    // std::list::size() method has linear complexity. Check the primitive cache
-    // size using std::unordered_map::size();
-    if (cache_mapper().size() == capacity_) {
-        // Evict the least recently used entry
-        evict(1);
+bool lru_primitive_cache_t::reserve_slot() {
+    size_t size = size_.load();
+    while (true) {
+        const size_t capacity = capacity_.load();
+        if (capacity == 0) return false;
+        if (size < capacity) {
+            if (size_.compare_exchange_weak(size, size + 1)) return true;
+            continue;
+        }
+        // The cache is full. If there is nothing to evict, the remaining
+        // slots are reserved by the threads which are about to insert their
+        // entries.
+        if (!evict_one()) std::this_thread::yield();
+        size = size_.load();
     }
-
-    size_t timestamp = get_timestamp();
-
-    auto res = cache_mapper().emplace(std::piecewise_construct,
-            std::forward_as_tuple(key),
-            std::forward_as_tuple(value, timestamp));
-    MAYBE_UNUSED(res);
-    assert(res.second);
 }
 
-lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) return value_t();
+lru_primitive_cache_t::value_t lru_primitive_cache_t::get(
+        shard_t &shard, const key_t &key) {
+    auto it = shard.cache_mapper().find(key);
+    if (it == shard.cache_mapper().end()) return value_t();
 
-    size_t timestamp = get_timestamp();
-    it->second.timestamp_.store(timestamp);
+    // Mark the entry as recently used. Only the flag of the found entry is
+    // modified, therefore it is safe to do under a read lock.
+    if (!it->second.referenced_.load(std::memory_order_relaxed))
+        it->second.referenced_.store(true, std::memory_order_relaxed);
     // Return the entry
     return it->second.value_;
 }
 
 std::shared_ptr<primitive_desc_t> lru_primitive_cache_t::get_pd(
         const key_t &key) {
-    lock_read();
-    if (capacity_ == 0) {
-        unlock_read();
-        return nullptr;
+    if (capacity_.load() == 0) return nullptr;
+
+    auto &shard = get_shard(key);
+    value_t e;
+    {
+        utils::lock_read_t lock_r(shard.rw_mutex_);
+        e = get(shard, key);
     }
-    auto e = get(key);
-    unlock_read();
 
     if (e.valid()) return e.get().primitive->pd();
     return nullptr;
 }
 
 void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
-    lock_write();
+    auto &shard = get_shard(key);
+    utils::lock_write_t lock_w(shard.rw_mutex_);
 
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
-
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) {
-        // The entry has been already evicted at this point
-        unlock_write();
-        return;
-    }
+    auto it = shard.cache_mapper().find(key);
+    // The entry has been already evicted at this point
+    if (it == shard.cache_mapper().end()) return;
 
     const auto &value = it->second.value_;
-    if (value.get().primitive) {
-        // If the entry is not invalidated
-        unlock_write();
-        return;
-    }
+    // If the entry is not invalidated
+    if (value.get().primitive) return;
 
     // Remove the invalidated entry
-    cache_mapper().erase(it);
-    unlock_write();
+    shard.cache_mapper().erase(it);
+    shard.n_entries_--;
+    release_slot();
 }
 
 void lru_primitive_cache_t::update_entry(
         const key_t &key, const primitive_desc_t *pd) {
-    lock_write();
-
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
+    auto &shard = get_shard(key);
+    utils::lock_write_t lock_w(shard.rw_mutex_);
 
-    auto it = cache_mapper().find(key);
+    auto it = shard.cache_mapper().find(key);
 
     // There is nothing to do in two cases:
     // 1. The requested entry is not in the cache because it has been evicted
     //    by another thread
     // 2. After the requested entry had been evicted it was inserted again
     //    by another thread
-    if (it == cache_mapper().end()
-            || it->first.thread_id() != key.thread_id()) {
-        unlock_write();
+    if (it == shard.cache_mapper().end()
+            || it->first.thread_id() != key.thread_id())
         return;
-    }
 
     const auto *op_desc = pd->op_desc();
     const auto *attr = pd->attr();
@@ -248,61 +257,95 @@ void lru_primitive_cache_t::update_entry(
     // Update key in cache_mapper()
     it->first.op_desc_ = op_desc;
     it->first.attr_ = attr;
-    unlock_write();
 }
 
-// Evicts n the least recently used entries
-void lru_primitive_cache_t::evict(size_t n) {
-    using v_t = std::unordered_map<key_t, timed_entry_t>::value_type;
+// Evicts one entry from the shard with the most entries, which approximates
+// the eviction of the least recently used entry of the whole cache better
+// than a fixed order of the shards. Returns false if all the shards are empty.
+bool lru_primitive_cache_t::evict_one() {
+    while (true) {
+        shard_t *victim = nullptr;
+        size_t max_n_entries = 0;
+        for (auto &shard : shards_) {
+            const size_t n_entries = shard.n_entries_.load();
+            if (n_entries > max_n_entries) {
+                max_n_entries = n_entries;
+                victim = &shard;
+            }
+        }
+        if (!victim) return false;
 
-    if (n == capacity_) {
-        cache_mapper().clear();
-        return;
+        utils::lock_write_t lock_w(victim->rw_mutex_);
+        if (evict_one(*victim)) {
+            release_slot();
+            return true;
+        }
+        // The shard has been emptied by another thread, choose again
     }
+}
 
-    for (size_t e = 0; e < n; e++) {
-        // Find the smallest timestamp
-        // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-        // maybe evict multiple entries at once.
-        auto it = std::min_element(cache_mapper().begin(), cache_mapper().end(),
-                [&](const v_t &left, const v_t &right) {
-                    // By default, load() and operator T use sequentially
-                    // consistent memory ordering, which enforces writing the
-                    // timestamps into registers in the same exact order they
-                    // are read from the CPU cache line. Since eviction is
-                    // performed under a write lock, this order is not
-                    // important, therefore we can safely use the weakest memory
-                    // ordering (relaxed). This brings about a few microseconds
-                    // performance improvement for default primitive cache
-                    // capacity.
-                    return left.second.timestamp_.load(
-                                   std::memory_order_relaxed)
-                            < right.second.timestamp_.load(
-                                    std::memory_order_relaxed);
-                });
-        auto res = cache_mapper().erase(it->first);
-        MAYBE_UNUSED(res);
-        assert(res);
+// Evicts one entry of the shard with CLOCK algorithm. The shard must be
+// locked for writing.
+bool lru_primitive_cache_t::evict_one(shard_t &shard) {
+    auto &cache_mapper = shard.cache_mapper();
+    if (cache_mapper.empty()) return false;
+
+    // The flags are cleared on the first pass over the buckets, so an entry
+    // is found at most on the second pass.
+    const size_t n_buckets = cache_mapper.bucket_count();
+    for (size_t i = 0; i < 2 * n_buckets; i++) {
+        const size_t b = shard.clock_hand_++ % n_buckets;
+        for (auto it = cache_mapper.begin(b); it != cache_mapper.end(b);
+                it++) {
+            // Since eviction is performed under a write lock, the weakest
+            // memory ordering (relaxed) is sufficient.
+            if (it->second.referenced_.load(std::memory_order_relaxed)) {
+                it->second.referenced_.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            // Keep the hand at the bucket as it may have more entries
+            shard.clock_hand_ = b;
+            auto res = cache_mapper.erase(it->first);
+            MAYBE_UNUSED(res);
+            assert(res);
+            shard.n_entries_--;
+            return true;
+        }
     }
+    assert(!"no entry to evict");
+    return false;
 }
 
 lru_primitive_cache_t::~lru_primitive_cache_t() {
-    if (cache_mapper().empty()) return;
+    const bool is_empty = std::all_of(std::begin(shards_), std::end(shards_),
+            [](const shard_t &shard) { return shard.cache_mapper().empty(); });
+    if (is_empty) return;
 
 // The library unloading issue affects only Windows and
 // DPCPP and OpenCL runtimes when DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE is ON.
 #ifndef DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE
     return;
 #else
+    // Destroys the content of the cache
+    const auto reset = [&]() {
+        for (auto &shard : shards_)
+            shard.cache_mapper_.reset();
+    };
 
 #if defined(_WIN32) \
         && (defined(DNNL_WITH_SYCL) || DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL)
+    // Leaks the content of the cache
+    const auto release = [&]() {
+        for (auto &shard : shards_)
+            shard.cache_mapper_.release();
+    };
+
     // The ntdll.dll library is located in system32 therefore setting additional
     // environment is not required.
     HMODULE handle = LoadLibraryExA(
             "ntdll.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
     if (!handle) {
-        cache_mapper_.release();
+        release();
         return;
     }
 
@@ -315,7 +358,7 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         auto ret = FreeLibrary(handle);
         assert(ret);
         MAYBE_UNUSED(ret);
-        cache_mapper_.release();
+        release();
         return;
     }
 
@@ -329,16 +372,19 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         // The whole process is being terminated hence destroying content of
         // the primitive cache cannot be done safely. However we can check
         // all entries and remove those that are not affected e.g. native CPU.
-        for (auto it = cache_mapper().begin(); it != cache_mapper().end();) {
-            const auto &engine_id = it->first.engine_id_;
-            if (engine_id.kind() == engine_kind::cpu
-                    && is_native_runtime(engine_id.runtime_kind())) {
-                it = cache_mapper().erase(it);
-            } else {
-                ++it;
+        for (auto &shard : shards_) {
+            auto &cache_mapper = shard.cache_mapper();
+            for (auto it = cache_mapper.begin(); it != cache_mapper.end();) {
+                const auto &engine_id = it->first.engine_id_;
+                if (engine_id.kind() == engine_kind::cpu
+                        && is_native_runtime(engine_id.runtime_kind())) {
+                    it = cache_mapper.erase(it);
+                } else {
+                    ++it;
+                }
             }
         }
-        cache_mapper_.release();
+        release();
     } else {
         // Three scenarios possible:
         // 1. oneDNN is being dynamically unloaded
@@ -348,13 +394,13 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         //    the process terminates
         // In all these scenarios content of the primitive cache can be safely
         // destroyed.
-        cache_mapper_.reset();
+        reset();
     }
 #else
     // Always destroy the content of the primitive cache for non-Windows OSes,
     // and non-sycl and non-ocl runtimes because there is no a problem with
     // library unloading order in such cases.
-    cache_mapper_.reset();
+    reset();
 #endif
 
 #endif /* DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE */
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #ifndef COMMON_PRIMITIVE_CACHE_HPP
 #define COMMON_PRIMITIVE_CACHE_HPP
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <thread>
@@ -52,26 +53,22 @@ struct primitive_cache_t : public c_compatible {
     virtual int get_size() const = 0;
 
     virtual std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) = 0;
-
-protected:
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_read() { rw_mutex().lock_read(); }
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_read() { rw_mutex().unlock_read(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses an approximation of LRU replacement policy.
+//
+// The entries are distributed over shards by the key hash. Each shard is
+// guarded by its own read-write mutex, so threads working with different
+// keys do not contend, and a cache hit takes only a shared lock of a single
+// shard. The total number of entries is limited by the capacity of the whole
+// cache: a slot is reserved before an entry is inserted, and when the cache
+// is full an entry is evicted from the shard with the most entries. Eviction
+// within a shard uses CLOCK (second chance) algorithm: a new entry and a hit
+// mark the entry as referenced, and the clock hand moving over the buckets
+// clears the mark of referenced entries and evicts the first entry which is
+// not referenced.
 struct lru_primitive_cache_t : public primitive_cache_t {
-    lru_primitive_cache_t(int capacity) : capacity_(capacity) {
-        cache_mapper_ = utils::make_unique<
-                std::unordered_map<key_t, timed_entry_t>>();
-    }
-
+    lru_primitive_cache_t(int capacity);
     ~lru_primitive_cache_t() override;
 
     status_t set_capacity(int capacity) override;
@@ -86,35 +83,56 @@ struct lru_primitive_cache_t : public primitive_cache_t {
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) override;
 
 private:
-    void evict(size_t n);
-    void add(const key_t &key, const value_t &value);
-    value_t get(const key_t &key);
-
-    size_t capacity_;
-    struct timed_entry_t {
+    struct clock_entry_t {
         value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        std::atomic<bool> referenced_;
+        clock_entry_t(const value_t &value)
+            : value_(value), referenced_(true) {}
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return *cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return *cache_mapper_;
-    }
-
-    // Each entry in the cache has a corresponding key and timestamp.
     // NOTE: pairs that contain atomics cannot be stored in an unordered_map *as
     // an element*, since it invokes the copy constructor of std::atomic, which
     // is deleted.
-    std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> cache_mapper_;
+    using cache_mapper_t = std::unordered_map<key_t, clock_entry_t>;
+
+    struct shard_t {
+        shard_t()
+            : cache_mapper_(utils::make_unique<cache_mapper_t>())
+            , n_entries_(0)
+            , clock_hand_(0) {}
+
+        cache_mapper_t &cache_mapper() { return *cache_mapper_; }
+        const cache_mapper_t &cache_mapper() const { return *cache_mapper_; }
+
+        mutable utils::rw_mutex_t rw_mutex_;
+        std::unique_ptr<cache_mapper_t> cache_mapper_;
+        // Number of the entries, can be read without the lock to choose the
+        // shard to evict an entry from
+        std::atomic<size_t> n_entries_;
+        // Index of the bucket the clock hand points to
+        size_t clock_hand_;
+    };
+
+    static constexpr int n_shards_ = 16;
+
+    shard_t &get_shard(const key_t &key);
+    value_t get(shard_t &shard, const key_t &key);
+    bool reserve_slot();
+    void release_slot() { size_--; }
+    bool evict_one();
+    static bool evict_one(shard_t &shard);
+
+    std::atomic<size_t> capacity_;
+    // Number of the entries in the cache including the reserved ones
+    std::atomic<size_t> size_;
+    // Number of the shards in use, may be reduced for testing
+    std::atomic<int> n_active_shards_;
+    shard_t shards_[n_shards_];
 
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
             size_t capacity);
+    friend int DNNL_API set_primitive_cache_n_shards(int n_shards);
 };
 
 primitive_cache_t &primitive_cache();
@@ -124,6 +142,10 @@ status_t DNNL_API get_primitive_cache_size(int *size);
 bool DNNL_API is_primitive_in_cache(const primitive_iface_t *p_iface);
 bool DNNL_API is_pd_in_cache(const primitive_desc_iface_t *pd_iface);
 size_t DNNL_API set_primitive_cache_capacity_without_clearing(size_t capacity);
+// Clears the cache and distributes the entries over the first `n_shards`
+// shards only, which makes the eviction order predictable. Returns the
+// previous number of shards.
+int DNNL_API set_primitive_cache_n_shards(int n_shards);
 
 } // namespace impl
 } // namespace dnnl
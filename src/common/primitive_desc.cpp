@@ -45,6 +45,15 @@ int primitive_desc_t::n_prelu_po_inputs() const {
     return po_inputs(attr()->post_ops_, primitive_kind::prelu);
 }
 
+bool primitive_desc_t::has_sparse_weights(const op_desc_t *adesc) {
+    const memory_desc_t *wei_md = nullptr;
+    if (adesc->kind == primitive_kind::inner_product)
+        wei_md = &adesc->inner_product.weights_desc;
+    else if (adesc->kind == primitive_kind::matmul)
+        wei_md = &adesc->matmul.weights_desc;
+    return wei_md && wei_md->format_kind == format_kind::sparse;
+}
+
 status_t dnnl_primitive_desc::create_primitive_iface(
         std::pair<primitive_iface_t *, bool> &primitive_iface,
         const cache_blob_t &cache_blob) const {
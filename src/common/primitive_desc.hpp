@@ -93,6 +93,15 @@ struct primitive_desc_t : public c_compatible {
         if ((arg == (DNNL_ARG_ATTR_INPUT_SCALES | DNNL_ARG_SRC_1))
                 && !attr()->scales_.get(DNNL_ARG_SRC_1).defined())
             return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES
+                && !attr()->wei_decomp_.has_default_values())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS
+                && attr()->wei_decomp_.with_zero_points_)
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_SOFTMAX_MASK
+                && !attr()->softmax_mask_.has_default_values())
+            return arg_usage_t::input;
         if (arg == DNNL_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
@@ -214,6 +223,8 @@ struct primitive_desc_t : public c_compatible {
 
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
+    // Sparse weights are accepted only by implementations that opt in
+    virtual bool supports_sparse_weights() const { return false; }
     int n_binary_po_inputs() const;
     int n_prelu_po_inputs() const;
     // The `hint_mds(bool is_hint)` returns a vector of memory descriptors
@@ -318,6 +329,10 @@ protected:
             delete _pd;
             return out_of_memory;
         }
+        if (has_sparse_weights(adesc) && !_pd->supports_sparse_weights()) {
+            delete _pd;
+            return unimplemented;
+        }
         if (_pd->init(engine) != success) {
             delete _pd;
             return unimplemented;
@@ -329,6 +344,11 @@ protected:
     }
 
     friend struct dnnl::impl::impl_list_item_t;
+
+private:
+    // Queried from the op descriptor, since some implementations define
+    // weights_md() through nested primitive descriptors created in init()
+    static bool has_sparse_weights(const op_desc_t *adesc);
 };
 
 } // namespace impl
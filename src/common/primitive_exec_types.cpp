@@ -49,6 +49,10 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                 extra_inputs += (arg == DNNL_ARG_ATTR_OUTPUT_SCALES)
                         || (arg & DNNL_ARG_ATTR_ZERO_POINTS);
                 extra_inputs += (arg & DNNL_ARG_ATTR_INPUT_SCALES) != 0;
+                extra_inputs += utils::one_of(arg,
+                        DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES,
+                        DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS,
+                        DNNL_ARG_ATTR_SOFTMAX_MASK);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 if (args.count(arg) != 0) return invalid_arguments;
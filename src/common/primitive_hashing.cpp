@@ -102,6 +102,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(softmax_v2)
@@ -177,6 +178,14 @@ size_t get_md_hash(const memory_desc_t &md) {
                     seed, md.format_desc.rnn_packed_desc.offset_compensation);
             seed = hash_combine(seed, md.format_desc.rnn_packed_desc.size);
             break;
+        case format_kind::sparse:
+            seed = hash_combine(seed,
+                    static_cast<size_t>(md.format_desc.sparse_desc.encoding));
+            seed = hash_combine(seed, md.format_desc.sparse_desc.row_dim);
+            seed = get_array_hash(
+                    seed, md.format_desc.sparse_desc.block_dims, 2);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.size);
+            break;
         default: assert(!"unknown format_kind");
     }
 
@@ -208,6 +217,10 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_mode_));
+    // accuracy_mode
+    seed = hash_combine(seed, static_cast<size_t>(attr.accuracy_mode_));
+    // number of threads
+    seed = hash_combine(seed, attr.nthr_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -239,6 +252,15 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             // zero_points: zero_points[:]
             seed = get_array_hash(seed, zero_points, count);
         }
+    // weights decompression
+    if (!attr.wei_decomp_.has_default_values()) {
+        seed = hash_combine(seed, attr.wei_decomp_.group_size_);
+        seed = hash_combine(seed, attr.wei_decomp_.with_zero_points_);
+    }
+    // softmax mask
+    if (!attr.softmax_mask_.has_default_values()) {
+        seed = hash_combine(seed, attr.softmax_mask_.mask_);
+    }
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -540,6 +562,24 @@ size_t get_desc_hash(const reduction_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const sdpa_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.mask_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Scale
+    seed = hash_combine(seed, desc.scale);
+    // Combined hash for sdpa desc
+    return seed;
+}
+
 size_t get_desc_hash(const reorder_desc_t &desc) {
     size_t seed = 0;
     // Kinds
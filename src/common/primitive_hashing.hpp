@@ -94,6 +94,7 @@ size_t get_desc_hash(const reduction_desc_t &desc);
 size_t get_desc_hash(const reorder_desc_t &desc);
 size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
+size_t get_desc_hash(const sdpa_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const softmax_v2_desc_t &desc);
@@ -184,6 +185,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(sdpa)
             CASE(shuffle)
             CASE(softmax)
             CASE(softmax_v2)
@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_attr.hpp"
@@ -76,6 +77,11 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         // The state is equal to the state of the iterator that end() returns.
         if (idx_ == last_idx_) return *this;
 
+        // Implementations choose their threading for the number of threads
+        // the primitive is going to be executed with. The number is also a
+        // part of the cache key.
+        dnnl::impl::scoped_max_threads_t scoped_nthr(attr_.nthr_);
+
         offset_++;
         pd_.reset();
 
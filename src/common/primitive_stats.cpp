@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <limits>
+
+#include "memory.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "nstl.hpp"
+#include "primitive_stats.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+constexpr uint64_t no_min_ns = std::numeric_limits<uint64_t>::max();
+
+void atomic_min(std::atomic<uint64_t> &a, uint64_t v) {
+    uint64_t cur = a.load(std::memory_order_relaxed);
+    while (v < cur
+            && !a.compare_exchange_weak(cur, v, std::memory_order_relaxed))
+        ;
+}
+
+void atomic_max(std::atomic<uint64_t> &a, uint64_t v) {
+    uint64_t cur = a.load(std::memory_order_relaxed);
+    while (v > cur
+            && !a.compare_exchange_weak(cur, v, std::memory_order_relaxed))
+        ;
+}
+} // namespace
+
+uint64_t primitive_stats_t::now_ns() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(
+            steady_clock::now().time_since_epoch())
+            .count();
+}
+
+uint64_t primitive_stats_t::get_bytes(const exec_args_t &args) {
+    uint64_t bytes = 0;
+    for (const auto &arg : args) {
+        const memory_t *mem = arg.second.mem;
+        if (mem) bytes += memory_desc_wrapper(*mem->md()).size();
+    }
+    return bytes;
+}
+
+int primitive_stats_t::get_slot_idx() {
+    static std::atomic<int> next_slot_idx {0};
+    static thread_local const int slot_idx = next_slot_idx++ % nslots;
+    return slot_idx;
+}
+
+void primitive_stats_t::record(uint64_t duration_ns, uint64_t bytes) {
+    auto &slot = slots_[get_slot_idx()];
+    slot.ncalls.fetch_add(1, std::memory_order_relaxed);
+    slot.total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+    slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    atomic_min(slot.min_ns, duration_ns);
+    atomic_max(slot.max_ns, duration_ns);
+}
+
+void primitive_stats_t::get(dnnl_primitive_stats_t *stats, bool reset) {
+    const auto read = [reset](std::atomic<uint64_t> &a, uint64_t init) {
+        return reset ? a.exchange(init, std::memory_order_relaxed)
+                     : a.load(std::memory_order_relaxed);
+    };
+
+    uint64_t ncalls = 0, total_ns = 0, min_ns = no_min_ns, max_ns = 0,
+             bytes = 0;
+    for (auto &slot : slots_) {
+        ncalls += read(slot.ncalls, 0);
+        total_ns += read(slot.total_ns, 0);
+        min_ns = nstl::min(min_ns, read(slot.min_ns, no_min_ns));
+        max_ns = nstl::max(max_ns, read(slot.max_ns, 0));
+        bytes += read(slot.bytes, 0);
+    }
+
+    if (!stats) return;
+    stats->ncalls = ncalls;
+    stats->total_ms = 1e-6 * total_ns;
+    stats->min_ms = ncalls ? 1e-6 * min_ns : 0.;
+    stats->max_ms = 1e-6 * max_ns;
+    stats->bytes = bytes;
+}
+
+void primitive_stats_t::reset() {
+    for (auto &slot : slots_) {
+        slot.ncalls.store(0, std::memory_order_relaxed);
+        slot.total_ns.store(0, std::memory_order_relaxed);
+        slot.min_ns.store(no_min_ns, std::memory_order_relaxed);
+        slot.max_ns.store(0, std::memory_order_relaxed);
+        slot.bytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace impl
+} // namespace dnnl
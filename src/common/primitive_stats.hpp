@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_STATS_HPP
+#define COMMON_PRIMITIVE_STATS_HPP
+
+#include <atomic>
+#include <stdint.h>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "primitive_exec_types.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Execution counters of a primitive.
+//
+// The counters are spread over a fixed number of cache line aligned slots,
+// every thread always updates the same slot. Updates are relaxed atomic
+// operations, so concurrent executions of a primitive neither take a lock
+// nor keep bouncing a single cache line between cores. Reading sums the
+// slots up; a reset that races with an execution may lose its update.
+struct primitive_stats_t {
+    primitive_stats_t() { reset(); }
+
+    // Returns the current time stamp in nanoseconds
+    static uint64_t now_ns();
+
+    // Returns the total size of the memory objects passed to an execution
+    static uint64_t get_bytes(const exec_args_t &args);
+
+    void record(uint64_t duration_ns, uint64_t bytes);
+    void get(dnnl_primitive_stats_t *stats, bool reset);
+    void reset();
+
+private:
+    static constexpr int nslots = 16;
+
+    struct alignas(64) slot_t {
+        std::atomic<uint64_t> ncalls;
+        std::atomic<uint64_t> total_ns;
+        std::atomic<uint64_t> min_ns;
+        std::atomic<uint64_t> max_ns;
+        std::atomic<uint64_t> bytes;
+    };
+
+    static int get_slot_idx();
+
+    slot_t slots_[nslots];
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_stats_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -18,6 +18,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -83,6 +84,7 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
 
     dnnl_reorder_desc_t desc = {primitive_kind::reorder, src_md, dst_md, s_ek,
             d_ek, is_cross_engine};
+    scoped_max_threads_t scoped_nthr(attr->nthr_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {});
     pd = primitive_cache().get_pd(key);
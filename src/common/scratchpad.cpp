@@ -175,5 +175,54 @@ scratchpad_t *create_scratchpad(
 #endif
 }
 
+std::unique_ptr<memory_storage_t> stream_scratchpad_t::acquire(
+        engine_t *engine, size_t &size) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (mem_storage_ && size_ >= size) {
+            size = size_;
+            size_ = 0;
+            return std::move(mem_storage_);
+        }
+        // Release a smaller buffer first to keep the peak footprint low
+        mem_storage_.reset();
+        size_ = 0;
+    }
+    return std::unique_ptr<memory_storage_t>(
+            create_scratchpad_memory_storage(engine, size));
+}
+
+void stream_scratchpad_t::release(
+        std::unique_ptr<memory_storage_t> mem_storage, size_t size) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (size <= size_) return;
+    mem_storage_ = std::move(mem_storage);
+    size_ = size;
+}
+
+status_t check_scratchpad_allocation(engine_t *engine, size_t size) {
+    std::unique_ptr<memory_storage_t> mem_storage(
+            create_scratchpad_memory_storage(engine, size));
+    return mem_storage ? status::success : status::out_of_memory;
+}
+
+bool use_stream_scratchpad(engine_t *engine, bool use_global_scratchpad) {
+    // Asynchronous threadpools may still run a primitive when the next one
+    // is submitted, so the stream scratchpad cannot be reused there.
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    UNUSED(engine);
+    UNUSED(use_global_scratchpad);
+    return false;
+#else
+#ifndef DNNL_ENABLE_CONCURRENT_EXEC
+    if (use_global_scratchpad) return false;
+#else
+    UNUSED(use_global_scratchpad);
+#endif
+    return engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind());
+#endif
+}
+
 } // namespace impl
 } // namespace dnnl
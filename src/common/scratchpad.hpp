@@ -17,6 +17,9 @@
 #ifndef COMMON_SCRATCHPAD_HPP
 #define COMMON_SCRATCHPAD_HPP
 
+#include <memory>
+#include <mutex>
+
 #include "c_types_map.hpp"
 #include "memory_storage.hpp"
 #include "utils.hpp"
@@ -33,6 +36,39 @@ struct scratchpad_t {
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+/*
+  Scratchpad shared by the primitives executed on one stream. An execution
+  takes the buffer for its duration and returns it afterwards, so the mutex
+  is held only while the buffer is taken, grown or returned. Executions
+  submitted to the stream concurrently from several threads get their own
+  buffers, and the largest returned one is kept for the next executions.
+*/
+struct stream_scratchpad_t {
+    stream_scratchpad_t() = default;
+
+    // Returns a storage of at least `size` bytes or nullptr on failure.
+    // `size` is updated with the size of the returned storage.
+    std::unique_ptr<memory_storage_t> acquire(engine_t *engine, size_t &size);
+    // Gives back a storage of `size` bytes obtained with acquire()
+    void release(std::unique_ptr<memory_storage_t> mem_storage, size_t size);
+
+private:
+    std::unique_ptr<memory_storage_t> mem_storage_;
+    size_t size_ = 0;
+    std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(stream_scratchpad_t);
+};
+
+// Checks that a scratchpad of `size` bytes can be allocated on `engine`.
+// Primitives taking the scratchpad from the stream call it at creation to
+// report a lack of memory there rather than at execution.
+status_t check_scratchpad_allocation(engine_t *engine, size_t size);
+
+// Returns true if the library scratchpad of a primitive created on `engine`
+// can be taken from the stream scratchpad instead of a private allocation.
+bool use_stream_scratchpad(engine_t *engine, bool use_global_scratchpad);
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+
+dnnl_status_t dnnl_sdpa_forward_desc_init(dnnl_sdpa_desc_t *desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *q_desc,
+        const dnnl_memory_desc_t *k_desc, const dnnl_memory_desc_t *v_desc,
+        const dnnl_memory_desc_t *mask_desc,
+        const dnnl_memory_desc_t *dst_desc, float scale,
+        dnnl_sdpa_mask_kind_t mask_kind) {
+    const bool with_mask_buffer = mask_kind == sdpa_mask_kind::buffer;
+
+    bool args_ok = !any_null(desc, q_desc, k_desc, v_desc, dst_desc)
+            && prop_kind == prop_kind::forward_inference
+            && one_of(mask_kind, sdpa_mask_kind::none, sdpa_mask_kind::buffer,
+                    sdpa_mask_kind::causal)
+            && IMPLICATION(with_mask_buffer, mask_desc != nullptr)
+            && IMPLICATION(!with_mask_buffer && mask_desc != nullptr,
+                    memory_desc_wrapper(mask_desc).is_zero());
+    if (!args_ok) return invalid_arguments;
+
+    const memory_desc_t *srcs[] = {q_desc, k_desc, v_desc};
+    for (auto md : srcs)
+        if (memory_desc_wrapper(md).format_any()) return invalid_arguments;
+    if (with_mask_buffer && memory_desc_wrapper(mask_desc).format_any())
+        return invalid_arguments;
+
+    const int ndims = q_desc->ndims;
+    if (ndims < 2 || k_desc->ndims != ndims || v_desc->ndims != ndims
+            || dst_desc->ndims != ndims
+            || (with_mask_buffer && mask_desc->ndims != ndims))
+        return invalid_arguments;
+
+    for (int d = 0; d < ndims - 2; d++) {
+        const dim_t b = q_desc->dims[d];
+        if (k_desc->dims[d] != b || v_desc->dims[d] != b
+                || dst_desc->dims[d] != b)
+            return invalid_arguments;
+        // Mask may be broadcast along batch and heads dimensions
+        if (with_mask_buffer && !one_of(mask_desc->dims[d], 1, b))
+            return invalid_arguments;
+    }
+
+    const dim_t Sq = q_desc->dims[ndims - 2];
+    const dim_t Sk = k_desc->dims[ndims - 2];
+    const dim_t D = q_desc->dims[ndims - 1];
+    const dim_t Dv = v_desc->dims[ndims - 1];
+    const bool dims_ok = k_desc->dims[ndims - 1] == D
+            && v_desc->dims[ndims - 2] == Sk && dst_desc->dims[ndims - 2] == Sq
+            && dst_desc->dims[ndims - 1] == Dv
+            && IMPLICATION(with_mask_buffer,
+                    mask_desc->dims[ndims - 2] == Sq
+                            && mask_desc->dims[ndims - 1] == Sk);
+    if (!dims_ok) return invalid_arguments;
+
+    auto sd = sdpa_desc_t();
+    sd.primitive_kind = primitive_kind::sdpa;
+    sd.prop_kind = prop_kind;
+    sd.q_desc = *q_desc;
+    sd.k_desc = *k_desc;
+    sd.v_desc = *v_desc;
+    sd.mask_desc = with_mask_buffer ? *mask_desc : types::zero_md();
+    sd.dst_desc = *dst_desc;
+    sd.scale = scale;
+    sd.mask_kind = mask_kind;
+
+    *desc = sd;
+    return success;
+}
@@ -49,6 +49,7 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(softmax_v2)
@@ -108,6 +109,12 @@ void serialize_md(serialization_stream_t &sstream, const memory_desc_t &md) {
             sstream.write(&md.format_desc.rnn_packed_desc.offset_compensation);
             sstream.write(&md.format_desc.rnn_packed_desc.size);
             break;
+        case format_kind::sparse:
+            sstream.write(&md.format_desc.sparse_desc.encoding);
+            sstream.write(&md.format_desc.sparse_desc.row_dim);
+            sstream.write(md.format_desc.sparse_desc.block_dims, 2);
+            sstream.write(&md.format_desc.sparse_desc.size);
+            break;
         default: assert(!"unknown format_kind");
     }
 
@@ -136,6 +143,10 @@ void serialize_attr(
     sstream.write(&attr.scratchpad_mode_);
     // fpmath_mode
     sstream.write(&attr.fpmath_mode_);
+    // accuracy_mode
+    sstream.write(&attr.accuracy_mode_);
+    // number of threads
+    sstream.write(&attr.nthr_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -166,6 +177,15 @@ void serialize_attr(
             // zero_points: zero_points[:]
             sstream.write(zero_points, count);
         }
+    // weights decompression
+    if (!attr.wei_decomp_.has_default_values()) {
+        sstream.write(&attr.wei_decomp_.group_size_);
+        sstream.write(&attr.wei_decomp_.with_zero_points_);
+    }
+    // softmax mask
+    if (!attr.softmax_mask_.has_default_values()) {
+        sstream.write(&attr.softmax_mask_.mask_);
+    }
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -425,6 +445,21 @@ void serialize_desc(
     sstream.write(&desc.eps);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.prop_kind);
+    sstream.write(&desc.mask_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.q_desc);
+    serialize_md(sstream, desc.k_desc);
+    serialize_md(sstream, desc.v_desc);
+    serialize_md(sstream, desc.mask_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Scale
+    sstream.write(&desc.scale);
+}
+
 void serialize_desc(
         serialization_stream_t &sstream, const reorder_desc_t &desc) {
     // Kinds
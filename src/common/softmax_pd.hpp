@@ -160,6 +160,7 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0);
+            case DNNL_ARG_ATTR_SOFTMAX_MASK: return &softmax_mask_md_;
             default: return softmax_pd_t::arg_md(arg);
         }
     }
@@ -171,17 +172,29 @@ struct softmax_fwd_pd_t : public softmax_pd_t {
         return index == 0 ? &dst_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 1; }
+    int n_inputs() const override { return 1 + n_binary_po_inputs(); }
     int n_outputs() const override {
         return 1 + (!types::is_zero_md(workspace_md()));
     }
 
+    bool with_softmax_mask() const {
+        return !attr()->softmax_mask_.has_default_values();
+    }
+    const memory_desc_t *softmax_mask_md() const { return &softmax_mask_md_; }
+
 protected:
     memory_desc_t src_md_;
+    // Dense row-major f32 descriptor of the softmax mask, zero if the mask
+    // is not set or is invalid
+    memory_desc_t softmax_mask_md_;
 
     softmax_fwd_pd_t(const softmax_v2_desc_t *adesc,
             const primitive_attr_t *attr, const softmax_fwd_pd_t *hint_fwd_pd)
-        : softmax_pd_t(adesc, attr, hint_fwd_pd), src_md_(desc_.src_desc) {}
+        : softmax_pd_t(adesc, attr, hint_fwd_pd)
+        , src_md_(desc_.src_desc)
+        , softmax_mask_md_(types::zero_md()) {
+        init_softmax_mask_md();
+    }
 
     status_t set_default_formats() {
         if (dst_md()->format_kind != format_kind::any) return status::success;
@@ -199,6 +212,49 @@ protected:
                 attr()->output_scales_.has_default_values());
         return ok && oscale.mask_ == 0;
     }
+
+    bool attr_post_ops_ok() const {
+        const auto &po = attr()->post_ops_;
+        bool ok = IMPLICATION(desc()->primitive_kind != base_pkind,
+                po.has_default_values());
+        for (int i = 0; i < po.len(); i++)
+            ok = ok && (po.entry_[i].is_eltwise() || po.entry_[i].is_binary());
+        return ok;
+    }
+
+    // Only a common source scale is supported. It is applied before the
+    // softmax mask.
+    bool attr_scales_ok() const {
+        const auto &scales = attr()->scales_;
+        bool ok = IMPLICATION(desc()->primitive_kind != base_pkind,
+                scales.has_default_values());
+        for (const auto &s : scales.scales_)
+            ok = ok
+                    && IMPLICATION(!s.second.has_default_values(),
+                            s.first == DNNL_ARG_SRC && s.second.mask_ == 0);
+        return ok;
+    }
+
+    bool attr_softmax_mask_ok() const {
+        return IMPLICATION(with_softmax_mask(),
+                desc()->primitive_kind == base_pkind
+                        && !types::is_zero_md(&softmax_mask_md_));
+    }
+
+private:
+    void init_softmax_mask_md() {
+        const int mask = attr()->softmax_mask_.mask_;
+        const int nd = src_md_.ndims;
+        if (mask < 0 || (mask >> nd) != 0) return;
+
+        memory_desc_t md = types::zero_md();
+        md.ndims = nd;
+        md.data_type = data_type::f32;
+        for (int d = 0; d < nd; d++)
+            md.dims[d] = (mask & (1 << d)) ? src_md_.dims[d] : 1;
+        if (memory_desc_init_by_strides(md, nullptr) == status::success)
+            softmax_mask_md_ = md;
+    }
 };
 
 struct softmax_bwd_pd_t : public softmax_pd_t {
@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "scratchpad.hpp"
 #include "utils.hpp"
 
 struct dnnl_stream : public dnnl::impl::c_compatible {
@@ -53,6 +54,9 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
+    /** returns scratchpad shared by primitives executed on the stream */
+    dnnl::impl::stream_scratchpad_t &scratchpad() { return scratchpad_; }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl_stream(dnnl::impl::engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -74,6 +78,7 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
 protected:
     dnnl::impl::engine_t *engine_;
     unsigned flags_;
+    dnnl::impl::stream_scratchpad_t scratchpad_;
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::threadpool_interop::threadpool_iface *threadpool_ = nullptr;
 #endif
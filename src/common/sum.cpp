@@ -19,6 +19,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "engine.hpp"
 #include "impl_list_item.hpp"
 #include "primitive_cache.hpp"
@@ -78,6 +79,7 @@ status_t sum_primitive_desc_create(primitive_desc_iface_t **sum_pd_iface,
     }
 
     dnnl_sum_desc_t desc = {primitive_kind::sum, dst_md, n, scales, src_mds};
+    scoped_max_threads_t scoped_nthr(attr->nthr_);
     primitive_hashing::key_t key(
             engine, reinterpret_cast<op_desc_t *>(&desc), attr, 0, {});
     auto pd = primitive_cache().get_pd(key);
@@ -89,6 +89,9 @@ inline size_t data_type_size(data_type_t data_type) {
         case s32: return sizeof(prec_traits<s32>::type);
         case s8: return sizeof(prec_traits<s8>::type);
         case u8: return sizeof(prec_traits<u8>::type);
+        // Sub-byte types are packed, the size is the one of the container
+        case s4:
+        case u4: return sizeof(uint8_t);
         case data_type::undef:
         default: assert(!"unknown data_type");
     }
@@ -203,6 +206,13 @@ inline bool wino_desc_is_equal(const wino_desc_t &lhs, const wino_desc_t &rhs) {
             && lhs.r == rhs.r;
 }
 
+inline bool sparse_desc_is_equal(
+        const sparse_desc_t &lhs, const sparse_desc_t &rhs) {
+    return lhs.encoding == rhs.encoding && lhs.row_dim == rhs.row_dim
+            && utils::array_cmp(lhs.block_dims, rhs.block_dims, 2)
+            && lhs.size == rhs.size;
+}
+
 inline bool rnn_packed_desc_is_equal(
         const rnn_packed_desc_t &lhs, const rnn_packed_desc_t &rhs) {
     bool ok = true && lhs.format == rhs.format && lhs.ldb == rhs.ldb
@@ -256,6 +266,8 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
         return f16;
     if (everyone_is(f32, src_dt, wei_dt)) return f32;
     if (everyone_is(f64, src_dt, wei_dt)) return f64;
+    // f16 and 4-bit weights are decompressed to f32 before the accumulation
+    if (src_dt == f32 && one_of(wei_dt, f16, s4, u4)) return f32;
 
     if (one_of(prop_kind, forward_training, forward_inference)) {
         if ((src_dt == u8 || src_dt == s8) && wei_dt == s8) return s32;
@@ -297,6 +309,9 @@ inline bool operator==(const memory_desc_t &lhs, const memory_desc_t &rhs) {
     else if (lhs.format_kind == format_kind::rnn_packed)
         return types::rnn_packed_desc_is_equal(lhs.format_desc.rnn_packed_desc,
                 rhs.format_desc.rnn_packed_desc);
+    else if (lhs.format_kind == format_kind::sparse)
+        return types::sparse_desc_is_equal(
+                lhs.format_desc.sparse_desc, rhs.format_desc.sparse_desc);
     return true;
 }
 
@@ -493,6 +508,19 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(prop_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(mask_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(scale)
+            && COMPARE_DESC_MEMBERS(mask_kind);
+    return ret;
+}
+
 inline bool operator==(const reorder_desc_t &lhs, const reorder_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(src_md)
@@ -840,7 +868,8 @@ inline bool memory_desc_sanity_check(int ndims, const dims_t dims,
     if (ndims == 0) return true;
 
     bool ok = dims != nullptr && 0 < ndims && ndims <= DNNL_MAX_NDIMS
-            && utils::one_of(data_type, f16, bf16, f32, f64, s32, s8, u8);
+            && utils::one_of(
+                    data_type, f16, bf16, f32, f64, s32, s8, u8, s4, u4);
     if (!ok) return false;
 
     bool has_runtime_dims = false;
@@ -889,6 +918,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
             CASE_OP_DESC(reduction);
             CASE_OP_DESC(resampling);
             CASE_OP_DESC(rnn);
+            CASE_OP_DESC(sdpa);
             CASE_OP_DESC(shuffle);
         case primitive_kind::logsoftmax:
         case primitive_kind::softmax: {
@@ -48,6 +48,7 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
@@ -297,6 +298,11 @@ std::string md2fmt_str(const dnnl_memory_desc_t *md) {
     ss << (offset0 ? "0" : "") << ":" << mdw.format_kind() << ":";
 
     if (mdw.is_blocking_desc()) ss << md2fmt_tag_str(md);
+    if (mdw.is_sparse_desc()) {
+        const auto &sd = mdw.sparse_desc();
+        ss << "bcsr_" << sd.block_dims[0] << "x" << sd.block_dims[1] << "_r"
+           << sd.row_dim;
+    }
 
     ss << mdw.extra();
 
@@ -360,8 +366,8 @@ std::ostream &operator<<(std::ostream &ss, const scales_t &oscale) {
 }
 
 std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
-    // scratchpad and fpmath mode are not a part of
-    // has_default_values(). Check them first.
+    // scratchpad, fpmath mode, accuracy mode and number of threads are not a
+    // part of has_default_values(). Check them first.
     const scratchpad_mode_t &spm = attr->scratchpad_mode_;
     if (spm != scratchpad_mode_t::dnnl_scratchpad_mode_library) {
         ss << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm) << " ";
@@ -370,6 +376,9 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
     if (fpm != fpmath_mode_t::dnnl_fpmath_mode_strict) {
         ss << "attr-fpmath:" << dnnl_fpmath_mode2str(fpm) << " ";
     }
+    if (attr->accuracy_mode_ == accuracy_mode::fast)
+        ss << "attr-accuracy:fast ";
+    if (attr->nthr_ > 0) { ss << "attr-nthr:" << attr->nthr_ << " "; }
 
     if (attr->has_default_values()) return ss;
 
@@ -415,6 +424,17 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << " ";
     }
 
+    const wei_decomp_t &wd = attr->wei_decomp_;
+    if (!wd.has_default_values()) {
+        ss << "attr-wei-decomp:" << wd.group_size_;
+        if (wd.with_zero_points_) ss << ":zp";
+        ss << " ";
+    }
+
+    const softmax_mask_t &sm = attr->softmax_mask_;
+    if (!sm.has_default_values())
+        ss << "attr-softmax-mask:" << sm.mask_ << " ";
+
     const post_ops_t &po = attr->post_ops_;
     if (!po.has_default_values()) {
         std::string delim = empty_delim;
@@ -787,6 +807,35 @@ static std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto q_md = pd->src_md(0);
+    auto k_md = pd->src_md(1);
+    auto v_md = pd->src_md(2);
+    auto msk_md = pd->src_md(3);
+    auto dst_md = pd->dst_md();
+
+    ss << "q_" << q_md << " k_" << k_md << " v_" << v_md;
+    if (pd->with_mask_buffer()) ss << " msk_" << msk_md;
+    ss << " dst_" << dst_md << ",";
+
+    ss << pd->attr() << ",";
+    const char *mask_str = "none";
+    if (pd->with_mask_buffer())
+        mask_str = "buffer";
+    else if (pd->with_causal_mask())
+        mask_str = "causal";
+    ss << "mask:" << mask_str << " scale:" << pd->desc()->scale << ",";
+    ss << md2dim_str(q_md) << ":" << md2dim_str(k_md) << ":"
+       << md2dim_str(v_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_reorder(const engine_t *e, pd_t *pd) {
     std::stringstream ss;
@@ -987,6 +1036,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             case primitive_kind::softmax_v2:
             CASE(softmax);
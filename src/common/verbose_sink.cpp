@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cinttypes>
+#include <cstdlib>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "math_utils.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+#include "verbose_sink.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#if !defined(DISABLE_VERBOSE)
+namespace {
+
+// Verbose strings longer than that are truncated
+constexpr size_t info_capacity = 384;
+
+struct event_t {
+    double start_ms;
+    double duration_ms;
+    char info[info_capacity];
+};
+
+// A single producer (the thread executing primitives) single consumer (the
+// writer thread) queue of events. The capacity must be a power of 2.
+struct ring_t {
+    ring_t(size_t capacity)
+        : capacity_(capacity), events_(new event_t[capacity]) {
+        assert(math::is_pow2(capacity));
+    }
+
+    bool push(double start_ms, double duration_ms, const char *info) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail == capacity_) return false;
+
+        event_t &e = events_[head & (capacity_ - 1)];
+        e.start_ms = start_ms;
+        e.duration_ms = duration_ms;
+        strncpy(e.info, info, info_capacity - 1);
+        e.info[info_capacity - 1] = '\0';
+
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename F>
+    void drain(const F &f) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t head = head_.load(std::memory_order_acquire);
+        for (; tail != head; ++tail)
+            f(events_[tail & (capacity_ - 1)]);
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire)
+                == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    alignas(64) std::atomic<size_t> head_ {0};
+    alignas(64) std::atomic<size_t> tail_ {0};
+    const size_t capacity_;
+    std::unique_ptr<event_t[]> events_;
+};
+
+// Unlike getenv_string_user() keeps the case and the full length, which is
+// required for file paths
+std::string getenv_raw_user(const char *name) {
+    for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+        const std::string name_str = std::string(prefix) + name;
+        const int len = getenv(name_str.c_str(), nullptr, 0);
+        if (len <= 0) continue;
+        std::vector<char> value(len + 1);
+        if (getenv(name_str.c_str(), value.data(), len + 1) > 0)
+            return std::string(value.data());
+    }
+    return std::string();
+}
+
+struct sink_t {
+    sink_t() {
+        const std::string path = getenv_raw_user("VERBOSE_SINK");
+        if (path.empty()) return;
+
+        is_csv_ = getenv_string_user("VERBOSE_SINK_FORMAT") == "csv";
+        sampling_ = nstl::max(1, getenv_int_user("VERBOSE_SINK_SAMPLING", 1));
+        init_kinds_mask(getenv_raw_user("VERBOSE_SINK_KINDS"));
+        // Round the number of events per thread up to a power of 2
+        const int ring_size = nstl::max(
+                1, getenv_int_user("VERBOSE_SINK_RING_SIZE", 128));
+        while (ring_capacity_ < (size_t)ring_size)
+            ring_capacity_ *= 2;
+
+        file_ = impl::fopen(path.c_str(), "w");
+        if (!file_) return;
+
+        if (is_csv_)
+            fprintf(file_,
+                    "timestamp,engine,primitive,implementation,prop_kind,"
+                    "memory_descriptors,attributes,auxiliary,problem_desc,"
+                    "exec_time\n");
+
+        writer_ = std::thread([this]() { writer_loop(); });
+        enabled_ = true;
+    }
+
+    // Stops the writer thread and writes the remaining events. It is called
+    // at exit, while the threads of the process are still running, rather
+    // than from a destructor of a static object.
+    void shutdown() {
+        if (!enabled_.exchange(false)) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_one();
+        writer_.join();
+
+        drain();
+        const uint64_t dropped = dropped_.load();
+        if (dropped > 0) {
+            if (is_csv_)
+                fprintf(file_, "# dropped_events:%" PRIu64 "\n", dropped);
+            else
+                fprintf(file_, "{\"dropped_events\":%" PRIu64 "}\n", dropped);
+        }
+        fclose(file_);
+        file_ = nullptr;
+    }
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void record(primitive_kind_t kind, const char *info, uint64_t duration_ns) {
+        if (!enabled() || !kind_enabled(kind)) return;
+
+        static thread_local uint64_t nexecs = 0;
+        if (nexecs++ % sampling_ != 0) return;
+
+        const double duration_ms = 1e-6 * duration_ns;
+        const double start_ms = get_msec() - duration_ms;
+        if (!get_thread_ring()->push(start_ms, duration_ms, info))
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<bool> enabled_ {false};
+    bool is_csv_ = false;
+    int sampling_ = 1;
+    size_t ring_capacity_ = 1;
+    // A bit per primitive kind, all kinds are recorded by default
+    uint64_t kinds_mask_ = ~(uint64_t)0;
+
+    FILE *file_ = nullptr;
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+
+    // Rings of all the threads that recorded an event. A ring outlives its
+    // thread until the writer drains it.
+    std::vector<std::shared_ptr<ring_t>> rings_;
+    std::mutex rings_mutex_;
+    std::atomic<uint64_t> dropped_ {0};
+
+    void init_kinds_mask(const std::string &kinds) {
+        if (kinds.empty()) return;
+
+        kinds_mask_ = 0;
+        size_t pos = 0;
+        while (pos <= kinds.size()) {
+            size_t end = kinds.find(',', pos);
+            if (end == std::string::npos) end = kinds.size();
+            std::string name = kinds.substr(pos, end - pos);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            for (int k = 0; k < 64; k++) {
+                const auto pkind = static_cast<dnnl_primitive_kind_t>(k);
+                if (name == dnnl_prim_kind2str(pkind))
+                    kinds_mask_ |= (uint64_t)1 << k;
+            }
+            pos = end + 1;
+        }
+    }
+
+    bool kind_enabled(primitive_kind_t kind) const {
+        if (kinds_mask_ == ~(uint64_t)0) return true;
+        const int k = static_cast<int>(kind);
+        return k >= 0 && k < 64 && (kinds_mask_ & ((uint64_t)1 << k));
+    }
+
+    ring_t *get_thread_ring() {
+        static thread_local std::shared_ptr<ring_t> ring;
+        if (!ring) {
+            ring = std::make_shared<ring_t>(ring_capacity_);
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings_.push_back(ring);
+        }
+        return ring.get();
+    }
+
+    void write_event(const event_t &e) {
+        const std::string line = verbose_sink_format_event(
+                is_csv_, e.start_ms, e.duration_ms, e.info);
+        fputs(line.c_str(), file_);
+    }
+
+    void drain() {
+        std::vector<std::shared_ptr<ring_t>> rings;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings = rings_;
+        }
+
+        for (auto &ring : rings)
+            ring->drain([this](const event_t &e) { write_event(e); });
+        fflush(file_);
+        rings.clear();
+
+        // Forget the rings of finished threads once they are drained
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+                             [](const std::shared_ptr<ring_t> &ring) {
+                                 return ring.use_count() == 1 && ring->empty();
+                             }),
+                rings_.end());
+    }
+
+    void writer_loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            cv_.wait_for(lock, std::chrono::milliseconds(10));
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sink_t);
+};
+
+sink_t &sink() {
+    // The sink is never destroyed: the writer thread is stopped by an exit
+    // handler, and primitives executed later, e.g. from destructors of other
+    // static objects, are not recorded.
+    static sink_t *s = []() {
+        auto *s = new sink_t();
+        if (s->enabled()) std::atexit([]() { sink().shutdown(); });
+        return s;
+    }();
+    return *s;
+}
+
+} // namespace
+#endif
+
+std::string verbose_sink_format_event(
+        bool is_csv, double start_ms, double duration_ms, const char *info) {
+    // The verbose string fields, the last one takes the remainder
+    static const char *fields[] = {"engine", "primitive", "implementation",
+            "prop_kind", "memory_descriptors", "attributes", "auxiliary",
+            "problem_desc"};
+    static constexpr int nfields = sizeof(fields) / sizeof(fields[0]);
+
+    std::string line;
+    char buf[64];
+    snprintf(buf, sizeof(buf), is_csv ? "%.3f" : "{\"timestamp\":%.3f",
+            start_ms);
+    line += buf;
+
+    // CSV rows have all the columns, JSON objects skip the missing fields
+    const char *p = info;
+    for (int i = 0; i < nfields && (is_csv || *p); i++) {
+        // CSV fields are quoted with the quotes doubled (RFC 4180), JSON
+        // strings escape quotes and backslashes
+        line += is_csv ? ",\"" : std::string(",\"") + fields[i] + "\":\"";
+        for (; *p && (*p != ',' || i == nfields - 1); p++) {
+            if (*p == '"')
+                line += is_csv ? "\"\"" : "\\\"";
+            else if (*p == '\\' && !is_csv)
+                line += "\\\\";
+            else if (static_cast<unsigned char>(*p) < 0x20)
+                line += ' ';
+            else
+                line += *p;
+        }
+        if (*p) p++;
+        line += '"';
+    }
+
+    snprintf(buf, sizeof(buf), is_csv ? ",%g\n" : ",\"exec_time\":%g}\n",
+            duration_ms);
+    line += buf;
+    return line;
+}
+
+bool verbose_sink_enabled() {
+#if defined(DISABLE_VERBOSE)
+    return false;
+#else
+    return sink().enabled();
+#endif
+}
+
+void verbose_sink_record(
+        primitive_kind_t kind, const char *info, uint64_t duration_ns) {
+#if !defined(DISABLE_VERBOSE)
+    sink().record(kind, info, duration_ns);
+#endif
+}
+
+} // namespace impl
+} // namespace dnnl
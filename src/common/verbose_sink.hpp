@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_VERBOSE_SINK_HPP
+#define COMMON_VERBOSE_SINK_HPP
+
+#include <stdint.h>
+#include <string>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Structured verbose sink.
+//
+// Unlike the verbose mode, which prints every event to stdout from the
+// executing thread, the sink is designed to stay enabled under load:
+// executions are recorded into per-thread lock-free ring buffers, and a
+// background thread drains them into a file in JSON Lines or CSV format.
+//
+// The sink is configured with environment variables (both ONEDNN_ and
+// DNNL_ prefixes are accepted):
+// - VERBOSE_SINK=<path>: enables the sink and sets the output file.
+// - VERBOSE_SINK_FORMAT=jsonl|csv: output format, JSON Lines by default.
+// - VERBOSE_SINK_SAMPLING=<N>: records one in N executions of a thread.
+// - VERBOSE_SINK_KINDS=<kind>[,<kind>...]: records only the primitives of
+//   the given kinds, named as in the verbose output (e.g. convolution).
+// - VERBOSE_SINK_RING_SIZE=<N>: number of events buffered per thread, 128 by
+//   default. The buffer of a thread is allocated on its first event.
+//
+// The writer thread is stopped and the file is closed at process exit.
+//
+// Events that don't fit into a full ring buffer are dropped, the number of
+// dropped events is reported at the end of the output.
+//
+// Exported for testing.
+bool DNNL_API verbose_sink_enabled();
+
+// Records an execution of a primitive that took duration_ns nanoseconds,
+// info is the primitive verbose string
+void verbose_sink_record(
+        primitive_kind_t kind, const char *info, uint64_t duration_ns);
+
+// Undocumented API for testing: returns the line written by the sink for an
+// event in CSV or JSON Lines format.
+std::string DNNL_API verbose_sink_format_event(
+        bool is_csv, double start_ms, double duration_ms, const char *info);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
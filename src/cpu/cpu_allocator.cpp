@@ -0,0 +1,217 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <iterator>
+
+#if defined(__linux__)
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include "common/memory_debug.hpp"
+
+#include "cpu/cpu_allocator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+#if defined(__linux__) && defined(SYS_mbind)
+// Memory policies from <linux/mempolicy.h>, libnuma is not a dependency
+enum { numa_mpol_interleave = 3, numa_mpol_local = 4 };
+
+constexpr size_t max_numa_nodes = 1024;
+constexpr size_t numa_mask_bits = 8 * sizeof(unsigned long);
+
+struct numa_node_mask_t {
+    unsigned long bits[max_numa_nodes / numa_mask_bits] = {0};
+    size_t nnodes = 0;
+};
+
+// Parses the list of online nodes, e.g. "0-3,8-11"
+numa_node_mask_t read_online_numa_nodes() {
+    numa_node_mask_t mask;
+    FILE *fp = fopen("/sys/devices/system/node/online", "r");
+    if (!fp) return mask;
+
+    unsigned first = 0, last = 0;
+    char sep = 0;
+    while (fscanf(fp, "%u", &first) == 1) {
+        last = first;
+        if (fscanf(fp, "%c", &sep) == 1 && sep == '-') {
+            if (fscanf(fp, "%u", &last) != 1) break;
+            if (fscanf(fp, "%c", &sep) != 1) sep = 0;
+        }
+        for (unsigned n = first; n <= last && n < max_numa_nodes; n++) {
+            mask.bits[n / numa_mask_bits] |= 1UL << (n % numa_mask_bits);
+            mask.nnodes++;
+        }
+        if (sep != ',') break;
+    }
+    fclose(fp);
+    return mask;
+}
+
+const numa_node_mask_t &online_numa_nodes() {
+    static const numa_node_mask_t mask = read_online_numa_nodes();
+    return mask;
+}
+
+// Best effort: a failure leaves the default policy of the calling thread
+void set_numa_policy(void *ptr, size_t size, bool interleave) {
+    const auto &nodes = online_numa_nodes();
+    if (nodes.nnodes < 2) return;
+
+    if (interleave)
+        syscall(SYS_mbind, ptr, size, numa_mpol_interleave, nodes.bits,
+                max_numa_nodes + 1, 0);
+    else
+        syscall(SYS_mbind, ptr, size, numa_mpol_local, nullptr, 0, 0);
+}
+#endif
+
+// Size classes are spaced by 1/8 of a power of two, so that a pooled buffer
+// wastes at most 12.5% of its size.
+size_t get_pool_size_class(size_t size) {
+    constexpr size_t min_size = 4096;
+    if (size <= min_size) return min_size;
+    size_t pow2 = min_size;
+    while (pow2 < size / 8)
+        pow2 *= 2;
+    return utils::rnd_up(size, pow2);
+}
+
+// ONEDNN_CPU_ALLOCATOR_POOL_CAPACITY sets the capacity of the pool in
+// megabytes, 0 disables caching of the freed buffers
+size_t get_pool_capacity() {
+    static const int capacity_mb = nstl::max(
+            0, getenv_int_user("CPU_ALLOCATOR_POOL_CAPACITY", 1024));
+    return (size_t)capacity_mb * 1024 * 1024;
+}
+
+} // namespace
+
+builtin_cpu_allocator_t::builtin_cpu_allocator_t(unsigned flags)
+    : flags_(flags), pool_capacity_(get_pool_capacity()) {}
+
+builtin_cpu_allocator_t::~builtin_cpu_allocator_t() {
+    for (auto &e : free_buffers_)
+        for (void *ptr : e.second)
+            impl::free(ptr);
+}
+
+void *builtin_cpu_allocator_t::allocate_buffer(
+        size_t size, size_t alignment) const {
+    if (memory_debug::is_mem_debug() || size < large_buffer_size)
+        return impl::malloc(size, (int)alignment);
+
+    const size_t page_size = (size_t)getpagesize();
+    if (with(dnnl_cpu_allocator_huge_pages)) {
+        alignment = nstl::max(alignment, large_buffer_size);
+        size = utils::rnd_up(size, large_buffer_size);
+    } else if (with(dnnl_cpu_allocator_numa_interleave)
+            || with(dnnl_cpu_allocator_numa_local)) {
+        // Memory policies apply to whole pages
+        alignment = nstl::max(alignment, page_size);
+        size = utils::rnd_up(size, page_size);
+    }
+
+    void *ptr = impl::malloc(size, (int)alignment);
+    if (!ptr) return nullptr;
+
+#if defined(__linux__)
+#if defined(MADV_HUGEPAGE)
+    if (with(dnnl_cpu_allocator_huge_pages)) madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+#if defined(SYS_mbind)
+    if (with(dnnl_cpu_allocator_numa_interleave))
+        set_numa_policy(ptr, size, true);
+    else if (with(dnnl_cpu_allocator_numa_local))
+        set_numa_policy(ptr, size, false);
+#endif
+#endif
+    return ptr;
+}
+
+void *builtin_cpu_allocator_t::malloc(size_t size, size_t alignment) {
+    if (!with(dnnl_cpu_allocator_pool) || memory_debug::is_mem_debug())
+        return allocate_buffer(size, alignment);
+
+    // Pooled buffers are aligned to the page size to be reusable regardless
+    // of the requested alignment
+    alignment = nstl::max(alignment, (size_t)getpagesize());
+    const size_t size_class = get_pool_size_class(size);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = free_buffers_.find(size_class);
+        if (it != free_buffers_.end() && !it->second.empty()) {
+            void *ptr = it->second.back();
+            it->second.pop_back();
+            if (it->second.empty()) free_buffers_.erase(it);
+            pooled_bytes_ -= size_class;
+            buffer_sizes_[ptr] = size_class;
+            return ptr;
+        }
+    }
+
+    void *ptr = allocate_buffer(size_class, alignment);
+    if (!ptr) return nullptr;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    buffer_sizes_[ptr] = size_class;
+    return ptr;
+}
+
+void builtin_cpu_allocator_t::free(void *ptr) {
+    if (!ptr) return;
+    if (!with(dnnl_cpu_allocator_pool) || memory_debug::is_mem_debug())
+        return impl::free(ptr);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = buffer_sizes_.find(ptr);
+    if (it == buffer_sizes_.end()) return impl::free(ptr);
+    free_buffers_[it->second].push_back(ptr);
+    pooled_bytes_ += it->second;
+    buffer_sizes_.erase(it);
+    shrink_pool();
+}
+
+void builtin_cpu_allocator_t::shrink_pool() {
+    while (pooled_bytes_ > pool_capacity_) {
+        auto it = std::prev(free_buffers_.end());
+        impl::free(it->second.back());
+        it->second.pop_back();
+        pooled_bytes_ -= it->first;
+        if (it->second.empty()) free_buffers_.erase(it);
+    }
+}
+
+const std::shared_ptr<cpu_allocator_t> &get_default_cpu_allocator() {
+    static const std::shared_ptr<cpu_allocator_t> allocator
+            = std::make_shared<builtin_cpu_allocator_t>(
+                    dnnl_cpu_allocator_flags_none);
+    return allocator;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_ALLOCATOR_HPP
+#define CPU_CPU_ALLOCATOR_HPP
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_types.h"
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Allocator of the memory storages of a CPU engine. A storage keeps the
+// allocator it was allocated with alive until the memory is released.
+struct cpu_allocator_t {
+    virtual ~cpu_allocator_t() = default;
+
+    virtual void *malloc(size_t size, size_t alignment) = 0;
+    virtual void free(void *ptr) = 0;
+};
+
+// Allocator calling the functions set with dnnl_cpu_engine_set_allocator()
+struct user_cpu_allocator_t : public cpu_allocator_t {
+    user_cpu_allocator_t(
+            dnnl_cpu_malloc_t malloc_fn, dnnl_cpu_free_t free_fn, void *data)
+        : malloc_fn_(malloc_fn), free_fn_(free_fn), user_data_(data) {}
+
+    void *malloc(size_t size, size_t alignment) override {
+        return malloc_fn_(size, alignment, user_data_);
+    }
+    void free(void *ptr) override { free_fn_(ptr, user_data_); }
+
+private:
+    dnnl_cpu_malloc_t malloc_fn_;
+    dnnl_cpu_free_t free_fn_;
+    void *user_data_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(user_cpu_allocator_t);
+};
+
+// Built-in allocator, see dnnl_cpu_allocator_flags_t for the policies.
+// Placement hints are applied to buffers of at least `large_buffer_size`
+// bytes only, smaller ones are served by impl::malloc() as is.
+// The pool keeps at most `pool_capacity` bytes of free buffers, the largest
+// ones are released first when a freed buffer does not fit.
+struct builtin_cpu_allocator_t : public cpu_allocator_t {
+    builtin_cpu_allocator_t(unsigned flags);
+    ~builtin_cpu_allocator_t() override;
+
+    void *malloc(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+
+    static constexpr size_t large_buffer_size = 2 * 1024 * 1024;
+
+private:
+    bool with(dnnl_cpu_allocator_flags_t flag) const { return flags_ & flag; }
+
+    void *allocate_buffer(size_t size, size_t alignment) const;
+    // Releases the largest free buffers until the pool fits its capacity.
+    // Must be called with the mutex held.
+    void shrink_pool();
+
+    const unsigned flags_;
+    const size_t pool_capacity_;
+
+    // Pooled allocator state: sizes of the live buffers, free buffers of
+    // each size class and their total size.
+    std::mutex mutex_;
+    std::unordered_map<void *, size_t> buffer_sizes_;
+    std::map<size_t, std::vector<void *>> free_buffers_;
+    size_t pooled_bytes_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(builtin_cpu_allocator_t);
+};
+
+// Allocator used by a CPU engine unless another one is set
+const std::shared_ptr<cpu_allocator_t> &get_default_cpu_allocator();
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
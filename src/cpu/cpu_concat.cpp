@@ -20,6 +20,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_concat.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,8 +34,10 @@ using namespace dnnl::impl::data_type;
 #define INSTANCE(...) \
     impl_list_item_t(impl_list_item_t::concat_type_deduction_helper_t< \
             __VA_ARGS__::pd_t>()),
+#define INSTANCE_X64(...) DNNL_X64_ONLY(INSTANCE(__VA_ARGS__))
 // clang-format off
 constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
+        INSTANCE_X64(jit_uni_concat_t)
         INSTANCE(simple_concat_t<f32>)
         INSTANCE(simple_concat_t<u8>)
         INSTANCE(simple_concat_t<s8>)
@@ -40,6 +47,7 @@ constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         nullptr,
 });
 // clang-format on
+#undef INSTANCE_X64
 #undef INSTANCE
 } // namespace
 
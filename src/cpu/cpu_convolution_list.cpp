@@ -50,6 +50,7 @@
 #include "cpu/x64/jit_brgemm_1x1_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv.hpp"
 #include "cpu/x64/jit_brgemm_conv_bwd.hpp"
+#include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
 #include "cpu/x64/jit_sse41_1x1_convolution.hpp"
 #include "cpu/x64/jit_sse41_convolution.hpp"
 #include "cpu/x64/jit_uni_dw_convolution.hpp"
@@ -141,6 +142,18 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE(ref_fused_convolution_fwd_t)
             nullptr,
         }},
+        {{forward, f32, f16, f32}, {
+            CPU_INSTANCE(ref_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, f16, f16, f32}, {
+            CPU_INSTANCE(ref_convolution_fwd_t)
+            nullptr,
+        }},
+        {{forward, f16, f16, f16}, {
+            CPU_INSTANCE(ref_convolution_fwd_t)
+            nullptr,
+        }},
         // BWD_D fp
         {{backward_data, f32, f32, f32}, REG_BWD_D_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_data_t)
@@ -188,6 +201,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{backward_weights, f32, f32, f32}, REG_BWD_PK({
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_dw_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX512(brgemm_convolution_bwd_weights_t<avx512_core>)
             CPU_INSTANCE_AVX512(jit_avx512_common_1x1_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_f32_wino_conv_4x3_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_convolution_bwd_weights_t<f32>)
@@ -206,6 +220,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, f32>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX512(brgemm_convolution_bwd_weights_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<f32>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_bwd_weights_t<f32>)
@@ -216,6 +231,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_X64(ip_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_bwd_weights_t<avx512_core, bf16, bf16>)
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_bwd_weights_t)
+            CPU_INSTANCE_AVX512(brgemm_convolution_bwd_weights_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_bwd_weights_t<bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_bwd_weights_t)
             CPU_INSTANCE_AVX512(gemm_bf16_convolution_bwd_weights_t<bf16>)
@@ -47,6 +47,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         {{forward}, {
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<avx512_core, f32>)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<avx512_core, bf16>)
+            CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<avx512_core, f16>)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<avx2, f32>)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<avx, f32>)
             CPU_INSTANCE_X64(jit_uni_eltwise_fwd_t<sse41, f32>)
@@ -68,6 +69,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             CPU_INSTANCE_AARCH64_ACL(acl_eltwise_fwd_t<s8>)
             CPU_INSTANCE(ref_eltwise_fwd_t<f32>)
             CPU_INSTANCE(ref_eltwise_fwd_t<bf16>)
+            CPU_INSTANCE(ref_eltwise_fwd_t<f16>)
             CPU_INSTANCE(ref_eltwise_fwd_t<s32>)
             CPU_INSTANCE(ref_eltwise_fwd_t<s8>)
             CPU_INSTANCE(ref_eltwise_fwd_t<u8>)
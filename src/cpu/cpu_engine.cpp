@@ -29,7 +29,7 @@ namespace cpu {
 
 status_t cpu_engine_t::create_memory_storage(
         memory_storage_t **storage, unsigned flags, size_t size, void *handle) {
-    auto _storage = new cpu_memory_storage_t(this);
+    auto _storage = new cpu_memory_storage_t(this, allocator());
     if (_storage == nullptr) return status::out_of_memory;
     status_t status = _storage->init(flags, size, handle);
     if (status != status::success) {
@@ -40,6 +40,32 @@ status_t cpu_engine_t::create_memory_storage(
     return status::success;
 }
 
+status_t cpu_engine_t::set_cpu_allocator(
+        dnnl_cpu_malloc_t malloc_fn, dnnl_cpu_free_t free_fn, void *user_data) {
+    std::shared_ptr<cpu_allocator_t> allocator;
+    if (malloc_fn)
+        allocator = std::make_shared<user_cpu_allocator_t>(
+                malloc_fn, free_fn, user_data);
+    else
+        allocator = get_default_cpu_allocator();
+
+    utils::lock_write_t lock(allocator_mutex_);
+    allocator_ = allocator;
+    return status::success;
+}
+
+status_t cpu_engine_t::set_cpu_allocator_flags(unsigned flags) {
+    std::shared_ptr<cpu_allocator_t> allocator;
+    if (flags == dnnl_cpu_allocator_flags_none)
+        allocator = get_default_cpu_allocator();
+    else
+        allocator = std::make_shared<builtin_cpu_allocator_t>(flags);
+
+    utils::lock_write_t lock(allocator_mutex_);
+    allocator_ = allocator;
+    return status::success;
+}
+
 status_t cpu_engine_t::create_stream(stream_t **stream, unsigned flags) {
     return safe_ptr_assign(*stream, new cpu_stream_t(this, flags));
 }
@@ -26,7 +26,10 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/rw_mutex.hpp"
+#include "common/serialization_stream.hpp"
 
+#include "cpu/cpu_allocator.hpp"
 #include "cpu/platform.hpp"
 
 #if DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
@@ -67,6 +70,7 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax_v2);
 
@@ -104,6 +108,7 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             case primitive_kind::softmax:
             CASE(softmax_v2);
@@ -116,7 +121,18 @@ public:
 
 class cpu_engine_t : public engine_t {
 public:
-    cpu_engine_t() : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0) {}
+    cpu_engine_t()
+        : engine_t(engine_kind::cpu, get_cpu_native_runtime(), 0)
+        , allocator_(get_default_cpu_allocator()) {}
+
+    status_t set_cpu_allocator(dnnl_cpu_malloc_t malloc_fn,
+            dnnl_cpu_free_t free_fn, void *user_data) override;
+    status_t set_cpu_allocator_flags(unsigned flags) override;
+
+    std::shared_ptr<cpu_allocator_t> allocator() const {
+        utils::lock_read_t lock(allocator_mutex_);
+        return allocator_;
+    }
 
     /* implementation part */
 
@@ -150,12 +166,29 @@ public:
 
     device_id_t device_id() const override { return std::make_tuple(0, 0, 0); }
 
+    status_t serialize_device(serialization_stream_t &sstream) const override {
+        // JIT-generated code depends on the ISA the library is allowed to use.
+        const auto isa = platform::get_effective_cpu_isa();
+        const auto isa_hints = platform::get_cpu_isa_hints();
+        sstream.write(&isa);
+        sstream.write(&isa_hints);
+        return status::success;
+    }
+
 #ifdef DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE
     engine_id_t engine_id() const override {
         // Non-sycl CPU engine doesn't have device and context.
         return {};
     }
+#endif
 
+private:
+    // Memory storages already allocated keep their allocator alive, so the
+    // allocator can be replaced at any time.
+    std::shared_ptr<cpu_allocator_t> allocator_;
+    mutable utils::rw_mutex_t allocator_mutex_;
+
+#ifdef DNNL_USE_RT_OBJECTS_IN_PRIMITIVE_CACHE
 protected:
     ~cpu_engine_t() override = default;
 #endif
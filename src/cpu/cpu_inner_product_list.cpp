@@ -24,6 +24,7 @@
 #if DNNL_X64
 #include "cpu/x64/gemm_bf16_inner_product.hpp"
 #include "cpu/x64/jit_brgemm_inner_product.hpp"
+#include "cpu/x64/jit_brgemm_sparse_inner_product.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
@@ -44,8 +45,11 @@ using namespace dnnl::impl::prop_kind;
 const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_IP_P({
         {{forward, f32, f32, f32}, {
+            CPU_INSTANCE_AVX512(brgemm_sparse_inner_product_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_sparse_inner_product_fwd_t<avx2>)
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_bf16>) // bf32
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2>)
             CPU_INSTANCE_AARCH64_ACL(acl_inner_product_fwd_t)
             CPU_INSTANCE(gemm_inner_product_fwd_t<f32>)
             CPU_INSTANCE(ref_inner_product_fwd_t)
@@ -108,6 +112,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, s8, s8, f32}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -115,6 +120,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, s8, s8, s32}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -122,6 +128,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, s8, s8, s8}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -129,6 +136,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, s8, s8, u8}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -136,6 +144,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, u8, s8, f32}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -143,6 +152,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, u8, s8, s32}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -150,6 +160,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, u8, s8, s8}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -157,6 +168,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
         {{forward, u8, s8, u8}, {
             CPU_INSTANCE_AMX(brgemm_inner_product_fwd_t<avx512_core_bf16_amx_int8>)
             CPU_INSTANCE_AVX512(brgemm_inner_product_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX2(brgemm_inner_product_fwd_t<avx2_vnni>)
             CPU_INSTANCE(gemm_x8s8s32x_inner_product_fwd_t)
             CPU_INSTANCE(ref_inner_product_int8_fwd_t)
             nullptr,
@@ -33,8 +33,12 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         {{forward}, {
             CPU_INSTANCE(simple_layer_normalization_fwd_t<f32>)
             CPU_INSTANCE(simple_layer_normalization_fwd_t<bf16>)
+            CPU_INSTANCE(simple_layer_normalization_fwd_t<s8>)
+            CPU_INSTANCE(simple_layer_normalization_fwd_t<u8>)
             CPU_INSTANCE(ref_layer_normalization_fwd_t<f32>)
             CPU_INSTANCE(ref_layer_normalization_fwd_t<bf16>)
+            CPU_INSTANCE(ref_layer_normalization_fwd_t<s8>)
+            CPU_INSTANCE(ref_layer_normalization_fwd_t<u8>)
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
@@ -17,6 +17,7 @@
 #ifndef CPU_CPU_MEMORY_STORAGE_HPP
 #define CPU_CPU_MEMORY_STORAGE_HPP
 
+#include <functional>
 #include <memory>
 
 #include "common/c_types_map.hpp"
@@ -25,6 +26,7 @@
 #include "common/stream.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_allocator.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -33,8 +35,12 @@ namespace cpu {
 
 class cpu_memory_storage_t : public memory_storage_t {
 public:
-    cpu_memory_storage_t(engine_t *engine)
-        : memory_storage_t(engine), data_(nullptr, release) {}
+    cpu_memory_storage_t(engine_t *engine,
+            const std::shared_ptr<cpu_allocator_t> &allocator
+            = get_default_cpu_allocator())
+        : memory_storage_t(engine)
+        , allocator_(allocator)
+        , data_(nullptr, release) {}
 
     status_t get_data_handle(void **handle) const override {
         *handle = data_.get();
@@ -86,19 +92,23 @@ public:
 
 protected:
     status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
+        void *ptr = allocator_->malloc(size, platform::get_cache_line_size());
         if (!ptr) return status::out_of_memory;
-        data_ = decltype(data_)(ptr, destroy);
+        // The buffer is released by the allocator it was obtained from, even
+        // if the engine allocator is replaced in the meantime.
+        auto allocator = allocator_;
+        data_ = decltype(data_)(
+                ptr, [allocator](void *ptr) { allocator->free(ptr); });
         return status::success;
     }
 
 private:
-    std::unique_ptr<void, void (*)(void *)> data_;
+    std::shared_ptr<cpu_allocator_t> allocator_;
+    std::unique_ptr<void, std::function<void(void *)>> data_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 
     static void release(void *ptr) {}
-    static void destroy(void *ptr) { free(ptr); }
 };
 
 } // namespace cpu
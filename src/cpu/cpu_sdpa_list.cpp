@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_engine.hpp"
+
+#include "cpu/ref_sdpa.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// clang-format off
+constexpr impl_list_item_t impl_list[] = REG_SDPA_P({
+    CPU_INSTANCE_X64(brgemm_sdpa_fwd_t<avx512_core_bf16>)
+    CPU_INSTANCE_X64(brgemm_sdpa_fwd_t<avx512_core>)
+    CPU_INSTANCE_X64(brgemm_sdpa_fwd_t<avx2>)
+    CPU_INSTANCE(ref_sdpa_fwd_t)
+    /* eol */
+    nullptr,
+});
+// clang-format on
+} // namespace
+
+const impl_list_item_t *get_sdpa_impl_list(const sdpa_desc_t *desc) {
+    UNUSED(desc);
+    return impl_list;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -23,6 +23,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_avx512_core_bf16_sum.hpp"
+#include "cpu/x64/jit_uni_sum.hpp"
 using namespace dnnl::impl::cpu::x64;
 #endif
 
@@ -40,6 +41,9 @@ using namespace dnnl::impl::data_type;
 constexpr impl_list_item_t cpu_sum_impl_list[] = REG_SUM_P({
         INSTANCE_X64(jit_bf16_sum_t<bf16, bf16>)
         INSTANCE_X64(jit_bf16_sum_t<bf16, f32>)
+        INSTANCE_X64(jit_uni_sum_t<f32, f32>)
+        INSTANCE_X64(jit_uni_sum_t<s8, s8>)
+        INSTANCE_X64(jit_uni_sum_t<u8, u8>)
         INSTANCE(simple_sum_t<bf16>)
         INSTANCE(simple_sum_t<bf16, f32>)
         INSTANCE(simple_sum_t<f32>)
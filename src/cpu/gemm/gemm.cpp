@@ -134,6 +134,46 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
 }
 
+dnnl_status_t sgemm_grouped(dim_t group_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc) {
+    if (group_size < 0) return dnnl_invalid_arguments;
+    if (group_size == 0) return dnnl_success;
+    if (utils::any_null(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
+                C, ldc))
+        return dnnl_invalid_arguments;
+
+    for (dim_t p = 0; p < group_size; p++) {
+        // Packed matrices are not supported
+        if (!utils::one_of(transa[p], 'T', 't', 'N', 'n')
+                || !utils::one_of(transb[p], 'T', 't', 'N', 'n'))
+            return dnnl_invalid_arguments;
+        dnnl_status_t status = check_gemm_input(&transa[p], &transb[p], &M[p],
+                &N[p], &K[p], A[p], &lda[p], B[p], &ldb[p], C[p], &ldc[p],
+                &alpha[p], &beta[p], false);
+        if (status != dnnl_success) return status;
+    }
+
+#if DNNL_X64 && !defined(USE_CBLAS)
+    if (mayiuse(sse41)) {
+        dnnl_status_t status = sgemm_grouped_driver(group_size, transa, transb,
+                M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+        if (status != dnnl_unimplemented) return status;
+    }
+#endif
+
+    // Fall back to computing the problems one by one
+    for (dim_t p = 0; p < group_size; p++) {
+        dnnl_status_t status = extended_sgemm(&transa[p], &transb[p], &M[p],
+                &N[p], &K[p], &alpha[p], A[p], &lda[p], B[p], &ldb[p],
+                &beta[p], C[p], &ldc[p]);
+        if (status != dnnl_success) return status;
+    }
+    return dnnl_success;
+}
+
 // Tries calling Intel MKL cblas_gemm_s8u8s32 if applicable and available
 dnnl_status_t try_cblas_gemm_s8u8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
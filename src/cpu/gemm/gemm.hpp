@@ -44,6 +44,12 @@ dnnl_status_t extended_sgemm(const char *transa, const char *transb,
         const float *beta, float *C, const dim_t *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
 
+dnnl_status_t sgemm_grouped(dim_t group_size, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, const float *beta,
+        float *const *C, const dim_t *ldc);
+
 template <typename b_dt>
 dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
@@ -25,6 +25,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
@@ -45,7 +46,10 @@ using namespace dnnl::impl::cpu::matmul;
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
+        CPU_INSTANCE_AVX512(brgemm_sparse_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_sparse_matmul_t<avx2>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_matmul_t<avx2>)
         CPU_INSTANCE(gemm_f32_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_bf16_amx_bf16>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core_bf16>)
@@ -53,6 +57,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(gemm_bf16_matmul_t<bf16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_bf16_amx_int8>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core_vnni>)
+        CPU_INSTANCE_AVX2(brgemm_matmul_t<avx2_vnni>)
         CPU_INSTANCE(gemm_x8s8s32x_matmul_t)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
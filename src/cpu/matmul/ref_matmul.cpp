@@ -44,6 +44,17 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     DEFINE_SCALES_BUFFER(scales);
 
+    const auto &wei_decomp = pd()->attr()->wei_decomp_;
+    const bool with_wei_decomp = !wei_decomp.has_default_values();
+    const auto wei_decomp_scales = CTX_IN_MEM(
+            const float *, DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES);
+    const auto wei_decomp_zero_points = CTX_IN_MEM(
+            const int8_t *, DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS);
+    if (with_wei_decomp && wei_decomp_scales == nullptr)
+        return status::invalid_arguments;
+    if (wei_decomp.with_zero_points_ && wei_decomp_zero_points == nullptr)
+        return status::invalid_arguments;
+
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
     const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
     const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
@@ -84,8 +95,14 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             const auto weights_off = weights_d.off_v(weights_dims_idx);
             const float s
                     = io::load_float_value(src_d.data_type(), src, src_off);
-            const float w = io::load_float_value(
+            float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
+            if (with_wei_decomp) {
+                const dim_t off = (k / wei_decomp.group_size_) * N + n;
+                if (wei_decomp.with_zero_points_)
+                    w -= wei_decomp_zero_points[off];
+                w *= wei_decomp_scales[off];
+            }
             acc += s * w;
         }
         return acc;
@@ -48,19 +48,34 @@ struct ref_matmul_t : public primitive_t {
             const auto wei_type = weights_md(0)->data_type;
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
-
-            bool ok = utils::one_of(src_type, f32, bf16)
-                    && utils::one_of(wei_type, f32, bf16)
-                    && utils::one_of(dst_type, f32, bf16)
-                    && src_type == wei_type
+            const bool with_wei_decomp
+                    = !attr()->wei_decomp_.has_default_values();
+
+            bool ok = utils::one_of(src_type, f32, bf16, f16)
+                    && utils::one_of(wei_type, f32, bf16, f16, s4, u4)
+                    && utils::one_of(dst_type, f32, bf16, f16)
+                    // f16 and decompressed 4-bit weights may be used with
+                    // f32 activations
+                    && (src_type == wei_type
+                            || (src_type == f32 && wei_type == f16)
+                            || (src_type == f32 && with_wei_decomp
+                                    && utils::one_of(wei_type, s4, u4)))
+                    && IMPLICATION(with_wei_decomp,
+                            src_type == f32
+                                    && utils::one_of(wei_type, f16, s4, u4))
                     && IMPLICATION(src_type == f32, dst_type == f32)
+                    && IMPLICATION(src_type == bf16, dst_type != f16)
+                    && IMPLICATION(src_type == f16, dst_type != bf16)
                     && IMPLICATION(with_bias(),
-                            utils::one_of(bia_type, f32, bf16)
+                            utils::one_of(bia_type, f32, bf16, f16)
                                     && IMPLICATION(
                                             src_type == f32, bia_type == f32))
                     && platform::has_data_type_support(src_type)
+                    && IMPLICATION(!utils::one_of(wei_type, s4, u4),
+                            platform::has_data_type_support(wei_type))
                     && attr()->has_default_values(smask_t::oscale_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::wei_decomp | smask_t::post_ops
+                                    | smask_t::sum_dt,
                             dst_type)
                     && attr_.post_ops_.check_sum_consistent_dt(dst_type)
                     && attr_oscale_ok() && set_default_formats()
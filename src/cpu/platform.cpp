@@ -110,7 +110,19 @@ bool has_data_type_support(data_type_t data_type) {
 #else
             return false;
 #endif
-        case data_type::f16: return false;
+        case data_type::f16:
+#if DNNL_X64
+            // f16 is a storage data type: the values are up-converted to f32
+            // with the F16C instructions available on all avx512_core CPUs
+            return x64::mayiuse(x64::avx512_core);
+#else
+            return false;
+#endif
+        case data_type::s4:
+        case data_type::u4:
+            // 4-bit values are packed in pairs and are only handled by the
+            // implementations that check for them explicitly
+            return false;
         default: return true;
     }
 }
@@ -51,13 +51,17 @@ struct ref_convolution_fwd_t : public primitive_t {
                     && platform::has_data_type_support(wei_type)
                     && platform::has_data_type_support(bia_type)
                     && platform::has_data_type_support(dst_type)
-                    && utils::one_of(src_type, f32, bf16)
-                    && utils::one_of(wei_type, f32, bf16)
-                    && utils::one_of(dst_type, f32, bf16)
-                    && src_type == wei_type
+                    && utils::one_of(src_type, f32, bf16, f16)
+                    && utils::one_of(wei_type, f32, bf16, f16)
+                    && utils::one_of(dst_type, f32, bf16, f16)
+                    // f16 weights may be used with f32 activations
+                    && (src_type == wei_type
+                            || (src_type == f32 && wei_type == f16))
                     && IMPLICATION(src_type == f32, dst_type == f32)
+                    && IMPLICATION(src_type == bf16, dst_type != f16)
+                    && IMPLICATION(src_type == f16, dst_type != bf16)
                     && IMPLICATION(with_bias(),
-                            utils::one_of(bia_type, f32, bf16)
+                            utils::one_of(bia_type, f32, bf16, f16)
                                     && IMPLICATION(
                                             src_type == f32, bia_type == f32))
                     && set_default_formats()
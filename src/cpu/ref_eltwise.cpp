@@ -270,6 +270,7 @@ status_t ref_eltwise_bwd_t<data_type>::execute_backward_dense(
 
 template struct ref_eltwise_fwd_t<data_type::f32>;
 template struct ref_eltwise_fwd_t<data_type::bf16>;
+template struct ref_eltwise_fwd_t<data_type::f16>;
 template struct ref_eltwise_fwd_t<data_type::s32>;
 template struct ref_eltwise_fwd_t<data_type::s8>;
 template struct ref_eltwise_fwd_t<data_type::u8>;
@@ -65,6 +65,14 @@ inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
         CASE(s32);
         CASE(s8);
         CASE(u8);
+        case s4:
+        case u4: {
+            // Two values are packed into a byte, the first one in the low
+            // nibble
+            const uint8_t byte = static_cast<const uint8_t *>(ptr)[idx / 2];
+            const int val = (idx % 2 ? byte >> 4 : byte) & 0xf;
+            return static_cast<float>(dt == s4 && val > 7 ? val - 16 : val);
+        }
         default: assert(!"bad data_type");
     }
 
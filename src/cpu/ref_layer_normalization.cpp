@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
 #include "cpu/ref_layer_normalization.hpp"
+#include "cpu/simple_q10n.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -76,6 +77,7 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const dim_t C = pd()->norm_axis();
 
     const float eps = pd()->desc()->layer_norm_epsilon;
+    const float output_scale = pd()->attr()->output_scales_.scales_[0];
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
 
@@ -123,7 +125,9 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            const float d
+                    = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            dst[dst_off] = saturate_and_round<data_t>(output_scale * d);
         }
 
         if (calculate_stats) {
@@ -138,6 +142,8 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
 template struct ref_layer_normalization_fwd_t<f32>;
 template struct ref_layer_normalization_fwd_t<bf16>;
+template struct ref_layer_normalization_fwd_t<s8>;
+template struct ref_layer_normalization_fwd_t<u8>;
 
 template <impl::data_type_t d_type>
 status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto q = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int ndims = pd()->ndims();
+    const dim_t MB = pd()->batch();
+    const dim_t Sq = pd()->queries();
+    const dim_t Sk = pd()->keys();
+    const dim_t D = pd()->head_size();
+    const dim_t Dv = pd()->values_head_size();
+    const float scale = pd()->desc()->scale;
+    const bool with_mask_buffer = pd()->with_mask_buffer();
+    const bool with_causal_mask = pd()->with_causal_mask();
+
+    float *scores_base
+            = ctx.get_scratchpad_grantor().template get<float>(key_sdpa_scores);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        float *scores = scores_base + ithr * Sk;
+
+        dim_t start {0}, end {0};
+        balance211(MB * Sq, nthr, ithr, start, end);
+
+        dims_t pos = {0}, mask_pos = {0};
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / Sq;
+            const dim_t i = iwork % Sq;
+
+            // Leading (batch and heads) positions of the problem
+            dim_t rem = mb;
+            for (int d = ndims - 3; d >= 0; d--) {
+                pos[d] = rem % q_d.dims()[d];
+                rem /= q_d.dims()[d];
+                if (with_mask_buffer)
+                    mask_pos[d] = mask_d.dims()[d] == 1 ? 0 : pos[d];
+            }
+
+            const dim_t n_keys = with_causal_mask ? nstl::min(i + 1, Sk) : Sk;
+
+            float max_score = -FLT_MAX;
+            for (dim_t j = 0; j < n_keys; j++) {
+                float s = 0.f;
+                for (dim_t d = 0; d < D; d++) {
+                    pos[ndims - 2] = i;
+                    pos[ndims - 1] = d;
+                    const float qv = io::load_float_value(
+                            q_d.data_type(), q, q_d.off_v(pos));
+                    pos[ndims - 2] = j;
+                    const float kv = io::load_float_value(
+                            k_d.data_type(), k, k_d.off_v(pos));
+                    s += qv * kv;
+                }
+                s *= scale;
+                if (with_mask_buffer) {
+                    mask_pos[ndims - 2] = i;
+                    mask_pos[ndims - 1] = j;
+                    s += io::load_float_value(
+                            mask_d.data_type(), mask, mask_d.off_v(mask_pos));
+                }
+                scores[j] = s;
+                max_score = nstl::max(max_score, s);
+            }
+
+            float denom = 0.f;
+            for (dim_t j = 0; j < n_keys; j++) {
+                scores[j] = expf(scores[j] - max_score);
+                denom += scores[j];
+            }
+            const float inv_denom = denom > 0.f ? 1.f / denom : 0.f;
+
+            for (dim_t dv = 0; dv < Dv; dv++) {
+                float acc = 0.f;
+                pos[ndims - 1] = dv;
+                for (dim_t j = 0; j < n_keys; j++) {
+                    pos[ndims - 2] = j;
+                    acc += scores[j]
+                            * io::load_float_value(
+                                    v_d.data_type(), v, v_d.off_v(pos));
+                }
+                pos[ndims - 2] = i;
+                io::store_float_value(dst_d.data_type(), acc * inv_denom, dst,
+                        dst_d.off_v(pos));
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
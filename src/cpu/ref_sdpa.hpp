@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto q_dt = src_md(0)->data_type;
+            const auto k_dt = src_md(1)->data_type;
+            const auto v_dt = src_md(2)->data_type;
+            const auto dst_dt = dst_md()->data_type;
+
+            bool ok = utils::one_of(q_dt, f32, bf16, s8, u8)
+                    && utils::one_of(k_dt, f32, bf16, s8, u8)
+                    && utils::one_of(v_dt, f32, bf16, s8, u8)
+                    && utils::one_of(dst_dt, f32, bf16, s8, u8)
+                    && IMPLICATION(with_mask_buffer(),
+                            utils::one_of(src_md(3)->data_type, f32, bf16))
+                    && platform::has_data_type_support(q_dt)
+                    && platform::has_data_type_support(k_dt)
+                    && platform::has_data_type_support(v_dt)
+                    && platform::has_data_type_support(dst_dt)
+                    && attr()->has_default_values()
+                    && set_default_params() == status::success;
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+            return status::success;
+        }
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            // A row of scores per thread
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    key_sdpa_scores, keys() * dnnl_get_max_threads());
+        }
+    };
+
+    ref_sdpa_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -22,6 +22,7 @@
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
 #include "cpu/ref_softmax.hpp"
 
@@ -35,6 +36,17 @@ static bool is_padding(const memory_desc_wrapper &md) {
     return false;
 }
 
+dim_t ref_softmax_fwd_t::softmax_mask_off_l(dim_t l_offset) const {
+    const int ndims = pd()->ndims();
+    const auto &dims = pd()->src_md()->dims;
+    dim_t off = 0;
+    for (int d = ndims - 1; d >= 0; --d) {
+        off += (l_offset % dims[d]) * softmax_mask_strides_[d];
+        l_offset /= dims[d];
+    }
+    return off;
+}
+
 status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
     using namespace memory_tracking::names;
 
@@ -180,13 +192,28 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
 
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto softmax_mask
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SOFTMAX_MASK);
+    if (pd()->with_softmax_mask() && !softmax_mask)
+        return status::invalid_arguments;
     const float *scales = pd()->attr()->output_scales_.scales_;
+    const float *src_scales = nullptr;
+    ASSIGN_INPUT_SCALE_VALUE(src_scales, DNNL_ARG_SRC);
     float *scratchpad_int8 = ctx.get_scratchpad_grantor().template get<float>(
             key_softmax_interim_store);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
+    // The source scale and the softmax mask are applied on load
+    auto load_src = [&](dim_t l_offset) {
+        float s = io::load_float_value(
+                src_d.data_type(), src, src_d.off_l(l_offset));
+        s *= src_scales[0];
+        if (softmax_mask) s += softmax_mask[softmax_mask_off_l(l_offset)];
+        return s;
+    };
+
     void *interim_ptr = pd()->need_int8_scratchpad() ? scratchpad_int8 : dst;
     const auto interim_dt
             = pd()->need_int8_scratchpad() ? data_type::f32 : dst_d.data_type();
@@ -232,14 +259,12 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
             dim_t ou_in_offset = ou * channels_ * inner_size_ + in;
 
             for (int c = 0; c < channels_; c++) {
-                size_t off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, off);
+                float s = load_src(ou_in_offset + c * inner_size_);
                 space_max[in] = nstl::max(space_max[in], s);
             }
 
             for (int c = 0; c < channels_; c++) {
-                size_t src_off = src_d.off_l(ou_in_offset + c * inner_size_);
-                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = load_src(ou_in_offset + c * inner_size_);
                 float d = s - space_max[in];
                 if (pd()->is_softmax()) {
                     d = expf(d);
@@ -272,6 +297,13 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                     d -= sd;
                 }
                 d *= scales[0];
+
+                ref_post_ops_t::args_t args;
+                args.ctx = &ctx;
+                args.l_offset = ou_in_offset + c * inner_size_;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops_->execute(d, args);
+
                 io::store_float_value(dst_d.data_type(), d, dst, dst_off);
             }
         }
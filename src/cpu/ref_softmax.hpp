@@ -27,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -47,9 +48,14 @@ struct ref_softmax_fwd_t : public primitive_t {
                     && utils::one_of(dst_md()->data_type, f32, bf16, s8, u8)
                     && platform::has_data_type_support(src_md()->data_type)
                     && platform::has_data_type_support(dst_md()->data_type)
-                    && attr()->has_default_values(skip_mask_t::oscale)
-                    && attr_oscale_ok()
-                    && set_default_formats() == status::success;
+                    && attr()->has_default_values(skip_mask_t::oscale
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::scales_runtime
+                            | skip_mask_t::softmax_mask)
+                    && attr_oscale_ok() && attr_post_ops_ok()
+                    && attr_scales_ok() && attr_softmax_mask_ok()
+                    && set_default_formats() == status::success
+                    && attr_.set_default_formats(dst_md(0)) == status::success;
             if (!ok) return status::unimplemented;
 
             nthr_ = 0;
@@ -105,7 +111,22 @@ struct ref_softmax_fwd_t : public primitive_t {
 
         use_dense_ = inner_size_ == 1 && src_d == dst_d && src_d.is_dense(true)
                 && src_d.only_padded_dim(axis)
-                && bd.strides[axis] == axis_blk_size;
+                && bd.strides[axis] == axis_blk_size
+                && pd()->attr()->post_ops_.has_default_values()
+                && pd()->attr()->scales_.has_default_values()
+                && !pd()->with_softmax_mask();
+
+        // Broadcast dimensions of the softmax mask get a zero stride
+        const memory_desc_wrapper mask_d(pd()->softmax_mask_md());
+        for (int d = 0; d < mask_d.ndims(); d++)
+            softmax_mask_strides_[d] = mask_d.dims()[d] == 1
+                    ? 0
+                    : mask_d.blocking_desc().strides[d];
+
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+
         return status::success;
     }
 
@@ -119,11 +140,14 @@ struct ref_softmax_fwd_t : public primitive_t {
 private:
     status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     status_t execute_forward_generic(const exec_ctx_t &ctx) const;
+    dim_t softmax_mask_off_l(dim_t l_offset) const;
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     bool use_dense_;
     int outer_size_, channels_, inner_size_;
+    dims_t softmax_mask_strides_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 struct ref_softmax_bwd_t : public primitive_t {
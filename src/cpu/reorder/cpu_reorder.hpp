@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "cpu/reorder/simple_reorder.hpp"
+#include "cpu/reorder/simple_sparse_reorder.hpp"
 
 #include "common/impl_list_item.hpp"
 #include "common/memory.hpp"
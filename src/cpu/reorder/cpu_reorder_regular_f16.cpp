@@ -26,6 +26,8 @@ const impl_list_map_t &regular_f16_impl_list_map() {
     static const impl_list_map_t the_map = REG_REORDER_P({
         // f16 ->
         {{f16, data_type::undef, 0}, {
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::jit_uni_reorder_t))
+
             REG_SR(f16, any, f16, any, fmt_order::any, spec::reference)
             REG_SR(f16, any, f32, any, fmt_order::any, spec::reference)
 
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REORDER_SIMPLE_SPARSE_REORDER_HPP
+#define CPU_REORDER_SIMPLE_SPARSE_REORDER_HPP
+
+#include <assert.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Packs dense 2D weights into the block-sparse format
+// (sparse_encoding::bcsr_bitmask). A block is stored only if it has at least
+// one non-zero element, the elements outside of the tensor are zero-filled.
+template <data_type_t type>
+struct simple_sparse_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:sparse", simple_sparse_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            using namespace status;
+
+            const memory_desc_wrapper id(src_md), od(dst_md);
+            const bool args_ok = od.is_sparse_desc()
+                    && od.sparse_desc().encoding
+                            == sparse_encoding::bcsr_bitmask
+                    && id.is_blocking_desc() && id.ndims() == 2
+                    && id.data_type() == type && od.data_type() == type
+                    && !id.has_runtime_dims_or_strides()
+                    && attr->has_default_values();
+            if (!args_ok) return invalid_arguments;
+
+            auto _pd = new pd_t(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return out_of_memory;
+            if (_pd->init(engine, src_engine, dst_engine) != success) {
+                delete _pd;
+                return unimplemented;
+            }
+            _pd->init_scratchpad_md();
+            return safe_ptr_assign(*reorder_pd, _pd);
+        }
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    simple_sparse_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+private:
+    typedef typename prec_traits<type>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        auto input = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM);
+        auto output = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+        const memory_desc_wrapper id(pd()->src_md());
+        const memory_desc_wrapper od(pd()->dst_md());
+        const sparse_desc_t &sd = od.sparse_desc();
+
+        const int row_dim = sd.row_dim;
+        const int col_dim = 1 - row_dim;
+        const dim_t R = od.dims()[row_dim], C = od.dims()[col_dim];
+        const dim_t rb = sd.block_dims[row_dim], cb = sd.block_dims[col_dim];
+        const dim_t nrows = utils::div_up(R, rb);
+        const dim_t ncols = utils::div_up(C, cb);
+        const dim_t words = utils::div_up(ncols, 64);
+
+        auto offsets = reinterpret_cast<int64_t *>(output);
+        auto bitmask = reinterpret_cast<uint64_t *>(output + sd.bitmask_offset);
+        auto values = reinterpret_cast<data_t *>(output + sd.values_offset);
+
+        const auto src_val = [&](dim_t r, dim_t c) {
+            dims_t pos;
+            pos[row_dim] = r;
+            pos[col_dim] = c;
+            return input[id.off_v(pos)];
+        };
+
+        const auto is_zero_block = [&](dim_t rblk, dim_t cblk) {
+            for_(dim_t c = cblk * cb; c < nstl::min(C, (cblk + 1) * cb); c++)
+            for (dim_t r = rblk * rb; r < nstl::min(R, (rblk + 1) * rb); r++)
+                if (src_val(r, c) != data_t(0)) return false;
+            return true;
+        };
+
+        // The 1st pass builds the bitmasks and counts the non-zero blocks,
+        // the counts then turn into offsets
+        parallel_nd(nrows, [&](dim_t rblk) {
+            uint64_t *row_mask = bitmask + rblk * words;
+            int64_t cnt = 0;
+            for (dim_t w = 0; w < words; w++)
+                row_mask[w] = 0;
+            for (dim_t cblk = 0; cblk < ncols; cblk++) {
+                if (is_zero_block(rblk, cblk)) continue;
+                row_mask[cblk / 64] |= uint64_t(1) << (cblk % 64);
+                cnt++;
+            }
+            offsets[rblk + 1] = cnt;
+        });
+
+        offsets[0] = 0;
+        for (dim_t rblk = 0; rblk < nrows; rblk++)
+            offsets[rblk + 1] += offsets[rblk];
+
+        // The 2nd pass copies the non-zero blocks with row_dim innermost
+        parallel_nd(nrows, [&](dim_t rblk) {
+            const uint64_t *row_mask = bitmask + rblk * words;
+            data_t *blk = values + offsets[rblk] * rb * cb;
+            for (dim_t cblk = 0; cblk < ncols; cblk++) {
+                if (!(row_mask[cblk / 64] & (uint64_t(1) << (cblk % 64))))
+                    continue;
+                for_(dim_t c = 0; c < cb; c++)
+                for (dim_t r = 0; r < rb; r++) {
+                    const dim_t r_abs = rblk * rb + r, c_abs = cblk * cb + c;
+                    blk[c * rb + r] = r_abs < R && c_abs < C
+                            ? src_val(r_abs, c_abs)
+                            : data_t(0);
+                }
+                blk += rb * cb;
+            }
+        });
+
+        return status::success;
+    }
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
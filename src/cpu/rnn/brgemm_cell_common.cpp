@@ -163,6 +163,43 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                 addr_batch_global, fused_postgemm_gru_part1,
                 fused_postgemm_gru_part2);
         dst_calc.execute();
+    } else if (rnn.is_lbr) {
+        using brgemm_gru_lbr_t = x64::brgemm_gru_lbr_t<src_iter_t, weights_t,
+                scratch_t, gemm_acc_t>;
+        const typename brgemm_gru_lbr_t::postgemm_fused_t fused_postgemm_lbr
+                = [&](dim_t m, dim_t n, const src_iter_t *Ai_n,
+                          scratch_t *C_gates_n, scratch_t *C_cell_n,
+                          int block_step) {
+                      const auto Dl_n = (dst_layer_ != nullptr)
+                              ? dst_layer_ + m * LDDl + n
+                              : nullptr;
+                      const auto Di_n = (dst_iter_ != nullptr)
+                              ? dst_iter_ + m * LDDi + n
+                              : nullptr;
+                      const auto curr_ws_gates_
+                              = ws_gates_ + m * rnn.ws_gates_ld + n;
+                      const auto ws_grid_n = (ws_grid_ != nullptr)
+                              ? ws_grid_ + m * rnn.dhc + n
+                              : nullptr;
+                      const auto attention_m = (augru_attention_ != nullptr)
+                              ? augru_attention_ + m
+                              : nullptr;
+                      const auto bias_n = inc_ptr(bias_[0], rnn.bias_dt, n);
+                      rnn_postgemm_->execute(rnn, cell_position, curr_ws_gates_,
+                              C_gates_n, attention_m, Dl_n, nullptr, Ai_n,
+                              nullptr, nullptr, nullptr, nullptr, nullptr,
+                              nullptr, nullptr, nullptr, nullptr, bias_n,
+                              ws_grid_n, C_cell_n, Di_n, nullptr, block_step);
+                  };
+
+        // calculate
+        // scratch_gates_ = src_layer_ * w_layer_
+        // scratch_cell_ = src_iter_ * w_iter_
+        const brgemm_gru_lbr_t dst_calc(rnn_brgemm_, rnn, cell_position,
+                src_iter_, src_layer_, w_iter_[0], w_layer_[0], scratch_gates_,
+                scratch_cell_, amx_scratchpad, addr_batch_global,
+                fused_postgemm_lbr);
+        dst_calc.execute();
     } else {
         // calculate
         // scratch_gates_ = src_layer_ * w_layer_ + src_iter_ * w_iter_
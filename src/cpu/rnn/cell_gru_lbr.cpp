@@ -53,7 +53,8 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             augru_attention_, dst_layer_, dst_iter_c_, src_iter_, src_iter_c_,
             diff_src_layer_, diff_augru_attention_, diff_src_iter_,
             diff_src_iter_c_, diff_dst_layer_, diff_dst_iter_, nullptr, nullptr,
-            bias_[0], ws_grid_, scratch_cell_, dst_iter_, nullptr, 0);
+            bias_[0], ws_grid_, scratch_cell_, dst_iter_, nullptr,
+            rnn.dhc * sizeof(scratch_t));
 
     return dnnl_success;
 }
@@ -40,7 +40,7 @@ void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
         scratch_data_t *scratch_gates_, const src_data_t *augru_attention_,
         src_data_t *dst_layer_, src_data_t *dst_iter_,
         const src_data_t *src_iter_, const void *bias_, src_data_t *ws_grid_,
-        scratch_data_t *scratch_cell_) {
+        scratch_data_t *scratch_cell_, int block_step) {
 
     const auto src_iter_ld = rnn.src_iter_ld(cell_position);
     const auto dst_layer_ld = rnn.dst_layer_ld(cell_position);
@@ -61,7 +61,14 @@ void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
     const auto bias = [&](int gate_id, int dhc_id) {
         return to_float(bias_aoc(gate_id, dhc_id), rnn.bias_dt);
     };
-    const ws_gates_aoc<scratch_data_t> scratch_cell(rnn, scratch_cell_);
+    // brgemm-based cell computes scratch_cell with the scratch_gates leading
+    // dimension
+    const AOC<scratch_data_t, 2> scratch_cell_aoc(scratch_cell_,
+            rnn.scratch_gates_nld,
+            rnn.is_brgemm ? rnn.scratch_gates_ld : rnn.ws_gates_ld);
+    const auto scratch_cell = [&](int i, int gate_id, int j) {
+        return scratch_cell_aoc(i, gate_id * rnn.dhc + j);
+    };
     const AOC<src_data_t, 2> ws_Wh_b(ws_grid_, rnn.mb, rnn.dhc);
 
     const auto get_scales = [](const float *scales, int idx) {
@@ -70,9 +77,10 @@ void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
     const float *scales_G1 = get_scales(scales, 1);
     const float *scales_G2 = get_scales(scales, 2);
 
-    parallel_nd(rnn.mb, [&](dim_t i) {
+    const auto postgemm_call = [&](int i) {
+        const int n_elem = block_step / (int)sizeof(scratch_data_t);
         PRAGMA_OMP_SIMD()
-        for (int j = 0; j < rnn.dhc; j++) {
+        for (int j = 0; j < n_elem; j++) {
             const float Wh_b = scratch_cell(i, 2, j) + bias(3, j);
             auto G0 = func1(scales, // default func1 is sigmoid
                     scratch_gates(i, 0, j) + scratch_cell(i, 0, j)
@@ -96,7 +104,14 @@ void gru_lbr_fwd_postgemm_template(T1 func1, T2 func2, T3 to_src,
             if (dst_layer_ != nullptr) dst_layer(i, j) = tmp;
             if (dst_iter_ != nullptr) dst_iter(i, j) = tmp;
         }
-    });
+    };
+
+    if (rnn.is_brgemm && !rnn.unfused_post_gemm) {
+        for (int i = 0; i < rnn.m_block; i++)
+            postgemm_call(i);
+    } else {
+        parallel_nd(rnn.mb, [&](dim_t i) { postgemm_call(i); });
+    }
 }
 
 template <>
@@ -116,12 +131,12 @@ rnn_postgemm_sig(rnn_postgemm_fwd_f32_t::gru_lbr_postgemm) {
         gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, scales, rnn,
                 cell_position, ws_gates_, scratch_gates_, augru_attention_,
                 dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
-                scratch_cell_);
+                scratch_cell_, block_step);
     else
         gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, scales, rnn,
                 cell_position, ws_gates_, scratch_gates_, augru_attention_,
                 dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
-                scratch_cell_);
+                scratch_cell_, block_step);
 }
 
 template <>
@@ -141,12 +156,12 @@ rnn_postgemm_sig(rnn_postgemm_fwd_bf16_t::gru_lbr_postgemm) {
         gru_lbr_fwd_postgemm_template(logistic_f, tanh_f, to_src, scales, rnn,
                 cell_position, ws_gates_, scratch_gates_, augru_attention_,
                 dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
-                scratch_cell_);
+                scratch_cell_, block_step);
     else
         gru_lbr_fwd_postgemm_template(linear_f, linear_f, to_src, scales, rnn,
                 cell_position, ws_gates_, scratch_gates_, augru_attention_,
                 dst_layer_, dst_iter_, src_iter_, bias_, ws_grid_,
-                scratch_cell_);
+                scratch_cell_, block_step);
 }
 
 template <>
@@ -29,6 +29,10 @@
 
  */
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/simple_q10n.hpp"
@@ -204,6 +208,251 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
     const auto src_iter_c_mdw = memory_desc_wrapper(pd()->src_md(2));
     const auto dst_iter_c_mdw = memory_desc_wrapper(pd()->dst_md(2));
 
+    // Computes a single cell of the grid using the given scratch buffers
+    const auto execute_cell = [&](int dir, int j, int i,
+                                      scratch_t *thr_scratch_gates,
+                                      ht_t *thr_scratch_ht,
+                                      scratch_t *thr_scratch_cell) {
+        const int lay
+                = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter
+                = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+
+        const auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
+                ? thr_scratch_gates
+                : thr_scratch_gates
+                        + iter * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = thr_scratch_ht;
+        }
+
+// Since the function FN(...) returns by reference so an extra exception
+// has to be made for nullptr argument
+#define SAFE_PTR(FN, ...) CONCAT2(FN, _) ? &(FN(__VA_ARGS__)) : nullptr
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp
+                        ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                        : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0),
+                cell_scratch_gates, proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), thr_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp
+                        ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                        : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0),
+                cell_scratch_gates, proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), thr_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+#undef SAFE_PTR
+        return dnnl_success;
+    };
+
+    if (rnn.use_wavefront) {
+        // The cell (dir, lay, iter) depends only on the cells (dir, lay - 1,
+        // iter) and (dir, lay, iter - 1), so all the cells on the same
+        // anti-diagonal lay + iter are independent. Threads take the cells in
+        // the order of anti-diagonals and wait until the dependencies of the
+        // taken cell are computed. Each thread uses its own part of the
+        // scratch buffers, and the parallel regions nested into the cell are
+        // executed by the thread only.
+        assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer);
+        struct grid_cell_t {
+            int dir, lay, iter;
+        };
+        std::vector<grid_cell_t> cells;
+        cells.reserve(rnn.n_dir * rnn.n_layer * rnn.n_iter);
+        for (int d = 0; d < rnn.n_layer + rnn.n_iter - 1; d++)
+            for (int dir = 0; dir < rnn.n_dir; dir++)
+                for (int lay = nstl::max(0, d - rnn.n_iter + 1);
+                        lay < nstl::min(rnn.n_layer, d + 1); lay++)
+                    cells.push_back({dir, lay, d - lay});
+
+        // Number of computed iterations for each layer and direction
+        std::vector<std::atomic<int>> n_iters_done(rnn.n_dir * rnn.n_layer);
+        for (auto &n : n_iters_done)
+            n.store(0, std::memory_order_relaxed);
+        const auto iters_done = [&](int dir, int lay) -> std::atomic<int> & {
+            return n_iters_done[dir * rnn.n_layer + lay];
+        };
+
+        std::atomic<int> next_cell(0);
+        std::atomic<bool> failed(false);
+        std::vector<status_t> thr_status(rnn.wavefront_nthr, dnnl_success);
+        parallel(rnn.wavefront_nthr, [&](int ithr, int nthr) {
+            assert(ithr < rnn.wavefront_nthr);
+            scratch_t *thr_scratch_gates = scratch_gates_
+                    + (size_t)ithr * rnn.scratch_gates_nld
+                            * rnn.scratch_gates_ld;
+            ht_t *thr_scratch_ht = scratch_ht_
+                    ? scratch_ht_
+                            + (size_t)ithr * rnn.scratch_ht_nld
+                                    * rnn.scratch_ht_ld
+                    : nullptr;
+            scratch_t *thr_scratch_cell = scratch_cell_
+                    ? reinterpret_cast<scratch_t *>(
+                            reinterpret_cast<char *>(scratch_cell_)
+                            + ithr * rnn.scratch_cell_size
+                                    / rnn.wavefront_nthr)
+                    : nullptr;
+
+            for (int c = next_cell++; c < (int)cells.size(); c = next_cell++) {
+                const grid_cell_t &cell = cells[c];
+                const auto is_ready = [&]() {
+                    const auto &prev_iter = iters_done(cell.dir, cell.lay);
+                    if (prev_iter.load(std::memory_order_acquire) < cell.iter)
+                        return false;
+                    if (cell.lay == 0) return true;
+                    const auto &prev_lay = iters_done(cell.dir, cell.lay - 1);
+                    return prev_lay.load(std::memory_order_acquire)
+                            > cell.iter;
+                };
+                // The cells are taken in the order of dependencies, so the
+                // cells waited for are already being computed by other
+                // threads.
+                while (!is_ready()) {
+                    if (failed) return;
+                    std::this_thread::yield();
+                }
+
+                thr_status[ithr] = execute_cell(cell.dir, cell.lay, cell.iter,
+                        thr_scratch_gates, thr_scratch_ht, thr_scratch_cell);
+                if (thr_status[ithr] != dnnl_success) {
+                    failed = true;
+                    return;
+                }
+                iters_done(cell.dir, cell.lay)
+                        .store(cell.iter + 1, std::memory_order_release);
+            }
+        });
+
+        for (const auto st : thr_status)
+            CHECK(st);
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for (int dir = 0; dir < rnn.n_dir; dir++) {
         for (int j = 0; j < rnn.n_layer; j++) {
@@ -236,165 +485,9 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
             // TODO: enable merging projection gemm in bwd lstm projection
 
-            for (int i = 0; i < rnn.n_iter; i++) {
-                const int iter = (aprop == prop_kind::forward)
-                        ? i
-                        : rnn.n_iter - i - 1;
-
-                // We set parameters to the cell execution call
-
-                // dst_layer is equal to dst_iter. To avoid
-                // duplication of memory access we hence use only
-                // dst_layer and set dst_iter to nullptr, unless we
-                // cannot for one of the following condition:
-                // - in the last layer and last iteration, we need to
-                //   copy ht in two tensors (dst_layer and dst_iter)
-                dst_layer_t *cell_dst_layer
-                        = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-                dst_iter_t *cell_dst_iter = nullptr;
-                const src_layer_t *cell_src_layer
-                        = &(ws_states_layer(lay, dir, iter + 1, 0));
-                const src_iter_t *cell_src_iter
-                        = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-                void *cell_dst_iter_c = const_cast<void *>(
-                        ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-                const void *cell_src_iter_c
-                        = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-                // the cell_position is used only when skip_data_copy is
-                // supported currently supported only for forward
-                cell_position_t cell_position = middle_cell;
-                if (iter == 0) cell_position |= first_iter;
-                if (lay == 0) cell_position |= first_layer;
-                if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-                if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-                // The dst_* paths should be before the src_* paths as
-                // the later will override cell_src_layer and
-                // cell_src_iter appropriately for 1st layer and 1st
-                // iter.
-                const bool last_iter_skip_copy = rnn.skip_dst_iter_copy()
-                        && (cell_position & last_iter);
-                if (last_iter_skip_copy) {
-                    cell_dst_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                    cell_src_layer
-                            = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-                }
-
-                if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                    // Note: for last layer and last iter, the output is in dst_layer
-                    // and still need to be copied to dst_iter
-                    cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                    cell_dst_iter = last_iter_skip_copy
-                            ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                            : nullptr;
-                    cell_src_iter = (iter != 0)
-                            ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                            : cell_src_iter;
-                }
-                if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                    cell_src_iter
-                            = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-                if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                    cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-                // because the c state is always f32 and require no
-                // conversion, we can always skip to copy for the 1st
-                // and last iteration
-                if (iter == 0 && src_iter_c_) {
-                    cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                            src_iter_c_mdw.off(lay, dir, 0, 0));
-                    cell_position |= c_state_first_iter;
-                }
-                if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                    cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                            dst_iter_c_mdw.off(lay, dir, 0, 0));
-                    cell_position |= c_state_last_iter;
-                }
-
-                const auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
-                        ? scratch_gates_
-                        : scratch_gates_
-                                + iter * rnn.scratch_gates_nld
-                                        * rnn.scratch_gates_ld;
-
-                dst_iter_t *proj_ht = nullptr;
-                if (rnn.is_lstm_projection) {
-                    if (rnn.is_training)
-                        proj_ht = &(ws_ht(lay, dir, iter, 0));
-                    else
-                        proj_ht = scratch_ht_;
-                }
-
-// Since the function FN(...) returns by reference so an extra exception
-// has to be made for nullptr argument
-#define SAFE_PTR(FN, ...) CONCAT2(FN, _) ? &(FN(__VA_ARGS__)) : nullptr
-#if DNNL_X64
-                CHECK((this->*cell_func)(ctx, rnn, cell_position,
-                        cell_dst_layer, cell_dst_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                        SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                        SAFE_PTR(weights_layer, lay, dir, 0),
-                        SAFE_PTR(weights_iter, lay, dir, 0),
-                        SAFE_PTR(weights_projection, lay, dir),
-                        SAFE_PTR(weights_peephole, lay, dir, 0),
-                        w_proj_comp
-                                ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                        bias(lay, dir), cell_src_layer,
-                        SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                        cell_src_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                        SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                        SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                        SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                        SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                        SAFE_PTR(diff_bias, lay, dir, 0),
-                        SAFE_PTR(ws_gates, lay, dir, iter, 0),
-                        cell_scratch_gates, proj_ht, scratch_diff_ht_,
-                        SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                        scratch_gates_blocked_, scratch_src_layer_,
-                        scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                        addr_batch_global));
-#else
-                CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
-                        cell_dst_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                        SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                        SAFE_PTR(weights_layer, lay, dir, 0),
-                        SAFE_PTR(weights_iter, lay, dir, 0),
-                        SAFE_PTR(weights_projection, lay, dir),
-                        SAFE_PTR(weights_peephole, lay, dir, 0),
-                        w_proj_comp
-                                ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                        bias(lay, dir), cell_src_layer,
-                        SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                        cell_src_iter_c,
-                        SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                        SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                        SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                        SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                        SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                        SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                        SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                        SAFE_PTR(diff_bias, lay, dir, 0),
-                        SAFE_PTR(ws_gates, lay, dir, iter, 0),
-                        cell_scratch_gates, proj_ht, scratch_diff_ht_,
-                        SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                        cell_dst_iter, amx_scratchpad));
-#endif
-#undef SAFE_PTR
-            }
+            for (int i = 0; i < rnn.n_iter; i++)
+                CHECK(execute_cell(
+                        dir, j, i, scratch_gates_, scratch_ht_, scratch_cell_));
 
             if ((aprop == prop_kind::backward) && rnn.merge_gemm_layer) {
                 const src_layer_t *src_layer
@@ -259,9 +259,13 @@ struct _ref_rnn_common_t : public primitive_t {
             const data_type_t weights_layer_dt
                     = this->desc()->weights_layer_desc.data_type;
 
-            bool ok = one_of(cell_kind, alg_kind::vanilla_rnn,
-                              alg_kind::vanilla_lstm, alg_kind::vanilla_gru,
-                              alg_kind::vanilla_augru)
+            // Only forward propagation is supported for LBR GRU / AUGRU
+            bool ok = (one_of(cell_kind, alg_kind::vanilla_rnn,
+                               alg_kind::vanilla_lstm, alg_kind::vanilla_gru,
+                               alg_kind::vanilla_augru)
+                              || (one_of(cell_kind, alg_kind::lbr_gru,
+                                          alg_kind::lbr_augru)
+                                      && aprop == prop_kind::forward))
                     && IMPLICATION(aprop == prop_kind::forward,
                             one_of(this->desc()->prop_kind, forward_training,
                                     forward_inference))
@@ -300,6 +304,14 @@ struct _ref_rnn_common_t : public primitive_t {
                             && !rnn_.is_f32());
             if (!ok) return status::unimplemented;
 
+            // Int8 LBR GRU / AUGRU is not supported by any cell. The
+            // iteration part of the candidate gate is multiplied by the
+            // reset gate before it is added to the layer part, so the two
+            // s32 accumulators need separate dequantization and the
+            // iteration bias has to be added after it, which neither the
+            // reference nor the jit LBR postgemm implements.
+            if (rnn_.is_lbr && rnn_.is_int8()) return status::unimplemented;
+
             if (rnn_.is_f32()
                     && utils::one_of(this->desc()->prop_kind, backward,
                             forward_training))
@@ -550,7 +562,9 @@ struct _ref_rnn_common_t : public primitive_t {
                 break;
             case alg_kind::lbr_augru:
             case alg_kind::lbr_gru:
-                cell_func = &class_name::cell_execution_gru_lbr;
+                cell_func = (pd()->rnn_.is_brgemm)
+                        ? &class_name::cell_execution_brgemm_fwd
+                        : &class_name::cell_execution_gru_lbr;
                 break;
             default: break;
         }
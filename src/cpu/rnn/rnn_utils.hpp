@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -360,6 +361,10 @@ struct rnn_conf_t {
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
+    // Run the cells along the anti-diagonals of the layer x iteration grid
+    bool use_wavefront = false;
+    // Number of threads with own scratch buffers in the wavefront schedule
+    int wavefront_nthr = 0;
 
     inline bool is_int8() const {
         return is_signed_int8() || is_unsigned_int8();
@@ -833,6 +838,27 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.use_projection_packed_gemm = false;
 #endif
 
+    /* Decide to run the independent cells of the grid concurrently. With a
+     * small batch a single cell can not occupy all the threads, while all the
+     * cells on the same anti-diagonal of the layer x iteration grid can be
+     * computed at once. Each cell is then computed by a single thread, which
+     * requires the threads of a parallel region to run simultaneously and
+     * non-packed weights, as packed GEMM data depends on the threading.
+     * The threads that do not get a cell stay idle, so the schedule is only
+     * used when the widest anti-diagonal occupies at least half of them. */
+    const int max_nthr = dnnl_get_max_threads();
+    rnn.wavefront_nthr = nstl::min(
+            max_nthr, rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter));
+    rnn.use_wavefront = DNNL_THR_SYNC == 1 && !rnn.is_brgemm
+            && rd.prop_kind == prop_kind::forward_inference && rnn.mb <= 8
+            && rnn.wavefront_nthr > 1 && 2 * rnn.wavefront_nthr >= max_nthr
+            && !rnn.use_layer_packed_gemm
+            && !rnn.use_iter_packed_gemm && !rnn.use_projection_packed_gemm;
+    if (rnn.use_wavefront)
+        rnn.merge_gemm_layer = false;
+    else
+        rnn.wavefront_nthr = 1;
+
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
     const auto set_pack_sizes
@@ -1024,10 +1050,12 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
-    rnn.scratch_gates_size = rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld * sizeof(typename T::scratch_t);
-    rnn.scratch_ht_size
-            = rnn.scratch_ht_nld * rnn.scratch_ht_ld * sizeof(typename T::ht_t);
+    // The wavefront schedule uses a separate set of scratch buffers per thread
+    rnn.scratch_gates_size = rnn.wavefront_nthr * rnn.n_iter_scratch_gates
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld
+            * sizeof(typename T::scratch_t);
+    rnn.scratch_ht_size = rnn.wavefront_nthr * rnn.scratch_ht_nld
+            * rnn.scratch_ht_ld * sizeof(typename T::ht_t);
     rnn.scratch_diff_ht_size = rnn.is_training ? rnn.scratch_diff_ht_nld
                     * rnn.scratch_diff_ht_ld * sizeof(typename T::gemm_acc_t)
                                                : (size_t)0;
@@ -1043,6 +1071,7 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                                     * rnn.ws_states_layer_ld
                                     * sizeof(typename T::gemm_acc_t)
                             : 0);
+    rnn.scratch_cell_size *= rnn.wavefront_nthr;
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
             * sizeof(typename T::gemm_acc_t);
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -24,6 +24,7 @@
 
 #include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/cpu_engine.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/simple_layer_normalization.hpp"
 
@@ -53,6 +54,7 @@ template <data_type_t data_type>
 status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
         engine_t *engine) {
     using namespace data_type;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
     const memory_desc_wrapper src_d(src_md());
 
     const bool ok = is_fwd() && !has_zero_dim_memory()
@@ -63,7 +65,8 @@ status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
             && src_d.is_blocking_desc()
             && src_d.blocking_desc().strides[ndims() - 1]
                     == 1 // plain format, last logical dim is last physical
-            && attr()->has_default_values() && set_default_formats_common();
+            && attr()->has_default_values(skip_mask_t::oscale)
+            && attr_oscale_ok() && set_default_formats_common();
     if (!ok) return status::unimplemented;
 
     CHECK(fill_compatible_stats_md(*src_md(), reordered_stat_md_));
@@ -74,6 +77,7 @@ status_t simple_layer_normalization_fwd_t<data_type>::pd_t::init(
                 stats_are_src() ? &reordered_stat_md_ : stat_md()));
     }
 
+    init_nthr_c();
     init_scratchpad();
     return status::success;
 }
@@ -117,6 +121,15 @@ status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
 
+    if (pd()->nthr_c() > 1) {
+        float *reduction = pd()->stats_are_src()
+                ? nullptr
+                : scratchpad.template get<float>(key_lnorm_reduction);
+        execute_forward_split_c(
+                src, dst, scale, shift, mean, variance, reduction);
+        return status::success;
+    }
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
         balance211(N, nthr, ithr, N_start, N_end);
@@ -128,6 +141,95 @@ status_t simple_layer_normalization_fwd_t<data_type>::execute_forward(
     return status::success;
 }
 
+template <data_type_t data_type>
+void simple_layer_normalization_fwd_t<data_type>::execute_forward_split_c(
+        const data_t *src, data_t *dst, const float *scale, const float *shift,
+        float *mean, float *variance, float *reduction) const {
+    const bool with_scale = pd()->use_scaleshift() || pd()->use_scale();
+    const bool with_shift = pd()->use_scaleshift() || pd()->use_shift();
+    const bool calculate_stats = !pd()->stats_are_src();
+    const bool save_stats = pd()->is_training();
+    const float eps = pd()->desc()->layer_norm_epsilon;
+    const float output_scale = pd()->attr()->output_scales_.scales_[0];
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t N = pd()->across_axis();
+    const dim_t C = pd()->norm_axis();
+    const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const dim_t nthr_c = pd()->nthr_c();
+
+    // Each (row, slice) pair computes the mean and the sum of squared
+    // deviations (M2) of its slice using two passes over the slice.
+    if (calculate_stats) {
+        parallel_nd(N, nthr_c, [&](dim_t n, dim_t ithr_c) {
+            dim_t c_start = 0, c_end = 0;
+            balance211(C, nthr_c, ithr_c, c_start, c_end);
+            const data_t *s = &src[n * C_padded];
+
+            float v_mean = 0;
+            PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+            for (dim_t c = c_start; c < c_end; ++c)
+                v_mean += s[c];
+            v_mean /= nstl::max<dim_t>(c_end - c_start, 1);
+
+            float v_m2 = 0;
+            PRAGMA_OMP_SIMD(reduction(+ : v_m2))
+            for (dim_t c = c_start; c < c_end; ++c) {
+                const float m = s[c] - v_mean;
+                v_m2 += m * m;
+            }
+
+            float *r = &reduction[2 * (n * nthr_c + ithr_c)];
+            r[0] = v_mean;
+            r[1] = v_m2;
+        });
+    }
+
+    parallel_nd(N, nthr_c, [&](dim_t n, dim_t ithr_c) {
+        float v_mean = 0, v_variance = 0;
+        if (calculate_stats) {
+            // Merge partial statistics of all the slices of the row in the
+            // same order for every slice, so the results are consistent.
+            float v_m2 = 0;
+            dim_t count = 0;
+            for (dim_t i = 0; i < nthr_c; i++) {
+                dim_t c_start = 0, c_end = 0;
+                balance211(C, nthr_c, i, c_start, c_end);
+                const dim_t count_i = c_end - c_start;
+                if (count_i == 0) continue;
+                const float *r = &reduction[2 * (n * nthr_c + i)];
+                const dim_t count_new = count + count_i;
+                const float delta = r[0] - v_mean;
+                v_mean += delta * count_i / count_new;
+                v_m2 += r[1] + delta * delta * count * count_i / count_new;
+                count = count_new;
+            }
+            v_variance = v_m2 / C;
+            if (save_stats && ithr_c == 0) {
+                mean[n] = v_mean;
+                variance[n] = v_variance;
+            }
+        } else {
+            v_mean = mean[n];
+            v_variance = variance[n];
+        }
+
+        dim_t c_start = 0, c_end = 0;
+        balance211(C, nthr_c, ithr_c, c_start, c_end);
+        const data_t *s = &src[n * C_padded];
+        data_t *d = &dst[n * C_padded];
+        const float inv_sqrtvar = 1.f / sqrtf(v_variance + eps);
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = c_start; c < c_end; ++c) {
+            const float sm = (with_scale ? scale[c] : 1.f) * inv_sqrtvar;
+            const float sv = with_shift ? shift[c] : 0.f;
+            d[c] = saturate_and_round<data_t>(
+                    output_scale * (sm * (s[c] - v_mean) + sv));
+        }
+    });
+}
+
 template <data_type_t data_type>
 status_t simple_layer_normalization_bwd_t<data_type>::pd_t::init(
         engine_t *engine) {
@@ -257,6 +359,8 @@ status_t simple_layer_normalization_bwd_t<data_type>::execute_backward(
 
 template struct simple_layer_normalization_fwd_t<bf16>;
 template struct simple_layer_normalization_fwd_t<f32>;
+template struct simple_layer_normalization_fwd_t<s8>;
+template struct simple_layer_normalization_fwd_t<u8>;
 template struct simple_layer_normalization_bwd_t<bf16>;
 template struct simple_layer_normalization_bwd_t<f32>;
 
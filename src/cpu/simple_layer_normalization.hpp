@@ -52,10 +52,33 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 
         bool use_tmp_stats() const { return reorder_pd_ || stats_are_tmp(); }
 
+        // Number of threads sharing a single row. When there are fewer rows
+        // than threads, the normalized axis is split into nthr_c_ slices:
+        // partial statistics of the slices are merged and each slice is
+        // normalized independently.
+        int nthr_c() const { return nthr_c_; }
+
         std::shared_ptr<primitive_desc_t> reorder_pd_;
         memory_desc_t reordered_stat_md_;
 
     private:
+        // Minimal number of elements in a slice of the normalized axis
+        // processed by a single thread.
+        static constexpr dim_t min_c_per_thr_ = 256;
+
+        int nthr_c_ = 1;
+
+        void init_nthr_c() {
+            const int nthr = dnnl_get_max_threads();
+            const dim_t N = across_axis();
+            const dim_t C = norm_axis();
+            nthr_c_ = 1;
+            if (N >= nthr) return;
+            const dim_t nthr_c
+                    = nstl::min<dim_t>(nthr / N, C / min_c_per_thr_);
+            if (nthr_c > 1) nthr_c_ = static_cast<int>(nthr_c);
+        }
+
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
@@ -65,6 +88,11 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
                 scratchpad.template book<float>(
                         key_lnorm_tmp_var, across_axis());
             }
+            if (nthr_c_ > 1 && !stats_are_src()) {
+                // Partial mean and sum of squared deviations of each slice.
+                scratchpad.template book<float>(
+                        key_lnorm_reduction, 2 * across_axis() * nthr_c_);
+            }
             if (reordered_stat_md_ != *stat_md() && !stats_are_tmp()) {
                 scratchpad.book(key_nested, reorder_pd_->scratchpad_registry());
             }
@@ -133,6 +161,9 @@ struct simple_layer_normalization_fwd_t : public primitive_t {
 private:
     using data_t = typename prec_traits<data_type>::type;
     status_t execute_forward(const exec_ctx_t &ctx) const;
+    void execute_forward_split_c(const data_t *src, data_t *dst,
+            const float *scale, const float *shift, float *mean,
+            float *variance, float *reduction) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<lnorm_utils::stat_and_data_kernel_t<data_type>>
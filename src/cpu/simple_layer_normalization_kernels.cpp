@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
@@ -32,10 +33,10 @@ namespace lnorm_utils {
 
 using namespace data_type;
 
-template <>
-void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
-        const float *scale, const float *shift, float *mean, float *var,
-        const size_t block_size) const {
+template <data_type_t data_type>
+void stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
+        data_t *dst, const float *scale, const float *shift, float *mean,
+        float *var, const size_t block_size) const {
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
     for (size_t offset = 0; offset < block_size; offset++) {
@@ -67,14 +68,16 @@ void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
                 const float sm = scale[c] * inv_sqrtvar;
                 const float sv = shift[c];
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean) + sv;
+                dst[elem] = saturate_and_round<data_t>(
+                        output_scale_ * (sm * (src[elem] - v_mean) + sv));
             }
         } else if (use_scale_) {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = scale[c] * inv_sqrtvar;
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean);
+                dst[elem] = saturate_and_round<data_t>(
+                        output_scale_ * sm * (src[elem] - v_mean));
             }
         } else if (use_shift_) {
             PRAGMA_OMP_SIMD()
@@ -82,14 +85,16 @@ void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
                 const float sm = 1.0f * inv_sqrtvar;
                 const float sv = shift[c];
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean) + sv;
+                dst[elem] = saturate_and_round<data_t>(
+                        output_scale_ * (sm * (src[elem] - v_mean) + sv));
             }
         } else {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = 1.0f * inv_sqrtvar;
                 const size_t elem = c + C_ * offset;
-                dst[elem] = sm * (src[elem] - v_mean);
+                dst[elem] = saturate_and_round<data_t>(
+                        output_scale_ * sm * (src[elem] - v_mean));
             }
         }
         if (calculate_stats_ && save_stats_) {
@@ -252,6 +257,8 @@ template struct diff_ss_kernel_t<f32>;
 template struct diff_ss_kernel_t<bf16>;
 template struct stat_and_data_kernel_t<f32>;
 template struct stat_and_data_kernel_t<bf16>;
+template struct stat_and_data_kernel_t<s8>;
+template struct stat_and_data_kernel_t<u8>;
 template struct diff_data_kernel_t<f32>;
 template struct diff_data_kernel_t<bf16>;
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -45,7 +45,8 @@ protected:
         , use_shift_(pd->use_shift())
         , save_stats_(pd->is_training())
         , calculate_stats_(!pd->stats_are_src())
-        , eps_(pd->desc()->layer_norm_epsilon) {}
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , output_scale_(pd->attr()->output_scales_.scales_[0]) {}
 
     int C_;
     bool use_scaleshift_;
@@ -54,6 +55,7 @@ protected:
     bool save_stats_;
     bool calculate_stats_;
     const float eps_;
+    const float output_scale_;
 };
 
 template <data_type_t data_type>
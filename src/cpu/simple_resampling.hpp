@@ -66,6 +66,8 @@ struct simple_resampling_fwd_t : public primitive_t {
             const bool ok = is_fwd() && !has_zero_dim_memory()
                     && platform::has_data_type_support(src_md()->data_type)
                     && platform::has_data_type_support(dst_md()->data_type)
+                    && !utils::one_of(
+                            f16, src_md()->data_type, dst_md()->data_type)
                     && set_default_params() == status::success
                     && attr()->has_default_values(
                             sm::post_ops, dst_md()->data_type)
@@ -106,6 +108,8 @@ struct simple_resampling_bwd_t : public primitive_t {
             const bool ok = !is_fwd() && !has_zero_dim_memory()
                     && platform::has_data_type_support(diff_dst_md()->data_type)
                     && platform::has_data_type_support(diff_src_md()->data_type)
+                    && !utils::one_of(f16, diff_dst_md()->data_type,
+                            diff_src_md()->data_type)
                     && set_default_params() == status::success
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
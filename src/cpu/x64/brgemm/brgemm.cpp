@@ -150,6 +150,7 @@ bool can_dispatch_uker(const brgemm_t *brg) {
 void maybe_try_bf32(brgemm_t *brg) {
     const bool try_bf32 = brg->is_f32
             && brg->brgattr.fpmath_mode == fpmath_mode::bf16
+            && is_superset(brg->isa_impl, avx512_core)
             && mayiuse(avx512_core_bf16_amx_bf16);
     if (try_bf32) {
         const bool is_amx = brg->is_amx;
@@ -167,26 +168,33 @@ void maybe_try_bf32(brgemm_t *brg) {
 status_t brgemm_blocking(brgemm_t *brg) {
 
     if (!brg->is_amx) {
-        brg->ld_block = 16;
+        const bool is_avx512 = is_superset(brg->isa_impl, avx512_core);
+        brg->ld_block = is_avx512 ? 16 : 8;
         brg->ldb = brg->load_dim / brg->ld_block;
         brg->ldb_tail = brg->load_dim % brg->ld_block;
 
-        brg->ld_block2 = 4; // (M < 9) ? 2 : 4 | TODO - fix this for INT8
+        // (M < 9) ? 2 : 4 | TODO - fix this for INT8
+        // avx2 has only 16 vector registers: 3 loads leave room for a
+        // 4x3 accumulator block
+        brg->ld_block2 = is_avx512 ? 4 : 3;
         brg->ldb2 = brg->ldb / brg->ld_block2;
         brg->ldb2_tail = brg->ldb % brg->ld_block2;
 
         if (brg->ldb2 == 0) brg->ld_block2 = nstl::max(1, brg->ldb2_tail);
-        brg->embd_bcst = !brg->is_int8 && !brg->is_bf16
+        // embedded broadcast requires EVEX encoding
+        brg->embd_bcst = is_avx512 && !brg->is_int8 && !brg->is_bf16
                 && (brg->ldb2_tail <= 1 && brg->ldb2 == 0);
 
         int ld_block = (brg->ldb2 != 0) ? brg->ld_block2 : brg->ldb2_tail;
         int adj_ld_block = (ld_block == 0) ? (ld_block + 1) : ld_block;
 
-        const int max_avx512_regs = 32;
+        const int max_vregs = is_avx512
+                ? cpu_isa_traits<avx512_core>::n_vregs
+                : cpu_isa_traits<avx2>::n_vregs;
         const int max_bcst_regs = 1;
         const bool req_compensation = brg->req_s8s8_compensation
                 || brg->zp_type_a != brgemm_broadcast_t::none;
-        int max_regs = max_avx512_regs - (adj_ld_block + max_bcst_regs);
+        int max_regs = max_vregs - (adj_ld_block + max_bcst_regs);
         int max_block
                 = (brg->embd_bcst ? 28
                                   : ((brg->beta == 1.f || brg->beta == 0.f)
@@ -466,16 +474,22 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
     brg->dt_d = brg->dt_c;
     brg->dt_bias = brg->dt_c;
 
-    if (!IMPLICATION(brg->is_f32, mayiuse(avx512_core)))
+    // avx2 kernels are used when they are requested explicitly or when no
+    // avx512 kernel could be generated on the current machine
+    const bool use_avx2 = one_of(isa, avx2, avx2_vnni)
+            || (isa == isa_any && !mayiuse(avx512_core));
+    if (!IMPLICATION(brg->is_f32, mayiuse(use_avx2 ? avx2 : avx512_core)))
         return status::unimplemented;
-    if (!IMPLICATION(brg->is_bf16, mayiuse(avx512_core_bf16)))
+    if (!IMPLICATION(brg->is_bf16, !use_avx2 && mayiuse(avx512_core_bf16)))
         return status::unimplemented;
-    if (!IMPLICATION(brg->is_int8, mayiuse(avx512_core_vnni)))
+    if (!IMPLICATION(brg->is_int8,
+                mayiuse(use_avx2 ? avx2_vnni : avx512_core_vnni)))
         return status::unimplemented;
 
     if (isa != isa_any) {
-        if (!one_of(isa, avx512_core, avx512_core_bf16, avx512_core_vnni,
-                    avx512_core_bf16_amx_bf16, avx512_core_bf16_amx_int8)) {
+        if (!one_of(isa, avx2, avx2_vnni, avx512_core, avx512_core_bf16,
+                    avx512_core_vnni, avx512_core_bf16_amx_bf16,
+                    avx512_core_bf16_amx_int8)) {
             return status::invalid_arguments;
         }
         brg->is_int8_amx = brg->is_bf16_amx = false;
@@ -494,6 +508,16 @@ status_t brgemm_desc_init(brgemm_t *brg, cpu_isa_t isa,
         brg->is_bf16_amx = brg->is_bf16 && mayiuse(avx512_core_bf16_amx_bf16);
     }
     brg->is_amx = (brg->is_int8_amx || brg->is_bf16_amx);
+    if (brg->is_int8_amx)
+        brg->isa_impl = avx512_core_bf16_amx_int8;
+    else if (brg->is_bf16_amx)
+        brg->isa_impl = avx512_core_bf16_amx_bf16;
+    else if (brg->is_bf16)
+        brg->isa_impl = avx512_core_bf16;
+    else if (brg->is_int8)
+        brg->isa_impl = use_avx2 ? avx2_vnni : avx512_core_vnni;
+    else
+        brg->isa_impl = use_avx2 ? avx2 : avx512_core;
     brg->req_s8s8_compensation
             = brg->is_int8 && !brg->is_int8_amx && brg->dt_a == data_type::s8;
     brg->LDA = (is_row_major()) ? static_cast<int>(LDA) : static_cast<int>(LDB);
@@ -576,6 +600,7 @@ status_t brdgmm_desc_init(brgemm_t *brg, cpu_isa_t isa,
     if (!(is_superset(isa, req_isa) && mayiuse(req_isa)))
         return status::unimplemented;
 
+    brg->isa_impl = req_isa;
     brg->is_bf16_amx = brg->is_bf16 && mayiuse(avx512_core_bf16_amx_bf16);
     brg->is_dgmm = true;
     brg->type = type;
@@ -646,8 +671,12 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
     brg->dt_d = dt_d;
     brg->typesize_D = types::data_type_size(brg->dt_d);
 
-    if (!IMPLICATION(
-                brg->is_int8 && brg->dt_d == bf16, mayiuse(avx512_core_vnni)))
+    if (!IMPLICATION(brg->is_int8 && brg->dt_d == bf16,
+                is_superset(brg->isa_impl, avx512_core_vnni)))
+        return status::unimplemented;
+    // bf16 conversions are not available in avx2 kernels
+    if (!is_superset(brg->isa_impl, avx512_core)
+            && one_of(data_type::bf16, brg->dt_d, brg->dt_bias))
         return status::unimplemented;
 
     if (brg->is_int8 && brg->dt_d == bf16)
@@ -672,7 +701,9 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
 
     const int binary_ind = post_ops.find(primitive_kind::binary);
     brg->with_binary = binary_ind != -1;
-    const cpu_isa_t isa = get_max_cpu_isa();
+    const cpu_isa_t isa = is_superset(brg->isa_impl, avx512_core)
+            ? get_max_cpu_isa()
+            : avx2;
 
     if ((brg->with_binary && !dst_md)
             || !injector::post_ops_ok(
@@ -19,6 +19,7 @@
 
 #include "common/primitive_attr.hpp"
 #include "cpu/platform.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -166,6 +167,9 @@ struct brgemm_t {
     bool is_f32 = false;
     bool is_amx = false;
     bool is_bf32 = false;
+    // isa the kernel is generated for, it defines the vector register width
+    // and the number of available vector registers
+    cpu_isa_t isa_impl = isa_any;
 
     dim_t stride_a = 0; // Offset in bytes
     dim_t stride_b = 0;
@@ -265,7 +269,7 @@ struct brgemm_kernel_params_t {
     int32_t zp_a_val = 1;
 };
 
-struct jit_brgemm_kernel_t;
+struct jit_generator;
 struct jit_brgemm_amx_uker_base_t;
 struct jit_brdgmm_kernel_base_t;
 
@@ -284,7 +288,7 @@ struct brgemm_kernel_common_t : public brgemm_kernel_t {
     void operator()(brgemm_kernel_params_t *) const;
 
 private:
-    jit_brgemm_kernel_t *brgemm_kernel_ = nullptr;
+    jit_generator *brgemm_kernel_ = nullptr;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_kernel_common_t);
 };
@@ -14,7 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
 #if defined(_MSC_VER)
 #include <malloc.h>
 #endif
@@ -2012,6 +2017,176 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
     return gemm_threading_driver(&args);
 }
 
+// Splits nthrs threads of a problem of a group into a 2D grid keeping the
+// thread submatrices as square as possible.
+static inline void set_thread_opts_grouped(int nthrs, dim_t m, dim_t n,
+        const gemm_info_t<float, float, float> *arg,
+        gemm_threading_t &thread_info) {
+    const dim_t max_nthrs_m = utils::div_up(m, arg->um);
+    const dim_t max_nthrs_n = utils::div_up(n, arg->un);
+
+    int nthrs_m = 1, nthrs_n = 1;
+    dim_t best_imbalance = -1;
+    for (int nthr_m = 1; nthr_m <= nthrs; nthr_m++) {
+        if (nthrs % nthr_m != 0) continue;
+        int nthr_n = nthrs / nthr_m;
+        if (nthr_m > max_nthrs_m || nthr_n > max_nthrs_n) continue;
+
+        dim_t imbalance = nstl::abs(m * nthr_n - n * nthr_m);
+        if (best_imbalance < 0 || imbalance < best_imbalance) {
+            best_imbalance = imbalance;
+            nthrs_m = nthr_m;
+            nthrs_n = nthr_n;
+        }
+    }
+
+    thread_info.nthrs_m = nthrs_m;
+    thread_info.nthrs_n = nthrs_n;
+    thread_info.nthrs_k = 1;
+    thread_info.block_m = thread_info.block_n = thread_info.block_k = -1;
+    thread_info.thread_m = thread_info.thread_n = thread_info.thread_k = -1;
+    thread_info.partition = partition_type::col_major_2d;
+    thread_info.copy = copy_type::nonshared;
+}
+
+static dnnl_status_t sgemm_grouped_slice(const gemm_slice_t &slice,
+        bool use_nocopy, const gemm_info_t<float, float, float> *arg) {
+    const float *a = nullptr, *b = nullptr, *co = nullptr;
+    float *c = nullptr;
+    std::tie(a, b, c, co) = decompose_matrices(slice, arg);
+
+    auto m = slice.m, n = slice.n, k = slice.k;
+    if (m <= 0 || n <= 0) return dnnl_success;
+
+    // C = beta * C
+    if (k <= 0 || arg->alpha == 0.0f) {
+        for (dim_t j = 0; j < n; j++)
+            for (dim_t i = 0; i < m; i++) {
+                float &c_ij = c[i + j * arg->ldc];
+                c_ij = arg->beta == 0.0f ? 0.0f : arg->beta * c_ij;
+            }
+        return dnnl_success;
+    }
+
+    if (use_nocopy) {
+        auto transa = arg->transa == no_trans ? "N" : "T";
+        auto transb = arg->transb == no_trans ? "N" : "T";
+        if (mayiuse(avx512_core))
+            return avx512_common_gemm_f32::sgemm_nocopy_driver(transa, transb,
+                    m, n, k, &arg->alpha, a, arg->lda, b, arg->ldb, &arg->beta,
+                    c, arg->ldc, nullptr);
+        return avx_gemm_f32::sgemm_nocopy_driver(transa, transb, m, n, k,
+                &arg->alpha, a, arg->lda, b, arg->ldb, &arg->beta, c, arg->ldc,
+                nullptr);
+    }
+
+    return gemm_kernel_driver(0, m, n, k, a, b, arg->beta, c, arg->ldc,
+            offset_type::none, co, arg);
+}
+
+dnnl_status_t sgemm_grouped_driver(dim_t group_size, const char *transA,
+        const char *transB, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const float *const *a, const dim_t *lda,
+        const float *const *b, const dim_t *ldb, const float *beta,
+        float *const *c, const dim_t *ldc) {
+    assert(mayiuse(sse41));
+
+    // A slice of a problem of the group computed by a single thread.
+    struct task_t {
+        dim_t problem;
+        gemm_slice_t slice;
+        bool use_nocopy;
+        double cost;
+    };
+
+    std::vector<std::unique_ptr<gemm_info_t<float, float, float>>> args;
+    args.reserve(group_size);
+    double total_cost = 0;
+    for (dim_t p = 0; p < group_size; p++) {
+        args.emplace_back(new gemm_info_t<float, float, float>(&transA[p],
+                &transB[p], nullptr, &m[p], &n[p], &k[p], &alpha[p], a[p],
+                &lda[p], nullptr, b[p], &ldb[p], nullptr, &beta[p], c[p],
+                &ldc[p], nullptr, false, pack_type::none, nullptr, false));
+        if (!args.back()->hasKernels()) return dnnl_unimplemented;
+        // Problems with no multiplications still have to scale C.
+        total_cost += (double)m[p] * n[p] * nstl::max(k[p], dim_t(1));
+    }
+
+    const int nthr_max = dnnl_get_current_num_threads();
+
+    // Unlike gemm_threading_driver(), which spreads a single problem over all
+    // the threads, every problem gets the threads in proportion to its share
+    // of the group work. The slices of all the problems are then balanced
+    // over the threads of a single parallel region.
+    std::vector<task_t> tasks;
+    for (dim_t p = 0; p < group_size; p++) {
+        const auto *arg = args[p].get();
+        if (arg->m <= 0 || arg->n <= 0) continue;
+
+        const double cost = (double)arg->m * arg->n
+                * nstl::max(arg->k, dim_t(1));
+        int nthr = (int)nstl::max(1.0, nthr_max * cost / total_cost);
+        adjust_thread_count<float>(arg->m, arg->n, arg->k, &nthr);
+        nthr = nstl::min(nthr, nthr_max);
+
+        gemm_threading_t thread_info;
+        set_thread_opts_grouped(nthr, arg->m, arg->n, arg, thread_info);
+        const bool use_nocopy = nocopy_checker(thread_info.nthrs(), arg);
+
+        for (int ithr = 0; ithr < thread_info.nthrs(); ithr++) {
+            auto slice = thread_info.get_thread_slice(
+                    ithr, arg->m, arg->n, arg->k);
+            if (slice.m <= 0 || slice.n <= 0) continue;
+            tasks.push_back({p, slice, use_nocopy,
+                    (double)slice.m * slice.n
+                            * nstl::max(slice.k, dim_t(1))});
+        }
+    }
+
+    if (tasks.empty()) return dnnl_success;
+
+    // Assign the most expensive tasks first, each to the least loaded thread.
+    std::sort(tasks.begin(), tasks.end(),
+            [](const task_t &t1, const task_t &t2) {
+                return t1.cost > t2.cost;
+            });
+
+    const int nthr_goal = (int)nstl::min((dim_t)nthr_max, (dim_t)tasks.size());
+    using load_t = std::pair<double, int>;
+    std::priority_queue<load_t, std::vector<load_t>, std::greater<load_t>>
+            loads;
+    for (int ithr = 0; ithr < nthr_goal; ithr++)
+        loads.push({0.0, ithr});
+
+    std::vector<std::vector<dim_t>> thread_tasks(nthr_goal);
+    for (size_t t = 0; t < tasks.size(); t++) {
+        auto load = loads.top();
+        loads.pop();
+        thread_tasks[load.second].push_back(t);
+        loads.push({load.first + tasks[t].cost, load.second});
+    }
+
+    std::vector<dnnl_status_t> results(nthr_goal, dnnl_success);
+    parallel(nthr_goal, [&](int ithr, int nthr) {
+        for (; ithr < nthr_goal; ithr += nthr) {
+            for (auto t : thread_tasks[ithr]) {
+                const auto &task = tasks[t];
+                auto status = sgemm_grouped_slice(
+                        task.slice, task.use_nocopy, args[task.problem].get());
+                if (status != dnnl_success) results[ithr] = status;
+            }
+        }
+    });
+
+    for (auto status : results)
+        if (status != dnnl_success) return status;
+
+    for (dim_t p = 0; p < group_size; p++)
+        msan_unpoison_matrix(c[p], m[p], n[p], ldc[p], sizeof(float));
+
+    return dnnl_success;
+}
+
 template // Instantiate gemm_bf16bf16f32
         dnnl_status_t
         gemm_driver<bfloat16_t, bfloat16_t, float>(const char *transA,
@@ -38,6 +38,14 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
         const bool force_jit_nocopy_gemm, pack_type packing = pack_type::none,
         gemm_pack_storage_t *pack_dst = NULL, bool measure_only = false);
 
+// Computes a group of independent sgemm problems in a single parallel
+// region, all the arguments are arrays of group_size elements.
+dnnl_status_t sgemm_grouped_driver(dim_t group_size, const char *transA,
+        const char *transB, const dim_t *m, const dim_t *n, const dim_t *k,
+        const float *alpha, const float *const *a, const dim_t *lda,
+        const float *const *b, const dim_t *ldb, const float *beta,
+        float *const *c, const dim_t *ldc);
+
 void prep_ref_gemm_s8u8s32_pack(
         bool do_a, dim_t rows, dim_t cols, gemm_pack_storage_t *pack_dst);
 
@@ -38,7 +38,15 @@ static bcast_set_t get_all_strategies_supported_by_injector() {
 
 bool is_data_supported(cpu_isa_t isa, data_type_t data_type) {
     return IMPLICATION(
-            data_type == data_type::bf16, is_superset(isa, avx512_core));
+            utils::one_of(data_type, data_type::bf16, data_type::f16),
+            is_superset(isa, avx512_core));
+}
+
+// Returns the lower half of a vector register, which is the source operand
+// of f16 to f32 up-conversion
+static Xbyak::Xmm half_vmm(const Xbyak::Xmm &vmm) {
+    if (vmm.isZMM()) return Xbyak::Ymm(vmm.getIdx());
+    return Xbyak::Xmm(vmm.getIdx());
 }
 
 static bool src1_desc_layout_same_as_dst_d(
@@ -1505,8 +1513,8 @@ void jit_uni_binary_injector_t<isa, Vmm>::inject_binary(
             load_rhs(rhs_arg_data_type, tmp_vmm, rhs_addr, tail_load_mode,
                     with_tail);
 
-        if (rhs_arg_data_type != data_type::bf16
-                && rhs_arg_data_type != data_type::f32)
+        if (!utils::one_of(rhs_arg_data_type, data_type::bf16, data_type::f16,
+                    data_type::f32))
             cvt_to_f32(tmp_vmm);
 
         execute_binary(alg, dst, dst, tmp_vmm);
@@ -1599,6 +1607,12 @@ void jit_uni_binary_injector_t<isa, Vmm>::execute_broadcast_no_tail(
                 host_->vpslld(tmp_vmm, tmp_vmm, 0x10);
                 break;
             }
+        case data_type::f16:
+            if (is_avx512_) {
+                host_->vpbroadcastw(tmp_vmm, rhs_addr);
+                host_->vcvtph2ps(tmp_vmm, half_vmm(tmp_vmm));
+                break;
+            }
         default: assert(!"unsupported data type");
     }
 }
@@ -1735,6 +1749,13 @@ void jit_uni_binary_injector_t<isa, Vmm>::execute_broadcast_tail_with_opmask(
                         tmp_vmm | tail_opmask | host_->T_z, tmp_vmm, 0x10);
                 break;
             }
+        case data_type::f16:
+            if (is_avx512_) {
+                host_->vpbroadcastw(tmp_vmm, rhs_addr);
+                host_->vcvtph2ps(
+                        tmp_vmm | tail_opmask | host_->T_z, half_vmm(tmp_vmm));
+                break;
+            }
         default: assert(!"unsupported data type");
     }
 }
@@ -2006,6 +2027,11 @@ void jit_uni_binary_injector_t<isa, Vmm>::load_rhs_no_tail(
                 host_->vpslld(tmp_vmm, tmp_vmm, 0x10);
                 break;
             }
+        case data_type::f16:
+            if (is_avx512_) {
+                host_->vcvtph2ps(tmp_vmm, rhs_addr);
+                break;
+            }
         default: assert(!"unsupported data type");
     }
 }
@@ -2075,6 +2101,11 @@ void jit_uni_binary_injector_t<isa, Vmm>::load_rhs_tail_dynamically_with_opmask(
                         tmp_vmm | tail_opmask | host_->T_z, tmp_vmm, 0x10);
                 break;
             }
+        case data_type::f16:
+            if (is_avx512_) {
+                host_->vcvtph2ps(tmp_vmm | tail_opmask | host_->T_z, rhs_addr);
+                break;
+            }
         default: assert(!"unsupported data type");
     }
 }
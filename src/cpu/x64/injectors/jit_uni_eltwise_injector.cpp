@@ -46,6 +46,14 @@ bool is_alg_supported(alg_kind_t alg) {
             eltwise_exp_use_dst_for_bwd, eltwise_clip_v2_use_dst_for_bwd);
 }
 
+bool has_fast_approx(alg_kind_t alg) {
+    using namespace alg_kind;
+    return utils::one_of(alg, eltwise_exp, eltwise_exp_use_dst_for_bwd,
+            eltwise_logistic, eltwise_logistic_use_dst_for_bwd, eltwise_swish,
+            eltwise_tanh, eltwise_tanh_use_dst_for_bwd, eltwise_gelu_tanh,
+            eltwise_gelu_erf, eltwise_mish);
+}
+
 bool is_supported(cpu_isa_t isa, alg_kind_t alg) {
     return is_isa_supported(isa) && is_alg_supported(alg);
 }
@@ -253,6 +261,20 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::test_mask() {
     }
 }
 
+// Computes 1 / x with the hardware approximation refined by one Newton-Raphson
+// iteration: r' = r - r * (x * r - 1). vmm_src is overwritten.
+template <cpu_isa_t isa, typename Wmm>
+void jit_uni_eltwise_injector_f32<isa, Wmm>::rcp_compute_vector_fwd(
+        const Vmm &vmm_dst, const Vmm &vmm_src) {
+    if (is_avx512)
+        h->vrcp14ps(vmm_dst, vmm_src);
+    else
+        h->uni_vrcpps(vmm_dst, vmm_src);
+    h->uni_vfmsub213ps(vmm_src, vmm_dst, table_val(one));
+    h->uni_vmulps(vmm_src, vmm_src, vmm_dst);
+    h->uni_vsubps(vmm_dst, vmm_dst, vmm_src);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::exp_compute_vector_fwd(
         const Vmm &vmm_src) {
@@ -263,7 +285,10 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::exp_compute_vector_fwd(
     // get mask of values lower than log(FLT_MIN) to zero them in the output
     compute_cmp_mask(vmm_src, table_val(exp_ln_flt_min_f), _cmp_lt_os);
 
-    h->uni_vminps(vmm_src, vmm_src, table_val(exp_ln_flt_max_f));
+    // The fast polynomial is below 1 at r = 0, so the result overflows to inf
+    // for x > log(FLT_MAX) only with a larger bound
+    h->uni_vminps(vmm_src, vmm_src,
+            table_val(fast_approx_ ? exp_fast_ln_flt_max_f : exp_ln_flt_max_f));
     h->uni_vmaxps(vmm_src, vmm_src, table_val(exp_ln_flt_min_f));
     h->uni_vmovups(vmm_aux1, vmm_src);
 
@@ -306,12 +331,19 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::exp_compute_vector_fwd(
     blend_with_mask(vmm_aux2, vmm_src);
 
     // compute polynomial
-    h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 3));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 2));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 1));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 0));
-    h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(one));
+    if (fast_approx_) {
+        h->uni_vmovups(vmm_src, table_val(exp_fast_pol, 3));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_fast_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_fast_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_fast_pol, 0));
+    } else {
+        h->uni_vmovups(vmm_src, table_val(exp_pol, 4));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 3));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 2));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 1));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(exp_pol, 0));
+        h->uni_vfmadd213ps(vmm_src, vmm_aux1, table_val(one));
+    }
     // y = y * 2^n
     h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
     h->uni_vmulps(vmm_src, vmm_src, table_val(two));
@@ -352,6 +384,32 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::elu_compute_vector_fwd(
 template <cpu_isa_t isa, typename Wmm>
 void jit_uni_eltwise_injector_f32<isa, Wmm>::tanh_compute_vector_fwd(
         const Vmm &vmm_src) {
+    if (fast_approx_) {
+        // tanh(x) = x * P(x^2) / Q(x^2) on [-7, 7] and +/-1 beyond, a minimax
+        // rational approximation with relative error below 4e-5. It avoids
+        // the table gathers of the piecewise polynomials below.
+        h->uni_vminps(vmm_src, vmm_src, table_val(tanh_fast_ubound));
+        h->uni_vmaxps(vmm_src, vmm_src, table_val(tanh_fast_lbound));
+        h->uni_vmovups(vmm_aux1, vmm_src);
+        h->uni_vmulps(vmm_aux1, vmm_aux1, vmm_aux1);
+
+        // x * P(x^2)
+        h->uni_vmovups(vmm_aux2, table_val(tanh_fast_pol_num, 2));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_pol_num, 1));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_pol_num, 0));
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+
+        // Q(x^2)
+        h->uni_vmovups(vmm_aux2, table_val(tanh_fast_pol_den, 2));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_pol_den, 1));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(tanh_fast_pol_den, 0));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val(one));
+
+        rcp_compute_vector_fwd(vmm_aux1, vmm_aux2);
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+        return;
+    }
+
     // we add a check as the avx2 code cannot be used for avx
     assert(IMPLICATION(isa == avx2, mayiuse(avx2)));
 
@@ -560,6 +618,18 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::gelu_tanh_compute_vector_fwd(
     h->sub(h->rsp, vlen);
     h->uni_vmovups(h->ptr[h->rsp], vmm_aux0);
 
+    if (fast_approx_) {
+        // 0.5 * (1 + tanh(G(x))) = logistic(2 * G(x)), which does not lose
+        // accuracy to cancellation for negative x
+        h->uni_vmulps(vmm_src, vmm_src, table_val(two));
+        logistic_compute_vector_fwd(vmm_src);
+
+        h->uni_vmovups(vmm_aux0, h->ptr[h->rsp]);
+        h->add(h->rsp, vlen);
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux0);
+        return;
+    }
+
     // compute tanh(G(x))
     tanh_compute_vector_fwd(vmm_src);
 
@@ -637,6 +707,26 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::mish_compute_vector_fwd(
     // IMPORTANT: we use vmm_aux3 to save src as exp does not use it.
     h->uni_vmovups(vmm_aux3, vmm_src); // vmm_aux3 = x
 
+    if (fast_approx_) {
+        // mish(x) = x * n / (n + 2), where n = (e^x + 1)^2 - 1 = e^x(e^x + 2)
+        // does not lose accuracy to cancellation for negative x. The smaller
+        // bound keeps n + 2 within the range of the reciprocal approximation,
+        // mish(x) = x there anyway.
+        h->uni_vminps(
+                vmm_src, vmm_src, table_val(bwd_mish_max_x_for_equation_f));
+        exp_compute_vector_fwd(vmm_src);
+
+        h->uni_vmovups(vmm_aux1, vmm_src);
+        h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux1);
+        h->uni_vmovups(vmm_aux1, vmm_src);
+        h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(two));
+        rcp_compute_vector_fwd(vmm_aux2, vmm_aux1);
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux3);
+        return;
+    }
+
     h->uni_vminps(vmm_src, vmm_src, table_val(fwd_mish_max_x_for_equation_f));
     exp_compute_vector_fwd(vmm_src);
 
@@ -805,7 +895,12 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::logistic_compute_vector_fwd(
     // (exp(x) + 1)
     h->uni_vaddps(vmm_aux1, vmm_aux1, table_val(one));
     // y = exp(x) / (exp(x) + 1)
-    h->uni_vdivps(vmm_src, vmm_src, vmm_aux1);
+    if (fast_approx_) {
+        rcp_compute_vector_fwd(vmm_aux2, vmm_aux1);
+        h->uni_vmulps(vmm_src, vmm_src, vmm_aux2);
+    } else {
+        h->uni_vdivps(vmm_src, vmm_src, vmm_aux1);
+    }
 
     // Now we have to apply the "symmetry" based on original sign
     h->uni_vmovups(vmm_aux2, table_val(one));
@@ -1156,10 +1251,19 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::gelu_erf_compute_vector_fwd(
     abs_compute_vector_fwd(vmm_aux4);
 
     // t = 1 / (p*x + 1)
-    h->uni_vmovups(vmm_aux2, table_val(gelu_erf_approx_const));
-    h->uni_vfmadd213ps(vmm_aux2, vmm_aux4, table_val(one));
-    h->uni_vmovups(vmm_aux4, table_val(one));
-    h->uni_vdivps(vmm_aux4, vmm_aux4, vmm_aux2);
+    if (fast_approx_) {
+        // erf(x) = 1 long before the bound, which keeps p*x + 1 within the
+        // range of the reciprocal approximation
+        h->uni_vminps(vmm_aux4, vmm_aux4, table_val(exp_ln_flt_max_f));
+        h->uni_vmovups(vmm_aux2, table_val(gelu_erf_approx_const));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux4, table_val(one));
+        rcp_compute_vector_fwd(vmm_aux4, vmm_aux2);
+    } else {
+        h->uni_vmovups(vmm_aux2, table_val(gelu_erf_approx_const));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux4, table_val(one));
+        h->uni_vmovups(vmm_aux4, table_val(one));
+        h->uni_vdivps(vmm_aux4, vmm_aux4, vmm_aux2);
+    }
 
     // -exp(-x*x)
     h->uni_vmulps(vmm_src, vmm_src, vmm_src);
@@ -1873,6 +1977,16 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
             {exp_pol, {0x3c07cfce, true}} // p5 = 0.00828929059f
     };
 
+    // exp(x) polynomial approximation for accuracy_mode::fast, a degree 3
+    // minimax polynomial with relative error below 7.5e-5
+    static const table_t exp_fast_polynomial {
+            {exp_fast_ln_flt_max_f, {0x42b20000, true}}, // 89.f
+            {exp_fast_pol, {0x3f7ffb49, true}}, // p0 = 0.999928057f
+            {exp_fast_pol, {0x3f800561, true}}, // p1 = 1.00016415f
+            {exp_fast_pol, {0x3f014546, true}}, // p2 = 0.504963279f
+            {exp_fast_pol, {0x3e29a4fb, true}} // p3 = 0.165668413f
+    };
+
     // mish(x) constants
     static const table_t mish_consts {
             {fwd_mish_max_x_for_equation_f, {0x42317217, true}},
@@ -1884,6 +1998,18 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
             {tanh_linear_ubound, {0x39ddb3d7, true}},
             {tanh_saturation_lbound, {0x41102cb3, true}}};
 
+    // tanh(x) rational approximation for accuracy_mode::fast
+    static const table_t tanh_fast_consts {
+            {tanh_fast_ubound, {0x40e00000, true}},
+            {tanh_fast_lbound, {0xc0e00000, true}},
+            {tanh_fast_pol_num, {0x3f7ffdc4, true}}, // p0 = 0.999965906f
+            {tanh_fast_pol_num, {0x3de728f5, true}}, // p1 = 0.112871088f
+            {tanh_fast_pol_num, {0x3ab6a762, true}}, // p2 = 0.00139353820f
+            {tanh_fast_pol_den, {0x3ee465a6, true}}, // q1 = 0.446088016f
+            {tanh_fast_pol_den, {0x3c8a4b10, true}}, // q2 = 0.0168814957f
+            {tanh_fast_pol_den, {0x384ce6d5, true}} // q3 = 4.88523692e-05f
+    };
+
     // tanh(x) polynomial approximation
     // For each coefficient, there is 32 entries
     static const table_t tanh_polynomial_table {
@@ -2285,7 +2411,7 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
 
     // This object takes care about which constants and polynomials to include.
     struct need_t {
-        need_t(alg_kind_t alg) {
+        need_t(alg_kind_t alg, bool fast_approx) : fast_approx_(fast_approx) {
             using namespace alg_kind;
             switch (alg) {
                 case eltwise_elu_use_dst_for_bwd:
@@ -2317,10 +2443,15 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
         bool gelu_erf_ = false;
         bool log_ = false;
         bool hardswish_ = false;
+        // gelu_tanh is computed with logistic instead of tanh
+        const bool fast_approx_;
 
-        bool exp() const { return exp_ || soft_relu_ || gelu_erf_ || mish_; }
+        bool exp() const {
+            return exp_ || soft_relu_ || gelu_erf_ || mish_
+                    || (gelu_tanh_ && fast_approx_);
+        }
         bool mish() const { return mish_; }
-        bool tanh() const { return tanh_ || gelu_tanh_; }
+        bool tanh() const { return tanh_ || (gelu_tanh_ && !fast_approx_); }
         bool soft_relu() const { return soft_relu_; }
         bool gelu_tanh() const { return gelu_tanh_; }
         bool gelu_erf() const { return gelu_erf_; }
@@ -2328,7 +2459,7 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
         bool hardswish() const { return hardswish_; }
     };
 
-    need_t need(alg_);
+    need_t need(alg_, fast_approx_);
 
     auto push_arg_entry_of = [&](const key_t key, const table_entry_val_t val,
                                      const bool broadcast) {
@@ -2349,10 +2480,12 @@ void jit_uni_eltwise_injector_f32<isa, Wmm>::register_table_entries() {
     push_arg_entry_of(beta, float2int(beta_), true);
     push_entries_of(common_values);
     if (need.exp()) push_entries_of(exp_consts);
-    if (need.exp()) push_entries_of(exp_polynomial);
+    if (need.exp())
+        push_entries_of(fast_approx_ ? exp_fast_polynomial : exp_polynomial);
     if (need.mish()) push_entries_of(mish_consts);
-    if (need.tanh()) push_entries_of(tanh_consts);
-    if (need.tanh()) push_entries_of(tanh_polynomial_table);
+    if (need.tanh() && fast_approx_) push_entries_of(tanh_fast_consts);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_consts);
+    if (need.tanh() && !fast_approx_) push_entries_of(tanh_polynomial_table);
     if (need.soft_relu()) push_entries_of(soft_relu_consts);
     if (need.soft_relu()) push_entries_of(soft_relu_polynomial);
     if (need.gelu_tanh()) push_entries_of(gelu_tanh_consts);
@@ -73,6 +73,12 @@ bool is_alg_supported(alg_kind_t alg);
  */
 bool is_supported(cpu_isa_t isa, alg_kind_t alg);
 
+/*
+ * Checks if eltwise algorithm has a faster and less accurate forward
+ * implementation used under accuracy_mode::fast.
+ */
+bool has_fast_approx(alg_kind_t alg);
+
 } // namespace eltwise_injector
 
 template <cpu_isa_t isa, typename Wmm = typename cpu_isa_traits<isa>::Vmm>
@@ -91,6 +97,9 @@ struct jit_uni_eltwise_injector_f32 {
     //   - algorithm derivative.
     // use_dst - defines whether source or destination point is passed to alg
     //   code. Depends on algorithm. See `_use_dst_for_bwd` algs definition.
+    // The accuracy mode of the primitive being created (see
+    // get_accuracy_mode()) selects fast approximations for forward algorithms
+    // that have them.
     jit_uni_eltwise_injector_f32(jit_generator *host, alg_kind_t alg,
             float alpha, float beta, float scale, bool save_state = true,
             Xbyak::Reg64 p_table = Xbyak::util::rax,
@@ -108,7 +117,9 @@ struct jit_uni_eltwise_injector_f32 {
         , is_fwd_(is_fwd)
         , use_dst_(use_dst)
         , preserve_vmm_(preserve_vmm)
-        , preserve_p_table_(preserve_p_table) {
+        , preserve_p_table_(preserve_p_table)
+        , fast_approx_(is_fwd && get_accuracy_mode() == accuracy_mode::fast
+                  && eltwise_injector::has_fast_approx(alg)) {
         assert(eltwise_injector::is_supported(isa, alg_));
 
         register_table_entries();
@@ -145,6 +156,7 @@ private:
     const bool use_dst_;
     const bool preserve_vmm_;
     const bool preserve_p_table_;
+    const bool fast_approx_;
 
     Xbyak::Label l_table;
 
@@ -199,6 +211,7 @@ private:
             const Xbyak::Operand &compare_operand, int cmp_predicate);
     void blend_with_mask(const Vmm &vmm_dst, const Xbyak::Operand &src);
     void test_mask();
+    void rcp_compute_vector_fwd(const Vmm &vmm_dst, const Vmm &vmm_src);
 
     void exp_compute_vector_fwd(const Vmm &vmm_src);
     void relu_compute_vector_fwd(const Vmm &vmm_src);
@@ -267,6 +280,8 @@ private:
         exp_ln_flt_max_f, // logf(FLT_MAX) - max normal value
         exp_ln_flt_min_f, // logf(FLT_MIN) - min normal value
         exp_pol, // see correspondent table for float values
+        exp_fast_pol, // lower degree exp polynomial for accuracy_mode::fast
+        exp_fast_ln_flt_max_f, // 89.f - upper bound of fast exp argument
         // e^(2*x)+2*e^x+2 = FLT_MAX; x =~ 44.36141952603634
         fwd_mish_max_x_for_equation_f,
         // e^x(e^3x+4e^2x+e^x*(6+4*x)+4*(1+x)) = FLT_MAX; x =~ 22.18070976278534
@@ -276,6 +291,10 @@ private:
         tanh_linear_ubound, // arg below which tanh(x) = x
         tanh_saturation_lbound, // arg after which tanh(x) = 1.f
         tanh_pol_table, // table of polynomial coefficients
+        tanh_fast_ubound, // 7.f - arg after which fast tanh(x) is saturated
+        tanh_fast_lbound, // -7.f
+        tanh_fast_pol_num, // odd numerator of fast tanh rational approx
+        tanh_fast_pol_den, // even denominator of fast tanh rational approx
         soft_relu_one_twenty_six, // 126.f
         soft_relu_mantissa_sign_mask, // mask for mantissa bits and sign
         soft_relu_pol, // see correspondent table for float values
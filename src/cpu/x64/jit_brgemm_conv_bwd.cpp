@@ -104,25 +104,29 @@ status_t brgemm_convolution_bwd_t<isa>::pd_t::init(engine_t *engine) {
             && attr()->has_default_values() && !has_zero_dim_memory();
     if (!ok) return status::unimplemented;
 
-    convolution_desc_t fwd_conv_d = convolution_desc_t();
-    CHECK(fwd_conv_desc_create(&fwd_conv_d, desc()));
+    // Primitive descriptors read the op descriptor through op_desc_t, so the
+    // convolution descriptor is stored with the size of the whole union
+    union alignas(op_desc_t) {
+        convolution_desc_t conv_d;
+        char storage[sizeof(op_desc_t)];
+    } fwd_d = {convolution_desc_t()};
+    CHECK(fwd_conv_desc_create(&fwd_d.conv_d, desc()));
+    const auto *fwd_conv_d = reinterpret_cast<const op_desc_t *>(&fwd_d);
 
     primitive_desc_t *pd;
     do {
         // try creating fwd 1x1 conv prim desc
         using fwd_1x1_conv_pd_t =
                 typename brgemm_1x1_convolution_fwd_t<isa>::pd_t;
-        status_t s = primitive_desc_t::create<fwd_1x1_conv_pd_t>(&pd,
-                reinterpret_cast<const op_desc_t *>(&fwd_conv_d), attr(),
-                engine, nullptr);
+        status_t s = primitive_desc_t::create<fwd_1x1_conv_pd_t>(
+                &pd, fwd_conv_d, attr(), engine, nullptr);
         if (s == status::success) break;
         // try creating fwd conv prim desc
         constexpr bool use_inversion = true; // invert weights' spatial indices
         using fwd_conv_pd_t =
                 typename brgemm_convolution_fwd_t<isa, use_inversion>::pd_t;
-        CHECK(primitive_desc_t::create<fwd_conv_pd_t>(&pd,
-                reinterpret_cast<const op_desc_t *>(&fwd_conv_d), attr(),
-                engine, nullptr));
+        CHECK(primitive_desc_t::create<fwd_conv_pd_t>(
+                &pd, fwd_conv_d, attr(), engine, nullptr));
     } while (false);
     fwd_pd_.reset(pd);
 
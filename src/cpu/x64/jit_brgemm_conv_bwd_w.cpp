@@ -0,0 +1,428 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Copies rows [c_start, c_end) of a strided [w][ic] matrix into columns of a
+// row-major [ic][ld] matrix.
+template <typename data_t>
+void transpose_w_ic(data_t *tr, const data_t *src, dim_t src_w_stride,
+        int c_start, int c_end, int nic, int ld) {
+    for (int c = c_start; c < c_end; c++) {
+        const data_t *s = src + c * src_w_stride;
+        for (int ic = 0; ic < nic; ic++)
+            tr[ic * ld + c] = s[ic];
+    }
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::pd_t::init(engine_t *engine) {
+    const bool ok = is_bwd_w()
+            && set_default_alg_kind(alg_kind::convolution_direct)
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(brgemm_convolution_utils::init_conf_bwd_w(jcp_, isa, *desc(),
+            src_md_, diff_weights_md_, diff_bias_md_, diff_dst_md_,
+            dnnl_get_max_threads()));
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const int vM = i_M ? jcp_.M_tail : jcp_.M;
+        const int vN = i_N ? jcp_.N_tail : jcp_.N;
+        if (vM == 0 || vN == 0) continue;
+
+        brgemm_t &brg = brg_descs_[get_brg_idx(i_M, i_N)];
+        CHECK(brgemm_desc_init(&brg, isa, jcp_.brg_type, jcp_.src_dt,
+                jcp_.dst_dt, false, false, brgemm_row_major, 1.f, 1.f,
+                jcp_.LDA, jcp_.LDB, jcp_.LDC, vM, vN, jcp_.K));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = jcp_.gemm_batch_size;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    auto scratchpad = scratchpad_registry().registrar();
+    brgemm_convolution_utils::init_scratchpad_bwd_w(scratchpad, jcp_);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_convolution_bwd_weights_t<isa>::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const int vM = i_M ? jcp.M_tail : jcp.M;
+        const int vN = i_N ? jcp.N_tail : jcp.N;
+        if (vM == 0 || vN == 0) continue;
+
+        const int idx = pd_t::get_brg_idx(i_M, i_N);
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_descs_[idx]));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+
+    if (jcp.nthr_mb > 1) {
+        CHECK(safe_ptr_assign(
+                acc_ker_, new cpu_accumulator_1d_t<data_type::f32>()));
+        CHECK(acc_ker_->create_kernel());
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+struct brgemm_convolution_bwd_weights_t<isa>::thread_info_t {
+    const char *src = nullptr;
+    const char *diff_dst = nullptr;
+    char *diff_weights = nullptr;
+    char *diff_bias = nullptr;
+
+    char *tr_src = nullptr;
+    char *tr_diff_dst = nullptr;
+    // The input row held by every slot of the tr_src ring, -1 if none
+    dim_t *tr_src_rows = nullptr;
+    // f32 accumulators of the minibatch slice of this thread
+    float *wei_acc = nullptr;
+    float *bia_acc = nullptr;
+
+    const memory_tracking::grantor_t scratchpad;
+
+    int ithr;
+    int ithr_mb, ithr_wei;
+    int mb_start = 0, mb_end = 0;
+    int wei_start = 0, wei_end = 0;
+
+    thread_info_t(const brgemm_convolution_bwd_weights_t *self,
+            const exec_ctx_t &ctx, int ithr)
+        : scratchpad(ctx.get_scratchpad_grantor()), ithr(ithr) {
+        const auto &jcp = self->pd()->jcp_;
+
+        src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+        diff_dst = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_DST);
+        diff_weights = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_WEIGHTS);
+        diff_bias = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_BIAS);
+
+        tr_src = scratchpad.template get<char>(key_conv_tr_src)
+                + ithr * jcp.tr_src_buffer_size * jcp.src_dsz;
+        tr_src_rows = scratchpad.template get<dim_t>(key_conv_tr_src_rows)
+                + ithr * jcp.tr_src_num_rows;
+        if (jcp.tr_diff_dst_buffer_size > 0)
+            tr_diff_dst = scratchpad.template get<char>(key_conv_tr_diff_dst)
+                    + ithr * jcp.tr_diff_dst_buffer_size * jcp.dst_dsz;
+
+        const int nthr_wei = jcp.nthr / jcp.nthr_mb;
+        ithr_mb = ithr / nthr_wei;
+        ithr_wei = ithr % nthr_wei;
+
+        balance211(jcp.mb, jcp.nthr_mb, ithr_mb, mb_start, mb_end);
+        const int wei_work = jcp.ngroups * jcp.nb_ic * jcp.nb_oc;
+        balance211(wei_work, nthr_wei, ithr_wei, wei_start, wei_end);
+
+        const dim_t wei_size = (dim_t)jcp.ngroups * jcp.kd * jcp.kh * jcp.kw
+                * jcp.ic * jcp.oc;
+        const int wei_buf_idx = ithr_mb - (jcp.wei_dt == f32);
+        wei_acc = wei_buf_idx < 0
+                ? (float *)diff_weights
+                : scratchpad.template get<float>(key_conv_wei_reduction)
+                        + wei_buf_idx * wei_size;
+        if (jcp.with_bias)
+            bia_acc = scratchpad.template get<float>(key_conv_bia_reduction)
+                    + ithr_mb * jcp.ngroups * jcp.oc;
+    }
+};
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::transpose_src_row(
+        const thread_info_t *ti, const char *src_row, char *tr_src,
+        int cur_ic) const {
+    const auto &jcp = pd()->jcp_;
+    const dim_t src_w_stride = (dim_t)jcp.stride_w * jcp.ngroups * jcp.ic;
+
+    // Phase p holds the columns iw = c * stride_w + p - l_pad. Columns which
+    // fall into the padding stay zero.
+    for (int p = 0; p < jcp.stride_w; p++) {
+        bool phase_used = false;
+        for (int kw = 0; kw < jcp.kw; kw++)
+            phase_used = phase_used
+                    || (kw * (jcp.dilate_w + 1)) % jcp.stride_w == p;
+        if (!phase_used) continue;
+
+        const int lo = jcp.l_pad - p;
+        const int hi = jcp.iw - 1 + jcp.l_pad - p;
+        const int c_start = lo > 0 ? div_up(lo, jcp.stride_w) : 0;
+        const int c_end
+                = hi >= 0 ? nstl::min(jcp.LDA, hi / jcp.stride_w + 1) : 0;
+        if (c_start >= c_end) continue;
+
+        const dim_t src_off = (dim_t)(p - jcp.l_pad) * jcp.ngroups * jcp.ic;
+        const dim_t tr_off = (dim_t)p * jcp.ic_block * jcp.LDA;
+        if (jcp.src_dt == bf16)
+            transpose_w_ic((uint16_t *)tr_src + tr_off,
+                    (const uint16_t *)src_row + src_off, src_w_stride,
+                    c_start, c_end, cur_ic, jcp.LDA);
+        else
+            transpose_w_ic((float *)tr_src + tr_off,
+                    (const float *)src_row + src_off, src_w_stride, c_start,
+                    c_end, cur_ic, jcp.LDA);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::transpose_diff_dst_row_to_vnni(
+        const char *diff_dst_row, char *tr_diff_dst, int cur_oc) const {
+    const auto &jcp = pd()->jcp_;
+    const dim_t ow_stride = (dim_t)jcp.ngroups * jcp.oc;
+    const auto row = (const uint16_t *)diff_dst_row;
+    auto tr = (uint16_t *)tr_diff_dst;
+
+    for (int ow = 0; ow < jcp.K; ow += 2) {
+        uint16_t *tr_ow = tr + ow * jcp.oc_block;
+        const uint16_t *r0 = row + ow * ow_stride;
+        if (ow + 1 < jcp.ow) {
+            const uint16_t *r1 = r0 + ow_stride;
+            for (int oc = 0; oc < cur_oc; oc++) {
+                tr_ow[2 * oc] = r0[oc];
+                tr_ow[2 * oc + 1] = r1[oc];
+            }
+        } else {
+            for (int oc = 0; oc < cur_oc; oc++) {
+                tr_ow[2 * oc] = r0[oc];
+                tr_ow[2 * oc + 1] = 0;
+            }
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::compute_diff_weights_and_bias(
+        const thread_info_t *ti) const {
+    const auto &jcp = pd()->jcp_;
+    const bool is_bf16 = jcp.src_dt == bf16;
+    const int ks = jcp.kd * jcp.kh * jcp.kw;
+    const dim_t src_c = (dim_t)jcp.ngroups * jcp.ic;
+    const dim_t dst_c = (dim_t)jcp.ngroups * jcp.oc;
+
+    const auto wei_off = [&](int g, int k, int ic, int oc) {
+        return (((dim_t)g * ks + k) * jcp.ic + ic) * jcp.oc + oc;
+    };
+
+    const int ext_kd = calculate_extended_filter_size(jcp.kd, jcp.dilate_d);
+    const int ext_kh = calculate_extended_filter_size(jcp.kh, jcp.dilate_h);
+    // Slot of the transposed src ring which holds the input row (id, ih),
+    // see init_conf_bwd_w() for the ring size
+    const auto tr_src_slot = [&](int id, int ih) {
+        return jcp.kd == 1 ? ih % ext_kh : (id % ext_kd) * jcp.ih + ih;
+    };
+    dim_t *tr_src_rows = ti->tr_src_rows;
+
+    // Padded columns of the transposed src are never written, so the buffer
+    // is zeroed once. Rows beyond an ic tail are not read by brgemm.
+    utils::array_set(ti->tr_src, 0, jcp.tr_src_buffer_size * jcp.src_dsz);
+
+    brgemm_batch_element_t batch;
+
+    int g {0}, icb {0}, ocb {0};
+    nd_iterator_init(
+            ti->wei_start, g, jcp.ngroups, icb, jcp.nb_ic, ocb, jcp.nb_oc);
+    for (int w = ti->wei_start; w < ti->wei_end; w++) {
+        const int ic = icb * jcp.ic_block;
+        const int oc = ocb * jcp.oc_block;
+        const bool is_ic_tail = jcp.ic - ic < jcp.ic_block;
+        const bool is_oc_tail = jcp.oc - oc < jcp.oc_block;
+        const int cur_ic = is_ic_tail ? jcp.M_tail : jcp.M;
+        const int cur_oc = is_oc_tail ? jcp.N_tail : jcp.N;
+        const bool do_bias = jcp.with_bias && icb == 0;
+        const auto brg_kernel
+                = brg_kernels_[pd_t::get_brg_idx(is_ic_tail, is_oc_tail)]
+                          .get();
+
+        for_(int k = 0; k < ks; k++)
+        for (int i = 0; i < cur_ic; i++)
+            utils::array_set(
+                    ti->wei_acc + wei_off(g, k, ic + i, oc), 0, cur_oc);
+        if (do_bias)
+            utils::array_set(ti->bia_acc + g * jcp.oc + oc, 0, cur_oc);
+        utils::array_set(tr_src_rows, -1, jcp.tr_src_num_rows);
+
+        for_(int mb = ti->mb_start; mb < ti->mb_end; mb++)
+        for_(int od = 0; od < jcp.od; od++)
+        for (int oh = 0; oh < jcp.oh; oh++) {
+            const dim_t dst_row_off
+                    = (((dim_t)mb * jcp.od + od) * jcp.oh + oh) * jcp.ow
+                            * dst_c
+                    + g * jcp.oc + oc;
+            const char *diff_dst_row
+                    = ti->diff_dst + dst_row_off * jcp.dst_dsz;
+
+            if (do_bias) {
+                float *bia = ti->bia_acc + g * jcp.oc + oc;
+                for (int ow = 0; ow < jcp.ow; ow++) {
+                    if (is_bf16) {
+                        const auto d = (const bfloat16_t *)diff_dst_row
+                                + ow * dst_c;
+                        PRAGMA_OMP_SIMD()
+                        for (int o = 0; o < cur_oc; o++)
+                            bia[o] += (float)d[o];
+                    } else {
+                        const auto d
+                                = (const float *)diff_dst_row + ow * dst_c;
+                        PRAGMA_OMP_SIMD()
+                        for (int o = 0; o < cur_oc; o++)
+                            bia[o] += d[o];
+                    }
+                }
+            }
+
+            if (is_bf16)
+                transpose_diff_dst_row_to_vnni(
+                        diff_dst_row, ti->tr_diff_dst, cur_oc);
+            batch.ptr.B = is_bf16 ? ti->tr_diff_dst : diff_dst_row;
+
+            for (int kd = 0; kd < jcp.kd; kd++) {
+                const int id = od * jcp.stride_d - jcp.f_pad
+                        + kd * (jcp.dilate_d + 1);
+                if (id < 0 || id >= jcp.id) continue;
+                for (int kh = 0; kh < jcp.kh; kh++) {
+                    const int ih = oh * jcp.stride_h - jcp.t_pad
+                            + kh * (jcp.dilate_h + 1);
+                    if (ih < 0 || ih >= jcp.ih) continue;
+
+                    const dim_t src_row = ((dim_t)mb * jcp.id + id) * jcp.ih
+                            + ih;
+                    const int slot = tr_src_slot(id, ih);
+                    char *tr_src_row = ti->tr_src
+                            + slot * jcp.tr_src_row_size * jcp.src_dsz;
+                    if (tr_src_rows[slot] != src_row) {
+                        const dim_t src_row_off
+                                = src_row * jcp.iw * src_c + g * jcp.ic + ic;
+                        transpose_src_row(ti,
+                                ti->src + src_row_off * jcp.src_dsz,
+                                tr_src_row, cur_ic);
+                        tr_src_rows[slot] = src_row;
+                    }
+
+                    for (int kw = 0; kw < jcp.kw; kw++) {
+                        const int shift = kw * (jcp.dilate_w + 1);
+                        const dim_t tr_off = (dim_t)(shift % jcp.stride_w)
+                                        * jcp.ic_block * jcp.LDA
+                                + shift / jcp.stride_w;
+                        batch.ptr.A = tr_src_row + tr_off * jcp.src_dsz;
+                        const int k = (kd * jcp.kh + kh) * jcp.kw + kw;
+                        brgemm_kernel_execute(brg_kernel, 1, &batch,
+                                ti->wei_acc + wei_off(g, k, ic, oc));
+                    }
+                }
+            }
+        }
+        nd_iterator_step(g, jcp.ngroups, icb, jcp.nb_ic, ocb, jcp.nb_oc);
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<
+        isa>::reduce_and_convert_diff_weights_and_bias(const thread_info_t *ti)
+        const {
+    const auto &jcp = pd()->jcp_;
+    const bool is_bf16_wei = jcp.wei_dt == bf16;
+
+    if (jcp.nthr_mb > 1 || is_bf16_wei) {
+        const dim_t wei_size = (dim_t)jcp.ngroups * jcp.kd * jcp.kh * jcp.kw
+                * jcp.ic * jcp.oc;
+        float *wei_reduction
+                = ti->scratchpad.template get<float>(key_conv_wei_reduction);
+        float *wei_reduced
+                = is_bf16_wei ? wei_reduction : (float *)ti->diff_weights;
+
+        dim_t start {0}, end {0};
+        balance211(wei_size, jcp.nthr, ti->ithr, start, end);
+        if (start < end) {
+            for (int ir = 1; ir < jcp.nthr_mb; ir++) {
+                const float *wei_to_reduce
+                        = wei_reduction + (ir - !is_bf16_wei) * wei_size;
+                acc_ker_->accumulate(wei_reduced + start,
+                        wei_to_reduce + start, end - start);
+            }
+            if (is_bf16_wei)
+                cvt_float_to_bfloat16((bfloat16_t *)ti->diff_weights + start,
+                        wei_reduced + start, end - start);
+        }
+    }
+
+    if (jcp.with_bias) {
+        const int bia_size = jcp.ngroups * jcp.oc;
+        const float *bia_reduction
+                = ti->scratchpad.template get<float>(key_conv_bia_reduction);
+
+        int start {0}, end {0};
+        balance211(bia_size, jcp.nthr, ti->ithr, start, end);
+        for (int i = start; i < end; i++) {
+            float sum = 0.f;
+            for (int ir = 0; ir < jcp.nthr_mb; ir++)
+                sum += bia_reduction[ir * bia_size + i];
+            if (jcp.bia_dt == bf16)
+                ((bfloat16_t *)ti->diff_bias)[i] = sum;
+            else
+                ((float *)ti->diff_bias)[i] = sum;
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void brgemm_convolution_bwd_weights_t<isa>::execute_backward_weights(
+        const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        thread_info_t thread_info(this, ctx, ithr);
+        compute_diff_weights_and_bias(&thread_info);
+    });
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        thread_info_t thread_info(this, ctx, ithr);
+        reduce_and_convert_diff_weights_and_bias(&thread_info);
+    });
+}
+
+template struct brgemm_convolution_bwd_weights_t<avx512_core>;
+template struct brgemm_convolution_bwd_weights_t<avx512_core_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
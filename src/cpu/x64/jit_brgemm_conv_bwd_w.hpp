@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_CONV_BWD_W_HPP
+#define CPU_X64_JIT_BRGEMM_CONV_BWD_W_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_reducer.hpp"
+#include "cpu/x64/jit_brgemm_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+template <cpu_isa_t isa>
+struct brgemm_convolution_bwd_weights_t : public primitive_t {
+
+    struct pd_t : public cpu_convolution_bwd_weights_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::hint_class *hint_fwd_pd)
+            : cpu_convolution_bwd_weights_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgconv_bwd_w:", isa, ""),
+                brgemm_convolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        static int get_brg_idx(bool is_M_tail, bool is_N_tail) {
+            return 2 * is_M_tail + is_N_tail;
+        }
+
+        jit_brgemm_conv_conf_t jcp_;
+        brgemm_t brg_descs_[4];
+    };
+
+    brgemm_convolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {}
+
+    ~brgemm_convolution_bwd_weights_t() = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward_weights(ctx);
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    struct thread_info_t;
+
+    void execute_backward_weights(const exec_ctx_t &ctx) const;
+    void compute_diff_weights_and_bias(const thread_info_t *ti) const;
+    void reduce_and_convert_diff_weights_and_bias(
+            const thread_info_t *ti) const;
+
+    void transpose_src_row(const thread_info_t *ti, const char *src_row,
+            char *tr_src, int cur_ic) const;
+    void transpose_diff_dst_row_to_vnni(
+            const char *diff_dst_row, char *tr_diff_dst, int cur_oc) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+    std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
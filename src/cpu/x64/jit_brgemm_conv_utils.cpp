@@ -2185,6 +2185,142 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     return status::success;
 }
 
+status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
+        memory_desc_t &diff_dst_md, int nthreads) {
+    if (!mayiuse(isa) || is_amx(isa)) return status::unimplemented;
+
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper diff_weights_d(&diff_weights_md);
+    const memory_desc_wrapper diff_dst_d(&diff_dst_md);
+
+    const bool with_groups = diff_weights_d.ndims() == src_d.ndims() + 1;
+    const int ndims = src_d.ndims();
+
+    jcp = zero<decltype(jcp)>();
+    jcp.isa = isa;
+    jcp.ndims = ndims;
+    jcp.prop_kind = cd.prop_kind;
+    jcp.ngroups = with_groups ? diff_weights_d.dims()[0] : 1;
+    jcp.mb = src_d.dims()[0];
+    jcp.oc_without_padding = diff_dst_d.dims()[1];
+    jcp.oc = jcp.oc_without_padding / jcp.ngroups;
+    jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
+    jcp.ic = jcp.ic_without_padding;
+    jcp.id = (ndims == 5) ? src_d.dims()[2] : 1;
+    jcp.ih = (ndims == 3) ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = (ndims == 5) ? diff_dst_d.dims()[2] : 1;
+    jcp.oh = (ndims == 3) ? 1 : diff_dst_d.dims()[ndims - 2];
+    jcp.ow = diff_dst_d.dims()[ndims - 1];
+    jcp.kd = (ndims == 5) ? diff_weights_d.dims()[with_groups + 2] : 1;
+    jcp.kh = (ndims == 3) ? 1 : diff_weights_d.dims()[with_groups + ndims - 2];
+    jcp.kw = diff_weights_d.dims()[with_groups + ndims - 1];
+    jcp.f_pad = (ndims == 5) ? cd.padding[0][0] : 0;
+    jcp.t_pad = (ndims == 3) ? 0 : cd.padding[0][ndims - 4];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.stride_d = (ndims == 5) ? cd.strides[0] : 1;
+    jcp.stride_h = (ndims == 3) ? 1 : cd.strides[ndims - 4];
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.dilate_d = (ndims == 5) ? cd.dilates[0] : 0;
+    jcp.dilate_h = (ndims == 3) ? 0 : cd.dilates[ndims - 4];
+    jcp.dilate_w = cd.dilates[ndims - 3];
+    jcp.os = jcp.od * jcp.oh * jcp.ow;
+
+    jcp.ext_kw = calculate_extended_filter_size(jcp.kw, jcp.dilate_w);
+
+    jcp.with_bias = cd.diff_bias_desc.format_kind != format_kind::undef;
+
+    jcp.src_dt = cd.src_desc.data_type;
+    jcp.dst_dt = cd.diff_dst_desc.data_type;
+    jcp.wei_dt = cd.diff_weights_desc.data_type;
+    jcp.bia_dt = jcp.with_bias ? cd.diff_bias_desc.data_type : data_type::undef;
+    jcp.acc_dt = f32;
+
+    const bool is_bf16 = jcp.src_dt == bf16;
+    const bool dt_ok = is_bf16
+            ? jcp.dst_dt == bf16 && one_of(jcp.wei_dt, f32, bf16)
+                    && IMPLICATION(jcp.with_bias, one_of(jcp.bia_dt, f32, bf16))
+                    && mayiuse(avx512_core_bf16)
+            : everyone_is(f32, jcp.src_dt, jcp.dst_dt, jcp.wei_dt)
+                    && IMPLICATION(jcp.with_bias, jcp.bia_dt == f32);
+    if (!dt_ok) return status::unimplemented;
+
+    // depthwise convolutions have dedicated implementations
+    const bool is_depthwise
+            = with_groups && jcp.ngroups > 1 && everyone_is(1, jcp.ic, jcp.oc);
+    if (is_depthwise) return status::unimplemented;
+
+    jcp.src_dsz = types::data_type_size(jcp.src_dt);
+    jcp.wei_dsz = types::data_type_size(jcp.wei_dt);
+    jcp.dst_dsz = types::data_type_size(jcp.dst_dt);
+    jcp.acc_dsz = types::data_type_size(jcp.acc_dt);
+    jcp.bia_dsz = jcp.with_bias ? types::data_type_size(jcp.bia_dt) : 0;
+    jcp.simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+
+    // Activations are read in place, so they have to be in a channels-last
+    // layout. Diff weights are produced in a plain [g][spatial][ic][oc]
+    // layout, which makes a row of a brgemm C matrix contiguous.
+    const format_tag_t dat_tag = pick(ndims - 3, nwc, nhwc, ndhwc);
+    const format_tag_t wei_tag = with_groups
+            ? pick(ndims - 3, gwio, ghwio, gdhwio)
+            : pick(ndims - 3, wio, hwio, dhwio);
+    CHECK(init_tag(jcp.src_tag, src_md, src_d, dat_tag, false));
+    CHECK(init_tag(jcp.dst_tag, diff_dst_md, diff_dst_d, dat_tag, false));
+    CHECK(init_tag(jcp.wei_tag, diff_weights_md, diff_weights_d, wei_tag,
+            true));
+    if (jcp.with_bias && diff_bias_md.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md, x));
+
+    // For every filter tap diff_weights[ic][oc] += src^T[ic][ow] * diff_dst
+    // [ow][oc]: M is ic, N is oc and the reduction K runs over an output row.
+    // The src row is transposed into a buffer split into stride_w phases, so
+    // every tap reads a contiguous range of a phase with padding as zeros.
+    jcp.ic_block = nstl::min(jcp.ic, 64);
+    jcp.nb_ic = div_up(jcp.ic, jcp.ic_block);
+    jcp.oc_block = nstl::min(jcp.oc, 64);
+    jcp.nb_oc = div_up(jcp.oc, jcp.oc_block);
+
+    jcp.M = jcp.ic_block;
+    jcp.M_tail = jcp.ic % jcp.ic_block;
+    jcp.N = jcp.oc_block;
+    jcp.N_tail = jcp.oc % jcp.oc_block;
+    // bf16 brgemm reduces over pairs of rows of B in vnni layout
+    jcp.K = is_bf16 ? rnd_up(jcp.ow, 2) : jcp.ow;
+    jcp.K_tail = 0;
+
+    jcp.LDA = (jcp.ext_kw - 1) / jcp.stride_w + jcp.K;
+    // f32 diff_dst is used as B directly, bf16 one is reordered to vnni
+    jcp.LDB = is_bf16 ? jcp.oc_block : jcp.ngroups * jcp.oc;
+    jcp.LDC = jcp.oc;
+    jcp.brg_type = brgemm_addr;
+    jcp.gemm_batch_size = 1;
+    jcp.adjusted_batch_size = 1;
+
+    // Transposed src rows are kept in a per-thread ring, so that every src
+    // row is transposed once per minibatch and diff_weights block. Output
+    // rows sweep the input rows in order within a depth slice: ext_kh rows
+    // cover the filter window in 2D, and whole input planes are kept in 3D,
+    // where the next depth slice reuses the planes.
+    const int ext_kd = calculate_extended_filter_size(jcp.kd, jcp.dilate_d);
+    const int ext_kh = calculate_extended_filter_size(jcp.kh, jcp.dilate_h);
+    jcp.tr_src_num_rows = jcp.kd == 1 ? nstl::min(ext_kh, jcp.ih)
+                                      : nstl::min(ext_kd, jcp.id) * jcp.ih;
+    jcp.tr_src_row_size = (dim_t)jcp.stride_w * jcp.ic_block * jcp.LDA;
+    jcp.tr_src_buffer_size = jcp.tr_src_num_rows * jcp.tr_src_row_size;
+    jcp.tr_diff_dst_buffer_size = is_bf16 ? (dim_t)jcp.K * jcp.oc_block : 0;
+
+    // Threads are split between diff_weights blocks first. The remaining
+    // threads split the minibatch and accumulate into thread-local copies of
+    // diff_weights, which are reduced at the end.
+    const int wei_work = jcp.ngroups * jcp.nb_ic * jcp.nb_oc;
+    jcp.nthr_mb = nstl::max(1, nstl::min(jcp.mb, nthreads / wei_work));
+    jcp.nthr = jcp.nthr_mb * nstl::min(wei_work, nthreads / jcp.nthr_mb);
+
+    return status::success;
+}
+
 void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp) {
     // ensure buffers for individual threads do not lie on same page and also
     // they are not contiguous.
@@ -2227,6 +2363,30 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
     }
 }
 
+void init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_conv_conf_t &jcp) {
+    scratchpad.book(key_conv_tr_src, jcp.nthr * jcp.tr_src_buffer_size,
+            jcp.src_dsz, 0, P4K);
+    scratchpad.book<dim_t>(
+            key_conv_tr_src_rows, (dim_t)jcp.nthr * jcp.tr_src_num_rows);
+    if (jcp.tr_diff_dst_buffer_size > 0)
+        scratchpad.book(key_conv_tr_diff_dst,
+                jcp.nthr * jcp.tr_diff_dst_buffer_size, jcp.dst_dsz, 0, P4K);
+
+    // f32 diff_weights accumulate directly into the output for the first
+    // minibatch slice
+    const dim_t wei_size = (dim_t)jcp.ngroups * jcp.kd * jcp.kh * jcp.kw
+            * jcp.ic * jcp.oc;
+    const int num_wei_buffers = jcp.nthr_mb - (jcp.wei_dt == f32);
+    if (num_wei_buffers > 0)
+        scratchpad.book(key_conv_wei_reduction, num_wei_buffers * wei_size,
+                jcp.acc_dsz, 0, P4K);
+    if (jcp.with_bias)
+        scratchpad.book(key_conv_bia_reduction,
+                (dim_t)jcp.nthr_mb * jcp.ngroups * jcp.oc, jcp.acc_dsz, 0,
+                P4K);
+}
+
 } // namespace brgemm_convolution_utils
 
 } // namespace x64
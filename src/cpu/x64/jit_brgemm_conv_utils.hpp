@@ -49,11 +49,19 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
         memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads);
 
+status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
+        const convolution_desc_t &cd, memory_desc_t &src_md,
+        memory_desc_t &diff_weights_md, memory_desc_t &diff_bias_md,
+        memory_desc_t &diff_dst_md, int nthreads);
+
 void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp);
 
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const jit_brgemm_conv_conf_t &jcp);
 
+void init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
+        const jit_brgemm_conv_conf_t &jcp);
+
 } // namespace brgemm_convolution_utils
 
 } // namespace x64
@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_deconv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+status_t fwd_conv_desc_create(const deconvolution_desc_t *fwd_deconv_d,
+        convolution_desc_t *fwd_conv_d) {
+    // deconvolution weights are already laid out as OC x IC, so they are
+    // passed as is; spatial inversion is handled by inverting indices
+    // on-the-fly
+    const memory_desc_t &fwd_weights_md = fwd_deconv_d->weights_desc;
+
+    // create a fwd convolution descriptor with padding adjusted
+    // to the perspective of backward propagation, namely:
+    // - left padding replaced by left overflow
+    // - right padding replaced by right overflow
+    const int ndims_spatial = fwd_deconv_d->dst_desc.ndims - 2;
+    dims_t overflow_l;
+    dims_t overflow_r;
+    dim_t ks = 1;
+    for (int i = 0; i < ndims_spatial; i++) {
+        // only unit strides are allowed for deconv-to-conv conversion
+        if (fwd_deconv_d->strides[i] != 1) return status::unimplemented;
+        const dim_t K
+                = fwd_weights_md.dims[fwd_weights_md.ndims - ndims_spatial + i];
+        ks *= K;
+        const dim_t D = fwd_deconv_d->dilates[i];
+        const dim_t PL = fwd_deconv_d->padding[0][i]; // left padding
+        const dim_t PR = fwd_deconv_d->padding[1][i]; // right padding
+        constexpr dim_t S = 1;
+        // the following relations hold for unit stride only
+        overflow_l[i] = ((K - 1) * (D + 1) - PL) / S;
+        overflow_r[i] = ((K - 1) * (D + 1) - PR) / S;
+    }
+
+    CHECK(conv_desc_init(fwd_conv_d, prop_kind::forward_training,
+            alg_kind::convolution_direct, &fwd_deconv_d->src_desc,
+            &fwd_weights_md, &fwd_deconv_d->bias_desc, &fwd_deconv_d->dst_desc,
+            fwd_deconv_d->strides, fwd_deconv_d->dilates, overflow_l,
+            overflow_r));
+
+    // HACK: Set diff_src_desc and diff_dst_desc as a signal to the primitive
+    //       descriptor cache that we are using the bwd-via-fwd version of
+    //       fwd conv and thus need a separate cache entry. See the same hack
+    //       in jit_brgemm_conv_bwd.cpp.
+    const bool with_spatial_inversion = ks > 1;
+    if (with_spatial_inversion) {
+        fwd_conv_d->diff_src_desc = fwd_conv_d->src_desc;
+        fwd_conv_d->diff_dst_desc = fwd_conv_d->dst_desc;
+    }
+    return status::success;
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace utils;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = desc()->src_desc.data_type;
+    const auto dst_type = desc()->dst_desc.data_type;
+
+    const bool ok = is_fwd()
+            && desc()->alg_kind == alg_kind::deconvolution_direct
+            && one_of(src_type, f32, bf16)
+            // The deconvolution list is shared by all data types, pick the
+            // isa the convolution list uses for each of them
+            && IMPLICATION(src_type == f32, isa == avx512_core)
+            && IMPLICATION(src_type == bf16,
+                    one_of(isa, avx512_core_bf16, avx512_core_bf16_amx_bf16))
+            && attr()->has_default_values(
+                    skip_mask_t::post_ops | skip_mask_t::sum_dt, dst_type)
+            && attr()->post_ops_.check_sum_consistent_dt(dst_type)
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // Primitive descriptors read the op descriptor through op_desc_t, so the
+    // convolution descriptor is stored with the size of the whole union
+    union alignas(op_desc_t) {
+        convolution_desc_t conv_d;
+        char storage[sizeof(op_desc_t)];
+    } fwd_d = {convolution_desc_t()};
+    CHECK(fwd_conv_desc_create(desc(), &fwd_d.conv_d));
+    const auto *conv_d = reinterpret_cast<const op_desc_t *>(&fwd_d);
+
+    primitive_desc_t *pd;
+    do {
+        // try creating fwd 1x1 conv prim desc
+        using fwd_1x1_conv_pd_t =
+                typename brgemm_1x1_convolution_fwd_t<isa>::pd_t;
+        status_t s = primitive_desc_t::create<fwd_1x1_conv_pd_t>(
+                &pd, conv_d, attr(), engine, nullptr);
+        if (s == status::success) break;
+        // try creating fwd conv prim desc
+        constexpr bool use_inversion = true; // invert weights' spatial indices
+        using fwd_conv_pd_t =
+                typename brgemm_convolution_fwd_t<isa, use_inversion>::pd_t;
+        CHECK(primitive_desc_t::create<fwd_conv_pd_t>(
+                &pd, conv_d, attr(), engine, nullptr));
+    } while (false);
+    conv_pd_.reset(pd);
+
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = *conv_pd_->weights_md();
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->src_md();
+    if (dst_md_.format_kind == format_kind::any)
+        dst_md_ = *conv_pd_->dst_md();
+    if (bias_md_.format_kind == format_kind::any)
+        bias_md_ = *conv_pd_->weights_md(1);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+
+    return attr_.set_default_formats(dst_md(0));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    // fwd deconvolution and fwd convolution share argument names, including
+    // the binary post-ops ones
+    exec_args_t conv_args(ctx.args());
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, memory_tracking::names::key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+template struct brgemm_deconvolution_fwd_t<avx512_core>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16_amx_bf16>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,617 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+namespace sdpa_impl {
+
+// Computes the unnormalized probabilities of a score tile row by row:
+// probs[r][:] = exp(scores[r][:] - max[r]) and sum[r] = sum(probs[r][:]).
+// Rows are k_blk elements long, k_blk being a multiple of the vector length.
+template <cpu_isa_t isa>
+struct jit_sdpa_exp_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sdpa_exp_kernel_t)
+
+    struct call_params_t {
+        const float *scores;
+        void *probs;
+        const float *max;
+        float *sum;
+        size_t nrows;
+    };
+
+    jit_sdpa_exp_kernel_t(dim_t k_blk, data_type_t probs_dt)
+        : jit_generator(jit_name())
+        , k_blk_(k_blk)
+        , probs_dt_(probs_dt)
+        , probs_dt_size_(types::data_type_size(probs_dt)) {
+        assert(k_blk_ % simd_w_ == 0);
+    }
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    // Injector auxiliary registers take the lowest indices
+    static constexpr int vmm_data_start_idx_ = 4;
+    static constexpr int max_unroll_ = 4;
+
+    const dim_t k_blk_;
+    const data_type_t probs_dt_;
+    const size_t probs_dt_size_;
+
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_table = rax;
+    Reg64 reg_scores = r8;
+    Reg64 reg_probs = r9;
+    Reg64 reg_max = r10;
+    Reg64 reg_sum = r11;
+    Reg64 reg_nrows = r12;
+
+    Vmm vmm_max = Vmm(12);
+    Vmm vmm_sum = Vmm(13);
+    Vmm vmm_tmp = Vmm(14);
+
+    Vmm vmm_data(int i) { return Vmm(vmm_data_start_idx_ + i); }
+
+    void store_probs(int i, dim_t off) {
+        const auto addr = ptr[reg_probs + off * probs_dt_size_];
+        if (probs_dt_ == bf16) {
+            const Ymm ymm_cvt = Ymm(vmm_data(i).getIdx());
+            vcvtneps2bf16(ymm_cvt, vmm_data(i));
+            vmovdqu16(addr, ymm_cvt);
+        } else
+            uni_vmovups(addr, vmm_data(i));
+    }
+
+    // Horizontal sum of vmm_sum into the first element of its Xmm
+    void reduce_sum() {
+        const Xmm xmm_sum = Xmm(vmm_sum.getIdx());
+        const Xmm xmm_tmp = Xmm(vmm_tmp.getIdx());
+        if (is_superset(isa, avx512_core)) {
+            const Ymm ymm_sum = Ymm(vmm_sum.getIdx());
+            const Ymm ymm_tmp = Ymm(vmm_tmp.getIdx());
+            vextractf64x4(ymm_tmp, Zmm(vmm_sum.getIdx()), 1);
+            vaddps(ymm_sum, ymm_sum, ymm_tmp);
+        }
+        vextractf128(xmm_tmp, Ymm(vmm_sum.getIdx()), 1);
+        vaddps(xmm_sum, xmm_sum, xmm_tmp);
+        vhaddps(xmm_sum, xmm_sum, xmm_sum);
+        vhaddps(xmm_sum, xmm_sum, xmm_sum);
+    }
+
+    void generate() override {
+        // The kernel has no state to preserve around the injector calls
+        exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_exp, 0.f, 0.f, 1.f, false, reg_table));
+
+        preamble();
+        exp_injector_->load_table_addr();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_scores, ptr[reg_param + PARAM_OFF(scores)]);
+        mov(reg_probs, ptr[reg_param + PARAM_OFF(probs)]);
+        mov(reg_max, ptr[reg_param + PARAM_OFF(max)]);
+        mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+#undef PARAM_OFF
+
+        Label l_row_loop, l_end;
+        L(l_row_loop);
+        {
+            cmp(reg_nrows, 0);
+            je(l_end, T_NEAR);
+
+            uni_vbroadcastss(vmm_max, ptr[reg_max]);
+            uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+            const dim_t nvecs = k_blk_ / simd_w_;
+            for (dim_t v0 = 0; v0 < nvecs; v0 += max_unroll_) {
+                const int unroll
+                        = (int)nstl::min<dim_t>(max_unroll_, nvecs - v0);
+                for (int i = 0; i < unroll; i++) {
+                    const dim_t off = (v0 + i) * simd_w_;
+                    uni_vmovups(vmm_data(i),
+                            ptr[reg_scores + off * sizeof(float)]);
+                    uni_vsubps(vmm_data(i), vmm_data(i), vmm_max);
+                }
+                exp_injector_->compute_vector_range(
+                        vmm_data_start_idx_, vmm_data_start_idx_ + unroll);
+                for (int i = 0; i < unroll; i++) {
+                    uni_vaddps(vmm_sum, vmm_sum, vmm_data(i));
+                    store_probs(i, (v0 + i) * simd_w_);
+                }
+            }
+
+            reduce_sum();
+            vmovss(ptr[reg_sum], Xmm(vmm_sum.getIdx()));
+
+            add(reg_scores, k_blk_ * sizeof(float));
+            add(reg_probs, k_blk_ * probs_dt_size_);
+            add(reg_max, sizeof(float));
+            add(reg_sum, sizeof(float));
+            dec(reg_nrows);
+            jmp(l_row_loop, T_NEAR);
+        }
+        L(l_end);
+
+        postamble();
+        exp_injector_->prepare_table();
+    }
+};
+
+namespace {
+
+// Checks the inner [S, D] matrix is row major, leading dimensions may have
+// arbitrary strides
+bool is_row_major(const memory_desc_wrapper &mdw) {
+    if (!mdw.is_blocking_desc()) return false;
+    const auto &bd = mdw.blocking_desc();
+    return bd.inner_nblks == 0 && bd.strides[mdw.ndims() - 1] == 1;
+}
+
+// Offset of the [S, D] matrix of the problem `mb`. Dimensions of size 1
+// are broadcast, which matters for the attention mask only.
+dim_t batch_offset(
+        const memory_desc_wrapper &mdw, const dims_t problem_dims, dim_t mb) {
+    const auto &strides = mdw.blocking_desc().strides;
+    dim_t off = mdw.offset0();
+    for (int d = mdw.ndims() - 3; d >= 0; d--) {
+        const dim_t idx = mb % problem_dims[d];
+        mb /= problem_dims[d];
+        if (mdw.dims()[d] != 1) off += idx * strides[d];
+    }
+    return off;
+}
+
+inline float load_float(data_type_t dt, const void *ptr, dim_t idx) {
+    return dt == f32 ? static_cast<const float *>(ptr)[idx]
+                     : io::load_float_value(dt, ptr, idx);
+}
+
+} // namespace
+} // namespace sdpa_impl
+
+using namespace sdpa_impl;
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    const bool is_bf16 = isa == avx512_core_bf16;
+
+    const auto q_dt = src_md(0)->data_type;
+    const auto k_dt = src_md(1)->data_type;
+    const auto v_dt = src_md(2)->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    const bool dt_ok = is_bf16
+            ? everyone_is(bf16, q_dt, k_dt, v_dt)
+            : one_of(q_dt, f32, s8, u8) && one_of(k_dt, f32, s8, u8)
+                    && one_of(v_dt, f32, s8, u8);
+
+    bool ok = mayiuse(isa) && dt_ok && one_of(dst_dt, f32, bf16, s8, u8)
+            && platform::has_data_type_support(dst_dt)
+            && IMPLICATION(with_mask_buffer(),
+                    one_of(src_md(3)->data_type, f32, bf16))
+            && attr()->has_default_values()
+            && set_default_params() == status::success
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf());
+
+    const auto &c = conf_;
+    for_(int is_pv = 0; is_pv < 2; is_pv++)
+    for (int is_tail = 0; is_tail < 2; is_tail++) {
+        if (is_tail && c.q_tail == 0) continue;
+        const dim_t M = is_tail ? c.q_tail : c.q_blk;
+        brgemm_t &brg = brg_descs_[get_brg_kernel_idx(is_pv, is_tail)];
+        if (is_pv) {
+            // acc[M][Dv] += probs[M][k_blk] * values[k_blk][Dv]
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.cdt, c.cdt, false,
+                    false, brgemm_row_major, 1.f, 1.f, c.k_blk, c.Dv, c.Dv, M,
+                    c.Dv, c.k_blk));
+        } else {
+            // scores[M][k_blk] = queries[M][D] * keys^T[D][k_blk]
+            const dim_t LDA = c.q_in_place ? c.q_ld : c.D;
+            CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.cdt, c.cdt, false,
+                    false, brgemm_row_major, 1.f, 0.f, LDA, c.k_blk, c.k_blk,
+                    M, c.k_blk, c.D));
+        }
+    }
+
+    init_scratchpad();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::pd_t::init_conf() {
+    const memory_desc_wrapper q_d(src_md(0));
+    const memory_desc_wrapper k_d(src_md(1));
+    const memory_desc_wrapper v_d(src_md(2));
+    const memory_desc_wrapper mask_d(src_md(3));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    if (!is_row_major(q_d) || !is_row_major(k_d) || !is_row_major(v_d)
+            || !is_row_major(dst_d)
+            || (with_mask_buffer() && !is_row_major(mask_d)))
+        return status::unimplemented;
+
+    auto &c = conf_;
+    c.q_dt = q_d.data_type();
+    c.k_dt = k_d.data_type();
+    c.v_dt = v_d.data_type();
+    c.mask_dt = with_mask_buffer() ? mask_d.data_type() : data_type::undef;
+    c.dst_dt = dst_d.data_type();
+    c.cdt = isa == avx512_core_bf16 ? bf16 : f32;
+
+    c.ndims = ndims();
+    c.MB = batch();
+    c.Sq = queries();
+    c.Sk = keys();
+    c.D = head_size();
+    c.Dv = values_head_size();
+    c.scale = desc()->scale;
+    c.with_mask_buffer = with_mask_buffer();
+    c.with_causal_mask = with_causal_mask();
+
+    // VNNI layout of bf16 operands packs pairs of rows along the reduction
+    // dimension, the queries are not padded
+    if (c.cdt == bf16 && c.D % 2 != 0) return status::unimplemented;
+
+    c.q_in_place = c.q_dt == c.cdt;
+    const int ld_dim = c.ndims - 2;
+    c.q_ld = q_d.blocking_desc().strides[ld_dim];
+    c.k_ld = k_d.blocking_desc().strides[ld_dim];
+    c.v_ld = v_d.blocking_desc().strides[ld_dim];
+    c.mask_ld = with_mask_buffer() ? mask_d.blocking_desc().strides[ld_dim] : 0;
+    c.dst_ld = dst_d.blocking_desc().strides[ld_dim];
+
+    const dim_t max_q_blk = 32;
+    const dim_t max_k_blk = 64;
+    c.q_blk = nstl::min(max_q_blk, c.Sq);
+    c.nb_q = div_up(c.Sq, c.q_blk);
+    c.q_tail = c.Sq % c.q_blk;
+    c.k_blk = nstl::min(max_k_blk, rnd_up(c.Sk, 16));
+    c.nb_k = div_up(c.Sk, c.k_blk);
+
+    c.nthr = dnnl_get_max_threads();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_fwd_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    const auto &c = conf_;
+    const size_t cdt_size = types::data_type_size(c.cdt);
+    const size_t nthr = c.nthr;
+
+    // Keys and values of a problem are packed once per thread and reused for
+    // all its query blocks, the rest are the buffers of a query block.
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_sdpa_keys, nthr * c.nb_k * c.k_blk * c.D, cdt_size);
+    scratchpad.book(key_sdpa_values, nthr * c.nb_k * c.k_blk * c.Dv, cdt_size);
+    if (!c.q_in_place)
+        scratchpad.template book<float>(key_sdpa_queries, nthr * c.q_blk * c.D);
+    scratchpad.template book<float>(key_sdpa_scores, nthr * c.q_blk * c.k_blk);
+    scratchpad.book(key_sdpa_probs, nthr * c.q_blk * c.k_blk, cdt_size);
+    scratchpad.template book<float>(key_sdpa_acc, nthr * c.q_blk * c.Dv);
+    scratchpad.template book<float>(key_sdpa_stats, nthr * 4 * c.q_blk);
+}
+
+template <cpu_isa_t isa>
+brgemm_sdpa_fwd_t<isa>::brgemm_sdpa_fwd_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+brgemm_sdpa_fwd_t<isa>::~brgemm_sdpa_fwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::init(engine_t *engine) {
+    const auto &c = pd()->conf_;
+    for_(int is_pv = 0; is_pv < 2; is_pv++)
+    for (int is_tail = 0; is_tail < 2; is_tail++) {
+        if (is_tail && c.q_tail == 0) continue;
+        const int idx = pd_t::get_brg_kernel_idx(is_pv, is_tail);
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+    }
+
+    CHECK(safe_ptr_assign(
+            exp_kernel_, new jit_sdpa_exp_kernel_t<isa>(c.k_blk, c.cdt)));
+    return exp_kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_fwd_t<isa>::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto &c = pd()->conf_;
+
+    auto q = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    auto k = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    auto v = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    auto mask = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper q_d(pd()->src_md(0));
+    const memory_desc_wrapper k_d(pd()->src_md(1));
+    const memory_desc_wrapper v_d(pd()->src_md(2));
+    const memory_desc_wrapper mask_d(pd()->src_md(3));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto &problem_dims = q_d.dims();
+
+    const size_t cdt_size = types::data_type_size(c.cdt);
+    const size_t q_dt_size = types::data_type_size(c.q_dt);
+    const size_t k_dt_size = types::data_type_size(c.k_dt);
+    const size_t v_dt_size = types::data_type_size(c.v_dt);
+    const size_t dst_dt_size = types::data_type_size(c.dst_dt);
+    const bool is_bf16 = c.cdt == bf16;
+
+    const dim_t keys_sz = c.nb_k * c.k_blk * c.D;
+    const dim_t values_sz = c.nb_k * c.k_blk * c.Dv;
+    const dim_t tile_sz = c.q_blk * c.k_blk;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto keys_base = scratchpad.template get<char>(key_sdpa_keys);
+    auto values_base = scratchpad.template get<char>(key_sdpa_values);
+    auto queries_base = scratchpad.template get<float>(key_sdpa_queries);
+    auto scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    auto probs_base = scratchpad.template get<char>(key_sdpa_probs);
+    auto acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    auto stats_base = scratchpad.template get<float>(key_sdpa_stats);
+
+    // Keys are packed transposed, [nb_k][D][k_blk], values as is,
+    // [nb_k][k_blk][Dv]. In case of bf16 pairs of rows along the reduction
+    // dimension are interleaved (VNNI layout). Keys beyond Sk are zeroed.
+    auto pack_keys_values = [&](dim_t mb, char *keys, char *values) {
+        const dim_t k_off = batch_offset(k_d, problem_dims, mb);
+        const dim_t v_off = batch_offset(v_d, problem_dims, mb);
+        for (dim_t j = 0; j < c.nb_k * c.k_blk; j++) {
+            const dim_t kb = j / c.k_blk, jj = j % c.k_blk;
+            const bool is_pad = j >= c.Sk;
+            const char *k_row
+                    = is_pad ? nullptr : k + (k_off + j * c.k_ld) * k_dt_size;
+            const char *v_row
+                    = is_pad ? nullptr : v + (v_off + j * c.v_ld) * v_dt_size;
+            if (is_bf16) {
+                auto kp = reinterpret_cast<bfloat16_t *>(keys)
+                        + kb * c.k_blk * c.D + jj * 2;
+                auto vp = reinterpret_cast<bfloat16_t *>(values)
+                        + kb * c.k_blk * c.Dv + (jj / 2) * c.Dv * 2 + jj % 2;
+                auto k_src = reinterpret_cast<const bfloat16_t *>(k_row);
+                auto v_src = reinterpret_cast<const bfloat16_t *>(v_row);
+                for (dim_t d = 0; d < c.D; d++)
+                    kp[(d / 2) * c.k_blk * 2 + d % 2]
+                            = is_pad ? bfloat16_t(0.f) : k_src[d];
+                for (dim_t dv = 0; dv < c.Dv; dv++)
+                    vp[dv * 2] = is_pad ? bfloat16_t(0.f) : v_src[dv];
+            } else {
+                auto kp = reinterpret_cast<float *>(keys) + kb * c.k_blk * c.D
+                        + jj;
+                auto vp = reinterpret_cast<float *>(values)
+                        + kb * c.k_blk * c.Dv + jj * c.Dv;
+                for (dim_t d = 0; d < c.D; d++)
+                    kp[d * c.k_blk]
+                            = is_pad ? 0.f : load_float(c.k_dt, k_row, d);
+                for (dim_t dv = 0; dv < c.Dv; dv++)
+                    vp[dv] = is_pad ? 0.f : load_float(c.v_dt, v_row, dv);
+            }
+        }
+    };
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(c.MB * c.nb_q, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *keys = keys_base + ithr * keys_sz * cdt_size;
+        char *values = values_base + ithr * values_sz * cdt_size;
+        float *queries = c.q_in_place ? nullptr
+                                      : queries_base + ithr * c.q_blk * c.D;
+        float *scores = scores_base + ithr * tile_sz;
+        char *probs = probs_base + ithr * tile_sz * cdt_size;
+        float *acc = acc_base + ithr * c.q_blk * c.Dv;
+        float *row_max = stats_base + ithr * 4 * c.q_blk;
+        float *row_denom = row_max + c.q_blk;
+        float *row_corr = row_denom + c.q_blk;
+        float *row_sum = row_corr + c.q_blk;
+
+        brgemm_batch_element_t brg_batch;
+        dim_t packed_mb = -1;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t mb = iwork / c.nb_q;
+            const dim_t i0 = (iwork % c.nb_q) * c.q_blk;
+            const dim_t M = nstl::min(c.q_blk, c.Sq - i0);
+            const bool is_tail = M < c.q_blk;
+
+            if (mb != packed_mb) {
+                pack_keys_values(mb, keys, values);
+                packed_mb = mb;
+            }
+
+            const dim_t q_off
+                    = batch_offset(q_d, problem_dims, mb) + i0 * c.q_ld;
+            const char *A = q + q_off * q_dt_size;
+            if (!c.q_in_place) {
+                for_(dim_t r = 0; r < M; r++)
+                for (dim_t d = 0; d < c.D; d++)
+                    queries[r * c.D + d] = load_float(c.q_dt,
+                            q + (q_off + r * c.q_ld) * q_dt_size, d);
+                A = reinterpret_cast<const char *>(queries);
+            }
+
+            for (dim_t r = 0; r < M; r++) {
+                row_max[r] = -FLT_MAX;
+                row_denom[r] = 0.f;
+            }
+            for (dim_t i = 0; i < M * c.Dv; i++)
+                acc[i] = 0.f;
+
+            // Key blocks entirely above the diagonal are skipped
+            const dim_t n_keys = c.with_causal_mask
+                    ? nstl::min(c.Sk, i0 + M)
+                    : c.Sk;
+            const dim_t n_kb = div_up(n_keys, c.k_blk);
+            const dim_t mask_off = c.with_mask_buffer
+                    ? batch_offset(mask_d, problem_dims, mb)
+                    : 0;
+
+            const auto *ker_qk = brg_kernels_[pd_t::get_brg_kernel_idx(
+                                                      false, is_tail)]
+                                         .get();
+            const auto *ker_pv = brg_kernels_[pd_t::get_brg_kernel_idx(
+                                                      true, is_tail)]
+                                         .get();
+
+            for (dim_t kb = 0; kb < n_kb; kb++) {
+                const dim_t j0 = kb * c.k_blk;
+
+                brg_batch.ptr.A = A;
+                brg_batch.ptr.B = keys + kb * c.k_blk * c.D * cdt_size;
+                brgemm_kernel_execute(ker_qk, 1, &brg_batch, scores);
+
+                for (dim_t r = 0; r < M; r++) {
+                    const dim_t i = i0 + r;
+                    float *s = scores + r * c.k_blk;
+
+                    dim_t j_end = nstl::min(c.k_blk, c.Sk - j0);
+                    if (c.with_causal_mask)
+                        j_end = nstl::max<dim_t>(
+                                0, nstl::min(j_end, i - j0 + 1));
+
+                    float mx = -FLT_MAX;
+                    if (c.with_mask_buffer) {
+                        const dim_t off = mask_off + i * c.mask_ld + j0;
+                        if (c.mask_dt == f32) {
+                            auto m = reinterpret_cast<const float *>(mask)
+                                    + off;
+                            for (dim_t j = 0; j < j_end; j++) {
+                                s[j] = s[j] * c.scale + m[j];
+                                mx = nstl::max(mx, s[j]);
+                            }
+                        } else {
+                            auto m = reinterpret_cast<const bfloat16_t *>(mask)
+                                    + off;
+                            for (dim_t j = 0; j < j_end; j++) {
+                                s[j] = s[j] * c.scale
+                                        + static_cast<float>(m[j]);
+                                mx = nstl::max(mx, s[j]);
+                            }
+                        }
+                    } else {
+                        PRAGMA_OMP_SIMD(reduction(max : mx))
+                        for (dim_t j = 0; j < j_end; j++) {
+                            s[j] *= c.scale;
+                            mx = nstl::max(mx, s[j]);
+                        }
+                    }
+                    for (dim_t j = j_end; j < c.k_blk; j++)
+                        s[j] = -INFINITY;
+
+                    const float new_max = nstl::max(row_max[r], mx);
+                    row_corr[r] = expf(row_max[r] - new_max);
+                    row_max[r] = new_max;
+                }
+
+                typename jit_sdpa_exp_kernel_t<isa>::call_params_t p;
+                p.scores = scores;
+                p.probs = probs;
+                p.max = row_max;
+                p.sum = row_sum;
+                p.nrows = M;
+                (*exp_kernel_)(&p);
+
+                // Online softmax: rescale what was accumulated with the
+                // previous running maximum
+                for (dim_t r = 0; r < M; r++) {
+                    row_denom[r] = row_denom[r] * row_corr[r] + row_sum[r];
+                    if (row_corr[r] == 1.f) continue;
+                    float *acc_row = acc + r * c.Dv;
+                    const float corr = row_corr[r];
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t dv = 0; dv < c.Dv; dv++)
+                        acc_row[dv] *= corr;
+                }
+
+                brg_batch.ptr.A = probs;
+                brg_batch.ptr.B = values + kb * c.k_blk * c.Dv * cdt_size;
+                brgemm_kernel_execute(ker_pv, 1, &brg_batch, acc);
+            }
+
+            const dim_t dst_off
+                    = batch_offset(dst_d, problem_dims, mb) + i0 * c.dst_ld;
+            for (dim_t r = 0; r < M; r++) {
+                const float inv_denom
+                        = row_denom[r] > 0.f ? 1.f / row_denom[r] : 0.f;
+                const float *acc_row = acc + r * c.Dv;
+                char *dst_row = dst + (dst_off + r * c.dst_ld) * dst_dt_size;
+                if (c.dst_dt == f32) {
+                    auto d = reinterpret_cast<float *>(dst_row);
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t dv = 0; dv < c.Dv; dv++)
+                        d[dv] = acc_row[dv] * inv_denom;
+                } else {
+                    for (dim_t dv = 0; dv < c.Dv; dv++)
+                        io::store_float_value(c.dst_dt,
+                                acc_row[dv] * inv_denom, dst_row, dv);
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_sdpa_fwd_t<avx512_core_bf16>;
+template struct brgemm_sdpa_fwd_t<avx512_core>;
+template struct brgemm_sdpa_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace sdpa_impl {
+template <cpu_isa_t isa>
+struct jit_sdpa_exp_kernel_t;
+} // namespace sdpa_impl
+
+struct brgemm_sdpa_conf_t {
+    data_type_t q_dt, k_dt, v_dt, mask_dt, dst_dt;
+    // Data type of the brgemm operands: bf16 or f32, integer inputs are
+    // converted to f32 while being copied
+    data_type_t cdt;
+
+    int ndims;
+    dim_t MB, Sq, Sk, D, Dv;
+    float scale;
+    bool with_mask_buffer, with_causal_mask;
+
+    // Queries are read in place when their data type is the compute one
+    bool q_in_place;
+    // Row strides of the inner [S, D] matrices
+    dim_t q_ld, k_ld, v_ld, mask_ld, dst_ld;
+
+    // A block of q_blk queries is processed against blocks of k_blk keys,
+    // so that the score tile of q_blk x k_blk elements stays in L2
+    dim_t q_blk, q_tail, nb_q;
+    dim_t k_blk, nb_k;
+
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_sdpa_fwd_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa, ""), brgemm_sdpa_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels of the two GEMMs for full and tail query blocks
+        static int get_brg_kernel_idx(bool is_pv, bool is_q_tail) {
+            return 2 * is_pv + is_q_tail;
+        }
+        const brgemm_t &get_brg_desc(int idx) const { return brg_descs_[idx]; }
+
+        brgemm_sdpa_conf_t conf_;
+        brgemm_t brg_descs_[4];
+
+    private:
+        status_t init_conf();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_fwd_t(const pd_t *apd);
+    ~brgemm_sdpa_fwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[4];
+    std::unique_ptr<sdpa_impl::jit_sdpa_exp_kernel_t<isa>> exp_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
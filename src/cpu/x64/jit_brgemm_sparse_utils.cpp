@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_sparse_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace brgemm_sparse_utils {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+bool is_row_major(const memory_desc_wrapper &mdw) {
+    return mdw.is_blocking_desc() && mdw.ndims() == 2
+            && mdw.blocking_desc().inner_nblks == 0
+            && mdw.blocking_desc().strides[1] == 1;
+}
+
+bool is_brg_kernel_used(const brgemm_sparse_conf_t &conf, bool is_m_tail,
+        bool is_n_tail, int kind) {
+    return IMPLICATION(is_m_tail, conf.m_tail > 0)
+            && IMPLICATION(is_n_tail, conf.n_tail > 0)
+            && IMPLICATION(kind != brg_kernel_main, conf.k_tail > 0);
+}
+
+} // namespace
+
+status_t init_conf(brgemm_sparse_conf_t &conf, const memory_desc_t &src_md,
+        const memory_desc_t &weights_md, const memory_desc_t &bias_md,
+        const memory_desc_t &dst_md, const primitive_attr_t &attr, int n_dim) {
+    const memory_desc_wrapper src_d(&src_md);
+    const memory_desc_wrapper wei_d(&weights_md);
+    const memory_desc_wrapper bias_d(&bias_md);
+    const memory_desc_wrapper dst_d(&dst_md);
+
+    if (!wei_d.is_sparse_desc() || wei_d.ndims() != 2)
+        return status::unimplemented;
+
+    const auto &sd = wei_d.sparse_desc();
+    const int k_dim = 1 - n_dim;
+    const bool with_bias = bias_d.ndims() != 0;
+    const bool ok = sd.encoding == sparse_encoding::bcsr_bitmask
+            && sd.row_dim == n_dim && is_row_major(src_d)
+            && is_row_major(dst_d)
+            && everyone_is(f32, src_d.data_type(), wei_d.data_type(),
+                    dst_d.data_type())
+            && IMPLICATION(with_bias,
+                    bias_d.data_type() == f32 && bias_d.is_dense()
+                            && bias_d.nelems() == dst_d.dims()[1])
+            && post_ops_ok(attr);
+    if (!ok) return status::unimplemented;
+
+    conf.M = src_d.dims()[0];
+    conf.K = src_d.dims()[1];
+    conf.N = dst_d.dims()[1];
+    conf.LDA = src_d.blocking_desc().strides[0];
+    conf.LDC = dst_d.blocking_desc().strides[0];
+
+    // A block of rows of the source is multiplied by a whole block row of
+    // the weights, so that the non-zero blocks are read once per m_blk rows
+    const dim_t max_m_blk = 64;
+    conf.m_blk = nstl::min(max_m_blk, conf.M);
+    conf.nb_m = div_up(conf.M, conf.m_blk);
+    conf.m_tail = conf.M % conf.m_blk;
+
+    conf.n_blk = sd.block_dims[n_dim];
+    conf.nb_n = div_up(conf.N, conf.n_blk);
+    conf.n_tail = conf.N % conf.n_blk;
+
+    conf.k_blk = sd.block_dims[k_dim];
+    conf.nb_k = div_up(conf.K, conf.k_blk);
+    conf.k_tail = conf.K % conf.k_blk;
+
+    conf.bitmask_words = div_up(conf.nb_k, 64);
+    conf.bitmask_offset = sd.bitmask_offset;
+    conf.values_offset = sd.values_offset;
+
+    conf.with_bias = with_bias;
+    conf.bia_dt = with_bias ? bias_d.data_type() : data_type::undef;
+
+    conf.nthr = (int)nstl::min<dim_t>(
+            dnnl_get_max_threads(), conf.nb_m * conf.nb_n);
+    return status::success;
+}
+
+bool post_ops_ok(const primitive_attr_t &attr) {
+    const auto &po = attr.post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise()) return false;
+    return true;
+}
+
+status_t init_brgemm_descs(cpu_isa_t isa, const brgemm_sparse_conf_t &conf,
+        const primitive_attr_t *attr, const memory_desc_t *dst_md,
+        brgemm_t *brg_descs) {
+    for_(int is_m_tail = 0; is_m_tail < 2; is_m_tail++)
+    for_(int is_n_tail = 0; is_n_tail < 2; is_n_tail++)
+    for (int kind = 0; kind < 3; kind++) {
+        if (!is_brg_kernel_used(conf, is_m_tail, is_n_tail, kind)) continue;
+
+        const bool is_main = kind == brg_kernel_main;
+        const dim_t M = is_m_tail ? conf.m_tail : conf.m_blk;
+        const dim_t N = is_n_tail ? conf.n_tail : conf.n_blk;
+        // When K is smaller than a block the main kernel only initializes
+        // the destination of empty block rows
+        const dim_t K = is_main ? nstl::min(conf.k_blk, conf.K) : conf.k_tail;
+        const float beta = kind == brg_kernel_k_tail ? 1.f : 0.f;
+
+        brgemm_t &brg
+                = brg_descs[get_brg_kernel_idx(is_m_tail, is_n_tail, kind)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_offs, f32, f32, false, false,
+                brgemm_row_major, 1.f, beta, conf.LDA, conf.n_blk, conf.LDC, M,
+                N, K));
+        CHECK(brgemm_desc_set_postops(
+                &brg, attr, dst_md, conf.LDC, conf.bia_dt));
+
+        brgemm_attr_t brgattr;
+        // The kernel restores the offsets of a brgemm_offs batch for every
+        // block of the destination only when max_bs > 1
+        brgattr.max_bs = nstl::max<int>(2, is_main ? (int)conf.nb_k : 1);
+        // Block rows without non-zero blocks still get bias and post-ops
+        brgattr.generate_skip_accumulation = is_main;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+    return status::success;
+}
+
+status_t create_brgemm_kernels(const brgemm_sparse_conf_t &conf,
+        const brgemm_t *brg_descs,
+        std::unique_ptr<brgemm_kernel_t> *brg_kernels) {
+    for_(int is_m_tail = 0; is_m_tail < 2; is_m_tail++)
+    for_(int is_n_tail = 0; is_n_tail < 2; is_n_tail++)
+    for (int kind = 0; kind < 3; kind++) {
+        if (!is_brg_kernel_used(conf, is_m_tail, is_n_tail, kind)) continue;
+        const int idx = get_brg_kernel_idx(is_m_tail, is_n_tail, kind);
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg_descs[idx]));
+        CHECK(safe_ptr_assign(brg_kernels[idx], ker));
+    }
+    return status::success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const brgemm_sparse_conf_t &conf) {
+    using namespace memory_tracking::names;
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, (size_t)conf.nthr * conf.nb_k);
+}
+
+void execute(const brgemm_sparse_conf_t &conf,
+        const std::unique_ptr<brgemm_kernel_t> *brg_kernels, const char *src,
+        const char *weights, const char *bias, char *dst,
+        const memory_tracking::grantor_t &scratchpad) {
+    using namespace memory_tracking::names;
+
+    const auto offsets = reinterpret_cast<const int64_t *>(weights);
+    const auto bitmask = reinterpret_cast<const uint64_t *>(
+            weights + conf.bitmask_offset);
+    const char *values = weights + conf.values_offset;
+
+    const size_t dt_size = sizeof(float);
+    const size_t blk_size = conf.k_blk * conf.n_blk * dt_size;
+    const bool has_k_tail = conf.k_tail > 0;
+
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // Block rows of the weights are the outer loop, so that a thread reuses
+    // the batch it built for all the blocks of rows of the source
+    const dim_t work_amount = conf.nb_n * conf.nb_m;
+    parallel(conf.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        brgemm_batch_element_t *batch = batch_base + ithr * conf.nb_k;
+        int bs = 0;
+        bool with_k_tail_blk = false;
+
+        dim_t nb {0}, mb {0};
+        nd_iterator_init(start, nb, conf.nb_n, mb, conf.nb_m);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            if (iwork == start || mb == 0) {
+                // Offsets of the non-zero blocks of the block row, the K
+                // tail block is the last one when present
+                const uint64_t *row_mask = bitmask + nb * conf.bitmask_words;
+                const char *blk = values + offsets[nb] * blk_size;
+                int nblks = 0;
+                dim_t last_kb = -1;
+                for (dim_t kb = 0; kb < conf.nb_k; kb++) {
+                    if (!(row_mask[kb / 64] & (uint64_t(1) << (kb % 64))))
+                        continue;
+                    batch[nblks].offset.A = kb * conf.k_blk * dt_size;
+                    batch[nblks].offset.B = blk - values;
+                    blk += blk_size;
+                    nblks++;
+                    last_kb = kb;
+                }
+                with_k_tail_blk = has_k_tail && last_kb == conf.nb_k - 1;
+                bs = nblks - with_k_tail_blk;
+            }
+
+            const bool is_m_tail = conf.m_tail > 0 && mb == conf.nb_m - 1;
+            const bool is_n_tail = conf.n_tail > 0 && nb == conf.nb_n - 1;
+            const dim_t m = mb * conf.m_blk;
+            const dim_t n = nb * conf.n_blk;
+
+            const char *ptr_A = src + m * conf.LDA * dt_size;
+            char *ptr_C = dst + (m * conf.LDC + n) * dt_size;
+            const char *ptr_bias
+                    = conf.with_bias ? bias + n * dt_size : nullptr;
+
+            const auto kernel = [&](int kind) {
+                const int idx = get_brg_kernel_idx(is_m_tail, is_n_tail, kind);
+                return brg_kernels[idx].get();
+            };
+            const auto execute_postops = [&](int kind, int kbs, int kb_start) {
+                const brgemm_post_ops_data_t post_ops_data {ptr_bias, nullptr,
+                        nullptr, (size_t)n, (size_t)m, ptr_C, 0, nullptr,
+                        nullptr, nullptr, kbs == 0};
+                brgemm_kernel_execute_postops(kernel(kind), kbs, ptr_A, values,
+                        batch + kb_start, ptr_C, ptr_C, post_ops_data);
+            };
+
+            if (!with_k_tail_blk) {
+                // An empty block row skips the accumulation
+                execute_postops(brg_kernel_main, bs, 0);
+            } else if (bs == 0) {
+                execute_postops(brg_kernel_k_tail_init, 1, 0);
+            } else {
+                brgemm_kernel_execute(kernel(brg_kernel_main), bs, ptr_A,
+                        values, batch, ptr_C);
+                execute_postops(brg_kernel_k_tail, 1, bs);
+            }
+
+            nd_iterator_step(nb, conf.nb_n, mb, conf.nb_m);
+        }
+    });
+}
+
+} // namespace brgemm_sparse_utils
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
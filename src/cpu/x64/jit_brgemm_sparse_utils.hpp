@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SPARSE_UTILS_HPP
+#define CPU_X64_JIT_BRGEMM_SPARSE_UTILS_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive_attr.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// dst[M][N] = src[M][K] * wei[K][N], the weights are in the block-sparse
+// format (sparse_encoding::bcsr_bitmask) with block rows along N. Every
+// block row lists its non-zero k_blk x n_blk blocks, each one is a row major
+// matrix with the leading dimension of n_blk.
+struct brgemm_sparse_conf_t {
+    dim_t M, N, K;
+    dim_t LDA, LDC;
+
+    dim_t m_blk, nb_m, m_tail;
+    dim_t n_blk, nb_n, n_tail;
+    dim_t k_blk, nb_k, k_tail;
+
+    dim_t bitmask_words;
+    size_t bitmask_offset, values_offset;
+
+    bool with_bias;
+    data_type_t bia_dt;
+
+    int nthr;
+};
+
+namespace brgemm_sparse_utils {
+
+// Full and tail blocks along M and N, and three kinds of calls along K:
+// full blocks, the K tail block alone and the K tail block after full ones
+constexpr int max_num_brg_kernels = 12;
+
+enum brg_kernel_kind_t {
+    brg_kernel_main = 0,
+    brg_kernel_k_tail_init = 1,
+    brg_kernel_k_tail = 2,
+};
+
+inline int get_brg_kernel_idx(bool is_m_tail, bool is_n_tail, int kind) {
+    return (2 * is_m_tail + is_n_tail) * 3 + kind;
+}
+
+// Initializes the configuration. The source and the destination are 2D row
+// major matrices, `n_dim` is the weights dimension that maps to N.
+status_t init_conf(brgemm_sparse_conf_t &conf, const memory_desc_t &src_md,
+        const memory_desc_t &weights_md, const memory_desc_t &bias_md,
+        const memory_desc_t &dst_md, const primitive_attr_t &attr, int n_dim);
+
+// Only eltwise post-ops are supported
+bool post_ops_ok(const primitive_attr_t &attr);
+
+// Only the kernels the configuration needs are initialized and created
+status_t init_brgemm_descs(cpu_isa_t isa, const brgemm_sparse_conf_t &conf,
+        const primitive_attr_t *attr, const memory_desc_t *dst_md,
+        brgemm_t *brg_descs);
+
+status_t create_brgemm_kernels(const brgemm_sparse_conf_t &conf,
+        const brgemm_t *brg_descs,
+        std::unique_ptr<brgemm_kernel_t> *brg_kernels);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const brgemm_sparse_conf_t &conf);
+
+void execute(const brgemm_sparse_conf_t &conf,
+        const std::unique_ptr<brgemm_kernel_t> *brg_kernels, const char *src,
+        const char *weights, const char *bias, char *dst,
+        const memory_tracking::grantor_t &scratchpad);
+
+} // namespace brgemm_sparse_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
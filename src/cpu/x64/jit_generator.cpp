@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/primitive.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+// Sequential reader of a kernel binary stored in a cache blob.
+struct blob_reader_t {
+    blob_reader_t(const uint8_t *data, size_t size)
+        : data_(data), size_(size), pos_(0) {}
+
+    template <typename T>
+    bool read(T *ptr, size_t nelems = 1) {
+        const size_t bytes = sizeof(T) * nelems;
+        if (bytes > size_ - pos_) return false;
+        std::memcpy(ptr, data_ + pos_, bytes);
+        pos_ += bytes;
+        return true;
+    }
+
+    const uint8_t *skip(size_t bytes) {
+        if (bytes > size_ - pos_) return nullptr;
+        const uint8_t *ptr = data_ + pos_;
+        pos_ += bytes;
+        return ptr;
+    }
+
+    bool is_end() const { return pos_ == size_; }
+
+private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_;
+};
+} // namespace
+
+// Kernel binary layout:
+// - max cpu isa the code was generated for;
+// - kernel name;
+// - a flag whether the code is stored, if not the kernel is generated again;
+// - code and the list of locations holding addresses relative to the code
+//   start, which are patched when the code is restored at a new address.
+void jit_generator::serialize(serialization_stream_t &sstream) const {
+    const cpu_isa_t isa = get_max_cpu_isa();
+    sstream.write(&isa);
+
+    const size_t name_len = std::strlen(name());
+    sstream.write(&name_len);
+    sstream.write(name(), name_len);
+
+    serialization_stream_t relocs;
+    size_t n_relocs = 0;
+    const bool is_stored = forEachTopRelativeAddr(
+            [&](size_t code_offset, size_t top_offset, int size) {
+                const uint64_t reloc[3] = {code_offset, top_offset,
+                        static_cast<uint64_t>(size)};
+                relocs.write(reloc, 3);
+                n_relocs++;
+            });
+    const uint8_t stored_flag = is_stored;
+    sstream.write(&stored_flag);
+    if (!is_stored) return;
+
+    const size_t code_size = getSize();
+    sstream.write(&code_size);
+    sstream.write(CodeGenerator::getCode(), code_size);
+    sstream.write(&n_relocs);
+    if (n_relocs > 0)
+        sstream.write(relocs.get_data().data(), relocs.get_data().size());
+}
+
+status_t jit_generator::deserialize(
+        cache_blob_t &cache_blob, bool &is_restored) {
+    is_restored = false;
+
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    CHECK(cache_blob.get_binary(&data, &size));
+    blob_reader_t reader(data, size);
+
+    cpu_isa_t isa = isa_any;
+    size_t name_len = 0;
+    if (!reader.read(&isa) || !reader.read(&name_len))
+        return status::invalid_arguments;
+    // The code may use any instruction available on the machine it was
+    // generated on.
+    if (isa != get_max_cpu_isa()) return status::invalid_arguments;
+    const uint8_t *kernel_name = reader.skip(name_len);
+    if (!kernel_name || name_len != std::strlen(name())
+            || std::memcmp(kernel_name, name(), name_len) != 0)
+        return status::invalid_arguments;
+
+    uint8_t stored_flag = 0;
+    if (!reader.read(&stored_flag)) return status::invalid_arguments;
+    if (!stored_flag) return reader.is_end() ? status::success
+                                             : status::invalid_arguments;
+
+    size_t code_size = 0;
+    if (!reader.read(&code_size)) return status::invalid_arguments;
+    const uint8_t *code = reader.skip(code_size);
+    size_t n_relocs = 0;
+    if (!code || !reader.read(&n_relocs)) return status::invalid_arguments;
+
+    db(code, code_size);
+    for (size_t i = 0; i < n_relocs; i++) {
+        uint64_t reloc[3];
+        if (!reader.read(reloc, 3) || reloc[0] + reloc[2] > code_size
+                || reloc[1] > code_size)
+            return status::invalid_arguments;
+        // Xbyak adds the address of the code start when the code is ready.
+        save(reloc[0], reloc[1], static_cast<int>(reloc[2]),
+                Xbyak::inner::LaddTop);
+    }
+    if (!reader.is_end()) return status::invalid_arguments;
+
+    is_restored = true;
+    return status::success;
+}
+
+status_t jit_generator::create_kernel() {
+    primitive_t *p = primitive_t::get_initializing_primitive();
+    const bool use_cache_blob = p && isAutoGrow() && is_relocatable();
+
+    bool is_restored = false;
+    if (use_cache_blob && p->cache_blob()) {
+        cache_blob_t cache_blob = p->cache_blob();
+        CHECK(deserialize(cache_blob, is_restored));
+    }
+    if (!is_restored) generate();
+
+    jit_ker_ = getCode();
+    if (!jit_ker_) return status::runtime_error;
+
+    if (use_cache_blob) p->register_cache_blob_kernel(this);
+    return status::success;
+}
+
+status_t jit_generator::get_cache_blob_size(size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    serialization_stream_t sstream;
+    serialize(sstream);
+    // Additional sizeof(size_t) bytes hold the size of the binary.
+    (*size) += sstream.get_data().size() + sizeof(size_t);
+    return status::success;
+}
+
+status_t jit_generator::get_cache_blob(cache_blob_t &cache_blob) const {
+    serialization_stream_t sstream;
+    serialize(sstream);
+    return cache_blob.add_binary(
+            sstream.get_data().data(), sstream.get_data().size());
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
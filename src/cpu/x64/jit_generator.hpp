@@ -20,7 +20,9 @@
 #include <limits.h>
 
 #include "common/bit_cast.hpp"
+#include "common/cache_blob.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/serialization_stream.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -144,6 +146,7 @@ constexpr Xbyak::Operand::Code abi_not_param_reg =
 
 class jit_generator : public Xbyak::MmapAllocator,
                       public Xbyak::CodeGenerator,
+                      public cache_blob_kernel_t,
                       public c_compatible {
 public:
     using c_compatible::operator new;
@@ -2205,11 +2208,10 @@ public:
         (*fptr)(std::forward<kernel_args_t>(args)...);
     }
 
-    virtual status_t create_kernel() {
-        generate();
-        jit_ker_ = getCode();
-        return (jit_ker_) ? status::success : status::runtime_error;
-    }
+    virtual status_t create_kernel();
+
+    status_t get_cache_blob_size(size_t *size) const override;
+    status_t get_cache_blob(cache_blob_t &cache_blob) const override;
 
 private:
     const cpu_isa_t max_cpu_isa_;
@@ -2229,8 +2231,18 @@ private:
         return Xbyak::GetError() == Xbyak::ERR_NONE;
     }
 
+    void serialize(serialization_stream_t &sstream) const;
+    status_t deserialize(cache_blob_t &cache_blob, bool &is_restored);
+
 protected:
     virtual void generate() = 0;
+
+    // Kernels returning true guarantee that `generate()` has no side effects
+    // other than the emitted code, and that the code holds no absolute
+    // addresses except the ones of its own labels. Such kernels are stored in
+    // primitive cache blobs and restored from them without code generation.
+    virtual bool is_relocatable() const { return false; }
+
     const Xbyak::uint8 *jit_ker_ = nullptr;
 };
 
@@ -903,6 +903,11 @@ struct jit_brgemm_conv_conf_t {
     bool src_zero_point;
     bool dst_zero_point;
     bool comp_with_vpads;
+
+    // backward by weights
+    int nthr_mb;
+    int tr_src_num_rows;
+    dim_t tr_src_row_size, tr_src_buffer_size, tr_diff_dst_buffer_size;
 };
 
 struct jit_shuffle_conf_t {
@@ -995,10 +1000,18 @@ struct jit_reduction_conf_t {
 
     alg_kind_t alg = alg_kind::undef;
     cpu_isa_t isa = isa_any;
+    float p = 0.f;
+    float eps = 0.f;
 
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
 
+    // When there are fewer idle points than threads, the reduced dimension
+    // is split into nchunks chunks of chunk_size elements (the last one may
+    // be shorter), reduced in parallel and combined afterwards.
+    dim_t nchunks = 1;
+    dim_t chunk_size = 0;
+
     bool is_saturation_needed = false;
 
     post_ops_t post_ops = post_ops_t();
@@ -1012,6 +1025,10 @@ struct jit_reduction_conf_t {
 struct jit_reduction_call_s {
     const void *src = nullptr;
     void *dst = nullptr;
+    // Used by the partial stage only: number of full vectors in the chunk
+    // and whether the chunk ends with the reduce_size tail
+    size_t reduce_work = 0;
+    size_t with_tail = 0;
     const void *post_ops_binary_rhs_arg_vec = nullptr;
     const void *dst_orig = nullptr;
 };
@@ -0,0 +1,323 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace memory_tracking::names;
+
+#define GET_OFF(field) offsetof(jit_concat_call_s, field)
+
+void jit_uni_concat_kernel_t::copy_bytes(int step, const Reg64 &reg_cnt) {
+    // Copies reg_cnt elements of step bytes each.
+    Label loop, loop_end;
+    L(loop);
+    {
+        test(reg_cnt, reg_cnt);
+        jz(loop_end, T_NEAR);
+        if (step == 8) {
+            mov(reg_data, qword[reg_src]);
+            mov(qword[reg_dst], reg_data);
+        } else {
+            assert(step == 1);
+            mov(reg_data.cvt8(), byte[reg_src]);
+            mov(byte[reg_dst], reg_data.cvt8());
+        }
+        add(reg_src, step);
+        add(reg_dst, step);
+        dec(reg_cnt);
+        jmp(loop, T_NEAR);
+    }
+    L(loop_end);
+}
+
+template <typename Vmm>
+void jit_uni_concat_kernel_t::copy() {
+    const int vlen = Vmm(0).getBit() / 8;
+
+    if (jcp_.use_nt_stores) {
+        // Non-temporal stores require the destination to be aligned, so
+        // the head is copied byte by byte.
+        mov(reg_tmp, reg_dst);
+        neg(reg_tmp);
+        and_(reg_tmp, vlen - 1);
+        cmp(reg_tmp, reg_size);
+        cmova(reg_tmp, reg_size);
+        sub(reg_size, reg_tmp);
+        copy_bytes(1, reg_tmp);
+    }
+
+    for (const int unroll : {unroll_, 1}) {
+        const int step = unroll * vlen;
+        Label loop, loop_end;
+        L(loop);
+        {
+            cmp(reg_size, step);
+            jb(loop_end, T_NEAR);
+            for (int i = 0; i < unroll; i++)
+                uni_vmovups(Vmm(i), ptr[reg_src + i * vlen]);
+            for (int i = 0; i < unroll; i++) {
+                if (jcp_.use_nt_stores)
+                    uni_vmovntps(ptr[reg_dst + i * vlen], Vmm(i));
+                else
+                    uni_vmovups(ptr[reg_dst + i * vlen], Vmm(i));
+            }
+            add(reg_src, step);
+            add(reg_dst, step);
+            sub(reg_size, step);
+            jmp(loop, T_NEAR);
+        }
+        L(loop_end);
+    }
+
+    // tail: quad words first, then the remaining bytes
+    mov(reg_tmp, reg_size);
+    shr(reg_tmp, 3);
+    and_(reg_size, 7);
+    copy_bytes(8, reg_tmp);
+    copy_bytes(1, reg_size);
+}
+
+void jit_uni_concat_kernel_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_size, ptr[reg_param + GET_OFF(size)]);
+
+    switch (jcp_.isa) {
+        case avx512_core: copy<Zmm>(); break;
+        case avx: copy<Ymm>(); break;
+        case sse41: copy<Xmm>(); break;
+        default: assert(!"unsupported isa");
+    }
+    if (jcp_.use_nt_stores) sfence();
+
+    postamble();
+}
+
+#undef GET_OFF
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    const bool ok = mayiuse(sse41)
+            && platform::has_data_type_support(dst_md()->data_type)
+            && cpu_concat_pd_t::init() == status::success;
+    if (!ok) return status::unimplemented;
+
+    CHECK(init_conf());
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const uint8_t *>(key_concat_iptrs, n_inputs());
+    scratchpad.template book<uint8_t *>(key_concat_optrs, n_inputs());
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::pd_t::init_conf() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+    const data_type_t dt = dst_d.data_type();
+
+    if (dst_d.format_kind() != format_kind::blocked)
+        return status::unimplemented;
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(&src_mds_[i]);
+        const memory_desc_wrapper o_d(&src_image_mds_[i]);
+        const bool ignore_strides = true;
+        const bool ok
+                = utils::everyone_is(dt, i_d.data_type(), o_d.data_type())
+                && utils::everyone_is(format_kind::blocked, i_d.format_kind(),
+                        o_d.format_kind())
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *o_d.md_, ignore_strides)
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *dst_d.md_, ignore_strides)
+                && !i_d.is_additional_buffer();
+        if (!ok) return status::unimplemented;
+    }
+
+    dims_t blocks = {0};
+    dst_d.compute_blocks(blocks);
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    // order dimensions from the outermost to the innermost one
+    int perm[DNNL_MAX_NDIMS] {}, iperm[DNNL_MAX_NDIMS] {};
+    strides_t strides = {0};
+    utils::array_copy(strides, dst_strides, ndims);
+    dims_t ou_blocks = {0};
+    for (int d = 0; d < ndims; d++) {
+        iperm[d] = d;
+        ou_blocks[d] = dst_d.padded_dims()[d] / blocks[d];
+    }
+    utils::simultaneous_sort(strides, ou_blocks, iperm, ndims,
+            [](stride_t a, stride_t b) { return b - a; });
+    for (int i = 0; i < ndims; i++)
+        perm[iperm[i]] = i;
+
+    // start dim is the first dimension after which the concatenation happens
+    // contiguously
+    const int cdim = concat_dim();
+    const int start_dim = perm[cdim];
+
+    const auto chunk_nelems = [&](const memory_desc_wrapper &data_d) {
+        dim_t nelems = 1;
+        for (int i = start_dim; i < ndims; i++)
+            nelems *= data_d.padded_dims()[iperm[i]] / blocks[iperm[i]];
+        for (int i = 0; i < ndims; i++)
+            nelems *= blocks[i];
+        return nelems;
+    };
+
+    // check that the contiguous part is indeed dense
+    if (chunk_nelems(dst_d)
+            != dst_d.padded_dims()[cdim] / blocks[cdim] * dst_strides[cdim])
+        return status::unimplemented;
+
+    const dim_t dt_size = types::data_type_size(dt);
+
+    n_outer_dims_ = start_dim;
+    for (int i = 0; i < start_dim; i++) {
+        outer_dims_[i] = dst_d.padded_dims()[iperm[i]] / blocks[iperm[i]];
+        dst_outer_strides_[i] = dst_strides[iperm[i]] * dt_size;
+    }
+
+    src_outer_strides_.resize(n_inputs() * start_dim);
+    src_chunk_sizes_.resize(n_inputs());
+    for (int a = 0; a < n_inputs(); ++a) {
+        const memory_desc_wrapper i_d(&src_mds_[a]);
+        const auto &i_strides = i_d.blocking_desc().strides;
+        // inputs must have the same strides as the destination for the
+        // contiguous part
+        for (int d = start_dim; d < ndims; ++d)
+            if (dst_strides[iperm[d]] != i_strides[iperm[d]])
+                return status::unimplemented;
+        for (int i = 0; i < start_dim; i++)
+            src_outer_strides_[a * start_dim + i]
+                    = i_strides[iperm[i]] * dt_size;
+        src_chunk_sizes_[a] = chunk_nelems(i_d) * dt_size;
+    }
+
+    jcp_.isa = mayiuse(avx512_core) ? avx512_core
+                                    : mayiuse(avx) ? avx : sse41;
+    // Bypass the cache when the destination does not fit into the last
+    // level cache anyway.
+    const size_t llc_size = (size_t)platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    jcp_.use_nt_stores = dst_d.size() > llc_size;
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto iptrs = scratchpad.template get<const uint8_t *>(key_concat_iptrs);
+    auto optrs = scratchpad.template get<uint8_t *>(key_concat_optrs);
+
+    const int num_arrs = pd()->n_inputs();
+    const auto &chunk_sizes = pd()->src_chunk_sizes_;
+    dim_t row_size = 0;
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        const memory_desc_wrapper o_d(pd()->src_image_md(a));
+        const auto iptr
+                = CTX_IN_MEM(const uint8_t *, DNNL_ARG_MULTIPLE_SRC + a);
+        iptrs[a] = iptr ? iptr + i_d.blk_off(0) * i_d.data_type_size()
+                        : nullptr;
+        optrs[a] = dst + o_d.blk_off(0) * o_d.data_type_size();
+        row_size += chunk_sizes[a];
+    }
+
+    const int n_outer_dims = pd()->n_outer_dims_;
+    const dim_t *outer_dims = pd()->outer_dims_;
+    const dim_t *dst_strides = pd()->dst_outer_strides_;
+    const dim_t *src_strides = pd()->src_outer_strides_.data();
+
+    dim_t n_rows = 1;
+    for (int i = 0; i < n_outer_dims; i++)
+        n_rows *= outer_dims[i];
+
+    // A row is a concatenation of contiguous chunks of all the inputs. The
+    // rows form a single stream of bytes, which is split evenly between
+    // threads at cache line granularity regardless of the input sizes.
+    const dim_t total_size = n_rows * row_size;
+    if (total_size == 0) return status::success;
+
+    const dim_t cache_line_size = 64;
+    const dim_t min_size_per_thr = 16 * 1024;
+    const dim_t n_lines = utils::div_up(total_size, cache_line_size);
+    const int nthr = (int)nstl::min<dim_t>(dnnl_get_max_threads(),
+            utils::div_up(total_size, min_size_per_thr));
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(n_lines, nthr, ithr, start, end);
+        start *= cache_line_size;
+        end = nstl::min(end * cache_line_size, total_size);
+
+        dim_t pos = start;
+        while (pos < end) {
+            dim_t row = pos / row_size;
+            dim_t row_off = pos % row_size;
+
+            int a = 0;
+            while (row_off >= chunk_sizes[a]) {
+                row_off -= chunk_sizes[a];
+                a++;
+            }
+            const dim_t size = nstl::min(end - pos, chunk_sizes[a] - row_off);
+
+            if (iptrs[a] != nullptr) {
+                dim_t src_off = row_off, dst_off = row_off;
+                for (int i = n_outer_dims - 1; i >= 0; i--) {
+                    const dim_t idx = row % outer_dims[i];
+                    row /= outer_dims[i];
+                    src_off += idx * src_strides[a * n_outer_dims + i];
+                    dst_off += idx * dst_strides[i];
+                }
+
+                jit_concat_call_s args;
+                args.src = iptrs[a] + src_off;
+                args.dst = optrs[a] + dst_off;
+                args.size = size;
+                (*kernel_)(&args);
+            }
+            pos += size;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
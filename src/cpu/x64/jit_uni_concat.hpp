@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_concat_conf_t {
+    cpu_isa_t isa;
+    bool use_nt_stores;
+};
+
+struct jit_concat_call_s {
+    const void *src;
+    void *dst;
+    size_t size; // in bytes
+};
+
+// Copies a contiguous chunk of bytes. With non-temporal stores enabled the
+// destination is aligned to the vector length first.
+struct jit_uni_concat_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_kernel_t)
+
+    jit_uni_concat_kernel_t(const jit_concat_conf_t &jcp)
+        : jit_generator(jit_name()), jcp_(jcp) {}
+
+    bool is_relocatable() const override { return true; }
+
+private:
+    static constexpr int unroll_ = 4;
+
+    const jit_concat_conf_t jcp_;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_size = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_data = rax;
+
+    void generate() override;
+
+    template <typename Vmm>
+    void copy();
+    void copy_bytes(int step, const Xbyak::Reg64 &reg_cnt);
+};
+
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", jcp_.isa, ""), jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        jit_concat_conf_t jcp_ = {isa_any, false};
+
+        // Physical outer dimensions, i.e. the dimensions before the one
+        // after which every input is copied contiguously, and the strides of
+        // the destination and inputs over them (in bytes).
+        int n_outer_dims_ = 0;
+        dims_t outer_dims_ {};
+        dims_t dst_outer_strides_ {};
+        std::vector<dim_t> src_outer_strides_;
+        // Size of the contiguous chunk of every input (in bytes).
+        std::vector<dim_t> src_chunk_sizes_;
+
+    private:
+        status_t init_conf();
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_concat_kernel_t(pd()->jcp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_uni_concat_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
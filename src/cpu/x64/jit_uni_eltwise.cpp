@@ -53,14 +53,16 @@ protected:
 
     data_type_t data_type() const { return pd_->desc()->data_desc.data_type; }
     bool is_bf16() const { return data_type() == data_type::bf16; }
+    bool is_f16() const { return data_type() == data_type::f16; }
+    bool is_xf16() const { return is_bf16() || is_f16(); }
     int dtype_size() const { return types::data_type_size(data_type()); }
 };
 
 // jit kernels
 namespace {
 
-struct jit_bf16_injector_t {
-    jit_bf16_injector_t(
+struct jit_xf16_injector_t {
+    jit_xf16_injector_t(
             jit_generator *host, Opmask k_tail_mask, bf16_emulation_t *emu)
         : h(host), k_tail_mask_(k_tail_mask), emu_(emu) {}
 
@@ -114,6 +116,24 @@ struct jit_bf16_injector_t {
         }
     }
 
+    void load_f16_cvt_to_f32(size_t idx, Reg64 reg_src, bool is_tail = false,
+            size_t offset = 0) {
+        Zmm zmm_f32 = Zmm(idx);
+        zmm_f32 = is_tail ? zmm_f32 | k_tail_mask_ | Xbyak::util::T_z : zmm_f32;
+        h->vcvtph2ps(zmm_f32, h->ptr[reg_src + offset]);
+    }
+
+    void cvt_f32_to_f16_store(size_t idx, Reg64 reg_dst, bool is_tail = false,
+            size_t offset = 0) {
+        Ymm ymm_f16 = Ymm(idx);
+        Zmm zmm_f32 = Zmm(idx);
+        h->vcvtps2ph(ymm_f16, zmm_f32, jit_generator::_op_mxcsr);
+        if (!is_tail)
+            h->vmovdqu16(h->ptr[reg_dst + offset], ymm_f16);
+        else
+            h->vmovdqu16(h->ptr[reg_dst + offset] | k_tail_mask_, ymm_f16);
+    }
+
 private:
     jit_generator *const h;
     Xbyak::Opmask k_tail_mask_;
@@ -131,9 +151,10 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
                 bf16_emu_.reset(new bf16_emulation_t(this, bf16_emu_reserv_1,
                         bf16_emu_reserv_2, bf16_emu_reserv_3, bf16_emu_scratch,
                         bf16_emu_reserv_5));
-            bf16_injector_.reset(new jit_bf16_injector_t(
-                    this, k_tail_mask, bf16_emu_.get()));
         }
+        if (is_xf16())
+            xf16_injector_.reset(new jit_xf16_injector_t(
+                    this, k_tail_mask, bf16_emu_.get()));
 
         const auto &desc = *pd_->desc();
         // there's no auxiliary vregs on fwd path
@@ -148,10 +169,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         const bool is_fwd = pd_->is_fwd();
         preamble();
 
-        if (is_bf16()) {
-            bf16_injector_->prepare_mask();
-            if (!mayiuse(avx512_core_bf16)) bf16_emu_->init_vcvtneps2bf16();
-        }
+        if (is_xf16()) xf16_injector_->prepare_mask();
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
 
         Reg64 param = abi_param1;
         mov(reg_src, ptr[param + GET_OFF(src)]);
@@ -179,14 +198,23 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
         if (is_bf16()) {
-            bf16_injector_->load_bf16_cvt_to_f32(vmm_src.getIdx(), reg_src);
+            xf16_injector_->load_bf16_cvt_to_f32(vmm_src.getIdx(), reg_src);
             eltwise_injector_->compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
-                bf16_injector_->load_bf16_cvt_to_f32(
+                xf16_injector_->load_bf16_cvt_to_f32(
                         vmm_diff_dst.getIdx(), reg_diff_dst);
                 uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
             }
-            bf16_injector_->cvt_f32_to_bf16_store(1, vmm_src.getIdx(), reg_dst);
+            xf16_injector_->cvt_f32_to_bf16_store(1, vmm_src.getIdx(), reg_dst);
+        } else if (is_f16()) {
+            xf16_injector_->load_f16_cvt_to_f32(vmm_src.getIdx(), reg_src);
+            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                xf16_injector_->load_f16_cvt_to_f32(
+                        vmm_diff_dst.getIdx(), reg_diff_dst);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            xf16_injector_->cvt_f32_to_f16_store(vmm_src.getIdx(), reg_dst);
         } else {
             uni_vmovups(vmm_src, ptr[reg_src]);
             eltwise_injector_->compute_vector(vmm_src.getIdx());
@@ -213,16 +241,27 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         cmp(reg_work_amount, 0);
         jle(reminder_loop_end, T_NEAR);
         if (is_bf16()) {
-            bf16_injector_->load_bf16_cvt_to_f32(
+            xf16_injector_->load_bf16_cvt_to_f32(
                     vmm_src.getIdx(), reg_src, true);
             eltwise_injector_->compute_vector(vmm_src.getIdx());
             if (!is_fwd) {
-                bf16_injector_->load_bf16_cvt_to_f32(
+                xf16_injector_->load_bf16_cvt_to_f32(
                         vmm_diff_dst.getIdx(), reg_diff_dst, true);
                 uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
             }
-            bf16_injector_->cvt_f32_to_bf16_store(
+            xf16_injector_->cvt_f32_to_bf16_store(
                     1, vmm_src.getIdx(), reg_dst, true);
+        } else if (is_f16()) {
+            xf16_injector_->load_f16_cvt_to_f32(
+                    vmm_src.getIdx(), reg_src, true);
+            eltwise_injector_->compute_vector(vmm_src.getIdx());
+            if (!is_fwd) {
+                xf16_injector_->load_f16_cvt_to_f32(
+                        vmm_diff_dst.getIdx(), reg_diff_dst, true);
+                uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
+            }
+            xf16_injector_->cvt_f32_to_f16_store(
+                    vmm_src.getIdx(), reg_dst, true);
         } else {
             uni_vmovss(xmm_src, ptr[reg_src]);
             eltwise_injector_->compute_vector(xmm_src.getIdx());
@@ -251,7 +290,7 @@ private:
 
     int vlen() {
         int vlen = cpu_isa_traits<isa>::vlen;
-        return is_bf16() ? vlen / 2 : vlen;
+        return is_xf16() ? vlen / 2 : vlen;
     }
     int simd_w() { return vlen() / dtype_size(); }
 
@@ -270,7 +309,7 @@ private:
     Vmm vmm_diff_dst = Vmm(2);
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
 
-    /* bf16 support */
+    /* bf16 and f16 support */
     Zmm bf16_emu_reserv_1 = Zmm(26);
     Zmm bf16_emu_reserv_2 = Zmm(27);
     Zmm bf16_emu_reserv_3 = Zmm(28);
@@ -279,7 +318,7 @@ private:
 
     Opmask k_tail_mask = k6;
 
-    std::unique_ptr<jit_bf16_injector_t> bf16_injector_;
+    std::unique_ptr<jit_xf16_injector_t> xf16_injector_;
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 };
 
@@ -292,7 +331,8 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
     const memory_desc_wrapper data_d(data_md());
 
     bool ok = mayiuse(isa) && is_fwd() && data_md()->data_type == d_type
-            && IMPLICATION(data_md()->data_type == data_type::bf16,
+            && IMPLICATION(
+                    utils::one_of(d_type, data_type::bf16, data_type::f16),
                     mayiuse(avx512_core))
             && !has_zero_dim_memory() && data_d.is_dense(true)
             && eltwise_injector::is_supported(isa, desc_.alg_kind)
@@ -422,6 +462,7 @@ template struct jit_uni_eltwise_fwd_t<avx, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx2, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::f32>;
 template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::bf16>;
+template struct jit_uni_eltwise_fwd_t<avx512_core, data_type::f16>;
 
 template struct jit_uni_eltwise_bwd_t<sse41, data_type::f32>;
 template struct jit_uni_eltwise_bwd_t<avx, data_type::f32>;
@@ -44,6 +44,9 @@ struct jit_transfer_t<f32> {
     template <data_type_t store_data_type>
     void store(Ymm &vmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems);
 
+    // Initializes auxiliary registers, has to be called after preamble.
+    void init() {}
+
     // Need to have bf16 emu available publically here since initialization
     // has to happen after preamble.
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
@@ -163,6 +166,59 @@ void jit_transfer_t<bf16>::store<bf16>(
         assert(!"unsupported nelems");
 }
 
+// Transfer for int8 data: values are converted to f32 on load and saturated
+// and rounded back to the data type on store.
+template <data_type_t data_type>
+struct jit_transfer_t : jit_transfer_t<f32> {
+    jit_transfer_t(jit_generator &gen) : jit_transfer_t<f32>(gen) {}
+
+    template <data_type_t load_data_type>
+    void load(Ymm &vmm_src, Reg64 reg_src, int nelems, size_t offt_elems);
+
+    template <data_type_t store_data_type>
+    void store(Ymm &vmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems);
+
+    void init() {
+        gen_.init_saturate_f32(
+                vmm_lbound_, vmm_ubound_, reg_tmp_, f32, data_type);
+    }
+
+private:
+    const Reg64 reg_tmp_ = r15;
+    const Ymm vmm_lbound_ = Ymm(5);
+    const Ymm vmm_ubound_ = Ymm(6);
+};
+
+template <data_type_t data_type>
+template <data_type_t load_data_type>
+void jit_transfer_t<data_type>::load(
+        Ymm &vmm_src, Reg64 reg_src, int nelems, size_t offt_elems) {
+    if (load_data_type == f32) {
+        jit_transfer_t<f32>::load<f32>(vmm_src, reg_src, nelems, offt_elems);
+        return;
+    }
+    assert(utils::one_of(nelems, 1, simd_w_)
+            && "unsupported nelems for load src");
+    gen_.load_data(load_data_type, vmm_src, reg_src,
+            offt_elems * types::data_type_size(load_data_type), nelems);
+    gen_.vcvtdq2ps(vmm_src, vmm_src);
+}
+
+template <data_type_t data_type>
+template <data_type_t store_data_type>
+void jit_transfer_t<data_type>::store(
+        Ymm &vmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems) {
+    if (store_data_type == f32) {
+        jit_transfer_t<f32>::store<f32>(vmm_dst, reg_dst, nelems, offt_elems);
+        return;
+    }
+    assert(utils::one_of(nelems, 1, simd_w_) && "unsupported nelems");
+    gen_.saturate_f32(vmm_dst, vmm_lbound_, vmm_ubound_, store_data_type);
+    gen_.vcvtps2dq(vmm_dst, vmm_dst);
+    gen_.store_data(store_data_type, vmm_dst, reg_dst,
+            offt_elems * types::data_type_size(store_data_type), nelems);
+}
+
 template <data_type_t data_type>
 struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
                                     public jit_generator {
@@ -179,7 +235,10 @@ struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
 
 private:
     jit_transfer_t<data_type> jit_transfer_;
-    static constexpr int unroll_factor_ = 8;
+    // For int8 the upper half of the accumulators holds the output scale
+    // and the saturation bounds.
+    static constexpr int unroll_factor_
+            = utils::one_of(data_type, s8, u8) ? 4 : 8;
     static constexpr int simd_w = data_type == bf16 ? 16 : 8;
     using Vmm = typename utils::conditional<data_type == bf16, Xbyak::Zmm,
             Xbyak::Ymm>::type;
@@ -190,6 +249,7 @@ private:
     using stat_and_data_kernel_t<data_type>::save_stats_;
     using stat_and_data_kernel_t<data_type>::calculate_stats_;
     using stat_and_data_kernel_t<data_type>::eps_;
+    using stat_and_data_kernel_t<data_type>::output_scale_;
 
     struct ker_args_t {
         const data_t *src;
@@ -220,6 +280,7 @@ private:
     const Xbyak::Reg64 reg_tmp = r11;
     const Xbyak::Reg64 reg_shift = r12;
 
+    Vmm vmm_output_scale = Vmm(4);
     Vmm vmm_ones = Vmm(8);
     Vmm vmm_eps = Vmm(9);
     Vmm vmm_inv_sqrtvar = Vmm(10);
@@ -266,6 +327,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
 
     preamble();
     if (jit_transfer_.bf16_emu_) jit_transfer_.bf16_emu_->init_vcvtneps2bf16();
+    jit_transfer_.init();
 #define PARAM_OFF(x) offsetof(ker_args_t, x)
     mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
     mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
@@ -279,6 +341,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     const int C_vecs = C_ / simd_w;
     // float value of 1
     static constexpr float one = 1.0;
+    const bool is_int8 = utils::one_of(data_type, s8, u8);
 
     const auto calculate_dst = [=](int nelems, size_t offt_elems) {
         if (use_scaleshift_ || use_scale_) {
@@ -299,6 +362,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             if (use_scale_) vmulps(vmm_data, vmm_data, vmm_gamma);
             if (use_shift_) vaddps(vmm_data, vmm_data, vmm_beta);
         }
+        if (is_int8) vmulps(vmm_data, vmm_data, vmm_output_scale);
         jit_transfer_.template store<data_type>(
                 vmm_data, reg_dst, nelems, offt_elems);
     };
@@ -311,6 +375,11 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     mov(reg_tmp, float2int(one));
     vmovq(xmm_tmp, reg_tmp);
     vbroadcastss(vmm_ones, xmm_tmp);
+    if (is_int8) {
+        mov(reg_tmp, float2int(output_scale_));
+        vmovq(xmm_tmp, reg_tmp);
+        vbroadcastss(vmm_output_scale, xmm_tmp);
+    }
 
     Label unroll_loop, end;
     L(unroll_loop);
@@ -428,8 +497,8 @@ void jit_stat_and_data_kernel_t<bf16>::reduce() {
     vaddps(xmm_return_value, xmm_high, xmm_return_value);
 }
 
-template <>
-void jit_stat_and_data_kernel_t<f32>::reduce() {
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::reduce() {
     Xmm xmm_high = Xmm(1);
     vextractf128(xmm_high, Ymm(0), 1);
     vaddps(xmm_return_value, xmm_high, xmm_return_value);
@@ -840,6 +909,18 @@ stat_and_data_kernel_t<f32> *stat_and_data_kernel_create(
     return mayiuse(avx2) ? new jit_stat_and_data_kernel_t<f32>(pd) : nullptr;
 }
 
+template <>
+stat_and_data_kernel_t<s8> *stat_and_data_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx2) ? new jit_stat_and_data_kernel_t<s8>(pd) : nullptr;
+}
+
+template <>
+stat_and_data_kernel_t<u8> *stat_and_data_kernel_create(
+        const layer_normalization_pd_t *pd) {
+    return mayiuse(avx2) ? new jit_stat_and_data_kernel_t<u8>(pd) : nullptr;
+}
+
 template <>
 diff_ss_kernel_t<bf16> *diff_ss_kernel_create(
         const layer_normalization_pd_t *pd) {
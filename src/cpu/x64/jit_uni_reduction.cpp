@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+
 #include "jit_uni_reduction.hpp"
 
 namespace dnnl {
@@ -49,6 +52,7 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
 
     const bool ok = platform::has_data_type_support(conf_.src_type)
             && platform::has_data_type_support(conf_.dst_type)
+            && !utils::one_of(data_type::f16, conf_.src_type, conf_.dst_type)
             && set_default_params() == status::success
             && attr()->has_default_values(sm::post_ops)
             && attr_.set_default_formats(dst_md(0)) == status::success;
@@ -102,42 +106,153 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
 
     conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
 
+    // Reduced dimensions have to form the innermost block of the tensor.
+    // Unit dimensions don't change the memory order and may be interleaved
+    // with the reduced ones.
     int num_of_reduced_dims = 0;
+    int innermost_idle_dim = -1;
     conf_.idle_size = dst_mdw.nelems();
     conf_.reduce_size = 1;
     for (int d = ndims - 1; d >= 0; --d) {
         if (src_dims[d] != dst_dims[d]) {
             num_of_reduced_dims++;
             conf_.reduce_size *= src_dims[d];
-        } else
+        } else if (src_dims[d] != 1) {
+            innermost_idle_dim = d;
             break;
+        }
     }
 
     if (num_of_reduced_dims == 0) return status::unimplemented;
 
-    for (int d = 0; d < ndims - num_of_reduced_dims; ++d)
+    for (int d = 0; d < innermost_idle_dim; ++d)
         if (src_dims[d] != dst_dims[d]) return status::unimplemented;
 
     conf_.alg = desc()->alg_kind;
+    conf_.p = desc()->p;
+    conf_.eps = desc()->eps;
     if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
-                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum))
+                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum)
+            && !utils::one_of(conf_.p, 1.f, 2.f))
         return status::unimplemented;
 
+    init_reduce_split();
+    init_scratchpad();
+
     return status::success;
 }
 
+void jit_uni_reduction_t::pd_t::init_reduce_split() {
+    // Splitting pays off only for long enough chunks: partial results go
+    // through memory and are combined in a separate pass.
+    static constexpr dim_t min_chunk_size = 4096;
+    // Chunks are a multiple of the widest vector so that only the last
+    // chunk of a row has a tail.
+    static constexpr dim_t chunk_align = 16;
+
+    const int nthr = dnnl_get_max_threads();
+    conf_.nchunks = 1;
+    conf_.chunk_size = conf_.reduce_size;
+
+    if (conf_.idle_size >= nthr || conf_.reduce_size < 2 * min_chunk_size)
+        return;
+
+    const dim_t nchunks = nstl::min<dim_t>(
+            utils::div_up(nthr, conf_.idle_size),
+            conf_.reduce_size / min_chunk_size);
+    if (nchunks < 2) return;
+
+    conf_.chunk_size = utils::rnd_up(
+            utils::div_up(conf_.reduce_size, nchunks), chunk_align);
+    conf_.nchunks = utils::div_up(conf_.reduce_size, conf_.chunk_size);
+}
+
+void jit_uni_reduction_t::pd_t::init_scratchpad() {
+    if (conf_.nchunks == 1) return;
+
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(
+            key_reduction, conf_.idle_size * conf_.nchunks);
+}
+
 status_t jit_uni_reduction_t::init(engine_t *engine) {
     using namespace format_tag;
 
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
 
-    CHECK(get_proper_kernel(dst_md, conf));
-    CHECK(kernel_->create_kernel());
+    if (conf.nchunks == 1) {
+        CHECK(get_proper_kernel(
+                kernel_, dst_md, conf, jit_reduction_stage_t::full));
+        CHECK(kernel_->create_kernel());
+    } else {
+        CHECK(get_proper_kernel(
+                kernel_, dst_md, conf, jit_reduction_stage_t::finalize));
+        CHECK(kernel_->create_kernel());
+        CHECK(get_proper_kernel(partial_kernel_, dst_md, conf,
+                jit_reduction_stage_t::partial));
+        CHECK(partial_kernel_->create_kernel());
+    }
 
     return status::success;
 }
 
+// Combines partial results of two chunks of the same row
+static inline float combine_partials(alg_kind_t alg, float a, float b) {
+    using namespace alg_kind;
+    switch (alg) {
+        case reduction_max: return nstl::max(a, b);
+        case reduction_min: return nstl::min(a, b);
+        case reduction_mul: return a * b;
+        default: return a + b;
+    }
+}
+
+void jit_uni_reduction_t::execute_split(const exec_ctx_t &ctx,
+        const uint8_t *src, uint8_t *dst,
+        const void *post_ops_binary_rhs_arg_vec) const {
+    const auto &conf = pd()->get_conf();
+    const dim_t idle_size = conf.idle_size;
+    const dim_t reduce_size = conf.reduce_size;
+    const dim_t nchunks = conf.nchunks;
+    const dim_t chunk_size = conf.chunk_size;
+    const dim_t simd_w = partial_kernel_->get_simd_w();
+
+    float *partials = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+
+    parallel_nd(idle_size, nchunks, [&](dim_t i, dim_t c) {
+        const dim_t r_start = c * chunk_size;
+        const dim_t r_len = nstl::min(chunk_size, reduce_size - r_start);
+
+        jit_reduction_call_s args = jit_reduction_call_s();
+        args.src = src + (i * reduce_size + r_start) * conf.src_dt_size;
+        args.dst = partials + i * nchunks + c;
+        args.reduce_work = r_len / simd_w;
+        args.with_tail = r_len % simd_w != 0;
+
+        (*partial_kernel_)(&args);
+    });
+
+    parallel_nd(idle_size, [&](dim_t i) {
+        // Pairwise tree over the partial results of a row, it keeps the
+        // accumulation error of long sums low
+        float *row = partials + i * nchunks;
+        for (dim_t stride = 1; stride < nchunks; stride *= 2)
+            for (dim_t c = 0; c + stride < nchunks; c += 2 * stride)
+                row[c] = combine_partials(conf.alg, row[c], row[c + stride]);
+
+        jit_reduction_call_s args = jit_reduction_call_s();
+        args.src = row;
+        args.dst = dst + i * conf.dst_dt_size;
+        args.dst_orig = dst;
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+
+        (*kernel_)(&args);
+    });
+}
+
 status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
@@ -150,6 +265,11 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     const auto &post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
+    if (pd()->get_conf().nchunks > 1) {
+        execute_split(ctx, src, dst, post_ops_binary_rhs_arg_vec.data());
+        return status::success;
+    }
+
     parallel_nd(idle_size, [&](dim_t i) {
         const dim_t src_off = i * reduce_size * src_dt_size;
         const dim_t dst_off = i * dst_dt_size;
@@ -167,38 +287,44 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
 }
 
 status_t jit_uni_reduction_t::get_proper_kernel(
-        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
+        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf,
+        jit_reduction_stage_t stage) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
-                new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
+        return safe_ptr_assign(kernel,
+                new jit_uni_reduction_kernel_t<avx512_core_bf16>(
+                        conf, dst_md, stage));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
-                new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
+        return safe_ptr_assign(kernel,
+                new jit_uni_reduction_kernel_t<avx512_core>(
+                        conf, dst_md, stage));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
-                                conf, dst_md));
+                                conf, dst_md, stage));
             else
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
+                return safe_ptr_assign(kernel,
+                        new jit_uni_reduction_kernel_t<avx2>(
+                                conf, dst_md, stage));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
-                                conf, dst_md));
+                                conf, dst_md, stage));
             else
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
+                return safe_ptr_assign(kernel,
+                        new jit_uni_reduction_kernel_t<avx>(
+                                conf, dst_md, stage));
         }
     } else if (conf.isa == sse41)
-        return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+        return safe_ptr_assign(kernel,
+                new jit_uni_reduction_kernel_t<sse41>(conf, dst_md, stage));
     else
         return status::runtime_error;
 }
@@ -36,8 +36,9 @@ static const bcast_set_t &get_supported_postops_bcast_strategies() {
 
 template <cpu_isa_t isa, typename Vmm>
 jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
-        const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
-    : jit_uni_reduction_kernel_base_t(conf)
+        const jit_reduction_conf_t &conf, const memory_desc_t *dst_md,
+        jit_reduction_stage_t stage)
+    : jit_uni_reduction_kernel_base_t(conf, stage)
     , load_tail_size_(conf.reduce_size % simd_w_)
     , io_load_(this, isa, conf_.src_type, {false},
               io::io_tail_conf_t {simd_w_, load_tail_size_, k_tail_load_mask_,
@@ -55,7 +56,16 @@ jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
                       vmm_saturation_ubound_.getIdx(), reg_tmp_}) {
     init_compute_op();
     init_compute_scalar_op();
-    if (conf_.with_postops) init_post_ops_injector(dst_md);
+    if (conf_.with_postops && stage_ != jit_reduction_stage_t::partial)
+        init_post_ops_injector(dst_md);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+bool jit_uni_reduction_kernel_t<isa, Vmm>::is_norm() const {
+    using namespace alg_kind;
+    return utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -66,13 +76,22 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
     const Xmm xmm_tmp_(vmm_tmp1_.getIdx());
     float starting_val = 0;
 
+    if (stage_ == jit_reduction_stage_t::finalize) {
+        uni_vmovss(Xmm(vmm_acc_.getIdx()), ptr[reg_src_]);
+        return;
+    }
+
     switch (conf_.alg) {
         case reduction_max:
             starting_val = numeric_limits<float>::lowest();
             break;
         case reduction_min: starting_val = numeric_limits<float>::max(); break;
         case reduction_mean:
-        case reduction_sum: starting_val = 0.f; break;
+        case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: starting_val = 0.f; break;
         case reduction_mul: starting_val = 1.f; break;
         default: assert(!"unknown alg");
     }
@@ -98,6 +117,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_op_ = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                 uni_vaddps(acc, acc, to_acc);
             };
@@ -130,6 +153,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_scalar_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_scalar_op_
                     = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                           addss(acc, to_acc);
@@ -262,6 +289,15 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_vmm_to_scalar(
     }
 }
 
+// Lp-norms accumulate |x|^p, only p = 1 and p = 2 are supported
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_norm_power(const Vmm &vmm) {
+    if (conf_.p == 1.f)
+        uni_vandps(vmm, vmm, vmm_abs_mask_);
+    else
+        uni_vmulps(vmm, vmm, vmm);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
     Label label_work_begin, label_work_end;
@@ -271,6 +307,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
         cmp(reg_work_, 0);
         je(label_work_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        if (is_norm()) apply_norm_power(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -281,10 +318,18 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
     L(label_work_end);
 
     if (load_tail_size_) {
+        // Only the last chunk of a row has the tail in the partial stage
+        Label label_tail_end;
+        if (stage_ == jit_reduction_stage_t::partial) {
+            cmp(qword[reg_param_ + GET_OFF(with_tail)], 0);
+            je(label_tail_end, T_NEAR);
+        }
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        if (is_norm()) apply_norm_power(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
+        L(label_tail_end);
     }
 }
 
@@ -292,7 +337,10 @@ template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::load_params() {
     mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
     mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
-    mov(reg_work_, conf_.reduce_size / simd_w_);
+    if (stage_ == jit_reduction_stage_t::partial)
+        mov(reg_work_, ptr[reg_param_ + GET_OFF(reduce_work)]);
+    else
+        mov(reg_work_, conf_.reduce_size / simd_w_);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -337,13 +385,40 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(const int data_idx) {
     postops_injector_->compute_vector(data_idx, rhs_arg_params);
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_norm_finalize(
+        const Xmm &xmm_acc) {
+    using namespace alg_kind;
+
+    const Xmm xmm_eps(vmm_tmp1_.getIdx());
+    mov(reg_tmp_.cvt32(), float2int(conf_.eps));
+    uni_vmovd(xmm_eps, reg_tmp_.cvt32());
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max,
+                reduction_norm_lp_power_p_max))
+        uni_vmaxss(xmm_acc, xmm_acc, xmm_eps);
+    else
+        uni_vaddss(xmm_acc, xmm_acc, xmm_eps);
+
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum)
+            && conf_.p == 2.f)
+        uni_vsqrtps(xmm_acc, xmm_acc);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
-    if (static_cast<std::size_t>(conf_.reduce_size) > load_tail_size_) {
+    if (stage_ != jit_reduction_stage_t::finalize
+            && static_cast<std::size_t>(conf_.reduce_size) > load_tail_size_) {
         reduce_vmm_to_scalar(
                 vmm_acc_, vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, simd_w_);
     }
 
+    if (stage_ == jit_reduction_stage_t::partial) {
+        uni_vmovss(ptr[reg_dst_], Xmm(vmm_acc_.getIdx()));
+        return;
+    }
+
+    if (is_norm()) apply_norm_finalize(Xmm(vmm_acc_.getIdx()));
+
     if (conf_.alg == alg_kind::reduction_mean) {
         const Xmm xmm_acc(vmm_acc_.getIdx());
         const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
@@ -367,9 +442,16 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
     if (load_tail_size_ > 0) io_load_.prepare_tail_mask();
     io_store_.prepare_tail_mask();
 
+    if (is_norm() && conf_.p == 1.f) {
+        const Xmm xmm_abs_mask(vmm_abs_mask_.getIdx());
+        mov(reg_tmp_.cvt32(), 0x7fffffff);
+        uni_vmovd(xmm_abs_mask, reg_tmp_.cvt32());
+        uni_vbroadcastss(vmm_abs_mask_, xmm_abs_mask);
+    }
+
     load_params();
     init_acc();
-    reduce();
+    if (stage_ != jit_reduction_stage_t::finalize) reduce();
     finalize();
 
     postamble();
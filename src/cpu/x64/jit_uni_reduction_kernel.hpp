@@ -33,12 +33,20 @@ namespace impl {
 namespace cpu {
 namespace x64 {
 
+// full: reduces a whole reduce_size row and stores the final result.
+// partial: reduces a chunk of a row and stores the f32 accumulator.
+// finalize: loads a combined f32 accumulator, applies the algorithm final
+// step and post-ops and stores the result.
+enum class jit_reduction_stage_t { full, partial, finalize };
+
 struct jit_uni_reduction_kernel_base_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reduction)
 
-    jit_uni_reduction_kernel_base_t(const jit_reduction_conf_t &conf)
+    jit_uni_reduction_kernel_base_t(
+            const jit_reduction_conf_t &conf, jit_reduction_stage_t stage)
         : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, conf.isa)
         , conf_(conf)
+        , stage_(stage)
         , sum_scales_(conf_.sum_scales) {}
     virtual ~jit_uni_reduction_kernel_base_t() = default;
 
@@ -46,13 +54,15 @@ struct jit_uni_reduction_kernel_base_t : public jit_generator {
 
 protected:
     const jit_reduction_conf_t &conf_;
+    const jit_reduction_stage_t stage_;
     std::queue<float> sum_scales_;
 };
 
 template <cpu_isa_t isa, typename Vmm = typename cpu_isa_traits<isa>::Vmm>
 struct jit_uni_reduction_kernel_t : public jit_uni_reduction_kernel_base_t {
-    jit_uni_reduction_kernel_t(
-            const jit_reduction_conf_t &conf, const memory_desc_t *dst_md);
+    jit_uni_reduction_kernel_t(const jit_reduction_conf_t &conf,
+            const memory_desc_t *dst_md,
+            jit_reduction_stage_t stage = jit_reduction_stage_t::full);
 
     virtual ~jit_uni_reduction_kernel_t() = default;
 
@@ -62,6 +72,7 @@ private:
     using compute_fn_t = std::function<void(
             const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc)>;
 
+    bool is_norm() const;
     void init_acc();
     void init_compute_op();
     void init_compute_scalar_op();
@@ -81,11 +92,13 @@ private:
             const std::size_t number_of_values_to_reduce
             = number_of_f32_in_zmm_);
 
+    void apply_norm_power(const Vmm &vmm);
     void reduce();
 
     void load_params();
     void apply_sum(const int data_idx);
     void apply_postops(const int data_idx);
+    void apply_norm_finalize(const Xbyak::Xmm &xmm_acc);
     void finalize();
     void generate() override;
 
@@ -100,6 +113,7 @@ private:
     const Vmm vmm_tmp4_ = Vmm(8);
     const Vmm vmm_sum_scale_ = Vmm(9);
     const Vmm rhs_dt_helper_vmm_ = Vmm(10);
+    const Vmm vmm_abs_mask_ = Vmm(11);
     const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
     const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
     const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
@@ -165,16 +165,19 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         using namespace data_type;
 
         bool ok = true && p.ndims > 0
-                && utils::one_of(p.itype, f32, bf16, s32, s8, u8)
-                && utils::one_of(p.otype, f32, bf16, s32, s8, u8)
+                && utils::one_of(p.itype, f32, bf16, f16, s32, s8, u8)
+                && utils::one_of(p.otype, f32, bf16, f16, s32, s8, u8)
                 && IMPLICATION(p.itype == bf16,
                         utils::one_of(p.otype, s8, u8, f32, bf16))
                 && IMPLICATION(p.otype == bf16,
                         utils::one_of(p.itype, s8, u8, f32, bf16))
+                && IMPLICATION(p.itype == f16, utils::one_of(p.otype, f32, f16))
+                && IMPLICATION(p.otype == f16, utils::one_of(p.itype, f32, f16))
                 && utils::everyone_is(0, p.ioff, p.ooff) /* do we need this? */
                 && utils::one_of(p.beta, 0.f, 1.f) /* anything else? */
                 && simple_impl_desc_init(p, nullptr) && mayiuse(sse41)
-                && IMPLICATION((p.itype == bf16 || p.otype == bf16),
+                && IMPLICATION(utils::one_of(bf16, p.itype, p.otype)
+                                || utils::one_of(f16, p.itype, p.otype),
                         mayiuse(avx512_core))
                 && prb_has_small_strides(p);
 
@@ -261,6 +264,10 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                               vpmovzxwd(dst, src);
                               vpslld(dst, dst, 0x10);
                               break;
+                          case f16:
+                              vcvtph2ps(dst,
+                                      src.isMEM() ? src : Xmm(src.getIdx()));
+                              break;
                           case s32: vcvtdq2ps(dst, src); break;
                           case s8:
                               vpmovsxbd(dst, src);
@@ -289,6 +296,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         }
                     }
                     break;
+                case f16:
+                    if (idt == f32) vcvtps2ph(xmm, ymm, _op_mxcsr);
+                    break;
                 case s32:
                     if (idt == f32)
                         vcvtps2dq(ymm, ymm);
@@ -415,8 +425,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         // have to be equal to 1.
 
         return mayiuse(avx2) && prb_.ndims >= 2
-                && ((utils::one_of(prb_.itype, u8, s8, s32, f32, bf16)
-                        && utils::one_of(prb_.otype, u8, s8, s32, f32, bf16)))
+                && ((utils::one_of(prb_.itype, u8, s8, s32, f32, bf16, f16)
+                        && utils::one_of(
+                                prb_.otype, u8, s8, s32, f32, bf16, f16)))
                 && utils::everyone_is(desirable_node_size, prb_.n(0), prb_.n(1))
                 && utils::everyone_is(desirable_stride, prb_.os(0), prb_.is(1))
                 && !prb_.is_tail_present
@@ -548,6 +559,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                                   break;
                               } else
                                   assert("unreachable!");
+                          case f16: vcvtph2ps(dst, src); break;
                           case s32: uni_vcvtdq2ps(dst, src); break;
                           case s8:
                               uni_vpmovsxbd(dst, src);
@@ -576,6 +588,9 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         }
                     }
                     break;
+                case f16:
+                    if (idt == f32) vcvtps2ph(xmm, xmm, _op_mxcsr);
+                    break;
                 case s32:
                     if (idt == f32)
                         uni_vcvtps2dq(xmm, xmm);
@@ -866,7 +881,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                         } else if (utils::one_of(prb_.otype, s8, u8)) {
                             uni_vpinsrb(
                                     xmm_tmp_, xmm_tmp_, o_addr(o_off[ur]), 0x0);
-                        } else if (prb_.otype == bf16) {
+                        } else if (utils::one_of(prb_.otype, bf16, f16)) {
                             uni_vpinsrw(
                                     xmm_tmp_, xmm_tmp_, o_addr(o_off[ur]), 0x0);
                         } else {
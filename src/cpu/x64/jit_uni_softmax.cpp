@@ -24,9 +24,12 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_uni_softmax.hpp"
 
 #if __INTEL_COMPILER && __INTEL_COMPILER < 1900
@@ -44,6 +47,19 @@ namespace x64 {
 
 using namespace Xbyak;
 
+namespace softmax_impl {
+static const bcast_set_t &get_supported_bcast_strategies() {
+    static const bcast_set_t supported_strategies
+            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+                    broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::per_mb_spatial,
+                    broadcasting_strategy_t::per_mb_w,
+                    broadcasting_strategy_t::per_w,
+                    broadcasting_strategy_t::no_broadcast};
+    return supported_strategies;
+}
+} // namespace softmax_impl
+
 template <cpu_isa_t isa>
 struct jit_softmax_base_t : public jit_generator {
     struct call_params_t {
@@ -52,6 +68,10 @@ struct jit_softmax_base_t : public jit_generator {
         const void *interim; // scratch memory for intermediate storage
         const void *oscale; // oscale defined for all data type cases
         size_t process_n_elems;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig; // dst base for binary post-ops offsets
+        const void *src_scale;
+        const void *softmax_mask; // mask row of the processed src row
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
 
@@ -67,6 +87,8 @@ struct jit_softmax_base_t : public jit_generator {
     virtual void operator()(const call_params_t *p) = 0;
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> log_injector_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
+            postops_injector_;
 
     Reg64 reg_param = abi_param1;
 
@@ -84,9 +106,14 @@ struct jit_softmax_base_t : public jit_generator {
     Reg64 reg_diff_dst_spat_offt = reg_log_injector_table;
     Reg64 reg_interim = reg_diff_dst;
     Reg64 reg_interim_spat_offt = abi_not_param1;
-    Reg64 reg_output_scale = rsi;
+    Reg64 reg_output_scale = rdx;
+    // Both are preserved by the post-ops injectors. They must not be rax, rdx
+    // or r8, which the binary injector uses to convert dst offsets.
+    Reg64 reg_po_helper_1 = rsi;
+    Reg64 reg_po_helper_2 = rbp;
 
     Opmask injector_mask = Opmask(1);
+    Opmask tail_opmask = Opmask(2);
 
     Vmm vtmp; // assigned at placed where used
     Vmm tail_vmask = Vmm(0);
@@ -99,12 +126,19 @@ struct jit_softmax_base_t : public jit_generator {
     Vmm vsbr = vsum; // must be not equal to vmax
     Vmm vzero = Vmm(isa == avx512_core ? 21 : 11);
     Vmm vsaturation_ubound = vneg_flt_max;
+    Vmm vpo_rhs_helper = Vmm(isa == avx512_core ? 20 : 10);
+    Vmm vsrc_scale = Vmm(isa == avx512_core ? 19 : 9);
 
     bool is_bf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
     bool axis_is_blocked_;
     bool need_scratchpad_;
+    bool with_postops_ = false;
+    bool with_binary_ = false;
+    bool with_src_scale_ = false;
+    bool with_softmax_mask_ = false;
+    bool softmax_mask_bcast_axis_ = false;
 
     size_t simd_w_ = 0;
     size_t unroll_regs_ = 4;
@@ -164,6 +198,10 @@ struct jit_softmax_base_t : public jit_generator {
             mov(reg_interim, ptr[reg_param + PARAM_OFF(interim)]);
         }
         mov(reg_output_scale, ptr[reg_param + PARAM_OFF(oscale)]);
+        if (with_src_scale_) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(src_scale)]);
+            uni_vbroadcastss(vsrc_scale, ptr[reg_tmp]);
+        }
 #undef PARAM_OFF
     }
 
@@ -187,6 +225,39 @@ struct jit_softmax_base_t : public jit_generator {
         return vmmword[reg_diff_dst + reg_diff_dst_spat_offt + offt];
     }
 
+    void init_postops_injector() {
+        using namespace binary_injector;
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        const eltwise_injector::static_params_t esp(true /*save_state*/,
+                reg_po_helper_1, injector_mask, true /*is_fwd*/,
+                false /*use_dst*/);
+        const rhs_arg_static_params_t rhs_arg_sp(vpo_rhs_helper.getIdx(),
+                reg_po_helper_1, reg_po_helper_2, true /*preserve gpr*/,
+                true /*preserve vmm*/, PARAM_OFF(post_ops_binary_rhs_arg_vec),
+                PARAM_OFF(dst_orig), dst_d_, axis_simd_tail_, tail_opmask,
+                false /*use_exact_tail_scalar_bcast*/);
+#undef PARAM_OFF
+        const static_params_t bsp(reg_param,
+                softmax_impl::get_supported_bcast_strategies(), rhs_arg_sp);
+        postops_injector_.reset(new injector::jit_uni_postops_injector_t<isa>(
+                this, pd_->attr()->post_ops_, bsp, esp));
+    }
+
+    // Applies post-ops to Vmm(1)..Vmm(unroll) holding the final values of
+    // the dst elements at `dst_ptr(dst_axis_stride_ * i)`.
+    void apply_postops(int unroll, bool tail) {
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        if (with_binary_) {
+            for (int i = 0; i < unroll; i++) {
+                const int vmm_idx = i + 1;
+                rhs_arg_params.vmm_idx_to_out_addr.emplace(
+                        vmm_idx, dst_ptr(dst_axis_stride_ * i));
+                if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+            }
+        }
+        postops_injector_->compute_vector_range(1, unroll + 1, rhs_arg_params);
+    }
+
     enum class op_t : unsigned { max, sum };
 
     void perform_op(Vmm v, Vmm vtmp, op_t op) {
@@ -284,6 +355,7 @@ struct jit_softmax_base_t : public jit_generator {
         }
 
         compute_predefined_variables();
+        if (with_postops_) init_postops_injector();
         preamble();
         initialization_hook();
         if (exp_injector_) exp_injector_->load_table_addr();
@@ -297,6 +369,7 @@ struct jit_softmax_base_t : public jit_generator {
         postamble();
         if (exp_injector_) exp_injector_->prepare_table();
         if (log_injector_) log_injector_->prepare_table();
+        if (postops_injector_) postops_injector_->prepare_table();
     }
 
     jit_softmax_base_t(const softmax_pd_t *pd)
@@ -310,6 +383,19 @@ struct jit_softmax_base_t : public jit_generator {
         simd_w_ = vlen / sizeof(float); // bf16 works on ymms
         need_scratchpad_ = utils::one_of(
                 dst_d_.data_type(), data_type::u8, data_type::s8);
+        if (pd_->is_fwd()) {
+            const auto &po = pd_->attr()->post_ops_;
+            with_postops_ = !po.has_default_values();
+            with_binary_ = po.find(primitive_kind::binary) != -1;
+
+            const auto *fwd_pd = static_cast<const softmax_fwd_pd_t *>(pd_);
+            with_src_scale_ = !pd_->attr()
+                                       ->scales_.get(DNNL_ARG_SRC)
+                                       .has_default_values();
+            with_softmax_mask_ = fwd_pd->with_softmax_mask();
+            softmax_mask_bcast_axis_ = with_softmax_mask_
+                    && fwd_pd->softmax_mask_md()->dims[pd_->axis()] == 1;
+        }
     }
 };
 
@@ -327,8 +413,6 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
     Zmm bf16_emu_zmm_5 = Zmm(27);
     Reg64 bf16_emu_gpr = reg_tmp;
 
-    Opmask tail_opmask = Opmask(2);
-
     void store(const Address &addr, const Vmm &vmm, data_type_t dt,
             bool tail = false) {
         auto effective_addr = addr;
@@ -403,6 +487,25 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
         }
     };
 
+    // Loads the i-th source vector of the unrolled body, scaled by the source
+    // scale and with the softmax mask added. Tail lanes are zeroed.
+    void load_src(const Vmm &vmm, int i, bool tail) {
+        load(vmm, src_ptr(src_axis_stride_ * i), src_d_.data_type(), tail);
+        if (with_src_scale_) uni_vmulps(vmm, vmm, vsrc_scale);
+        if (with_softmax_mask_) {
+            // The mask row is dense f32, so the source offset is rescaled
+            const int idx_scale = sizeof(float) / src_d_.data_type_size();
+            mov(reg_tmp,
+                    ptr[reg_param + offsetof(call_params_t, softmax_mask)]);
+            const Address mask_addr = softmax_mask_bcast_axis_
+                    ? zword_b[reg_tmp]
+                    : zword[reg_tmp + reg_src_spat_offt * idx_scale
+                            + i * vlen];
+            const Vmm effective_vmm = tail ? vmm | tail_opmask | T_z : vmm;
+            vaddps(effective_vmm, vmm, mask_addr);
+        }
+    }
+
     void prepare_tail_mask() override {
         const int mask_f32 = (1 << axis_simd_tail_) - 1;
         Reg32 regw_tmp = reg_tmp.cvt32();
@@ -428,8 +531,7 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
-                        src_d_.data_type(), tail);
+                load_src(vreg_tmp_src, i, tail);
                 if (tail)
                     uni_vmaxps(vmax | tail_opmask, vmax, vreg_tmp_src);
                 else
@@ -452,8 +554,7 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
-                        src_d_.data_type(), tail);
+                load_src(vreg_tmp_src, i, tail);
                 uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
                 if (is_logsoftmax_) { // store before applying exp
                     if (need_scratchpad_) {
@@ -508,6 +609,10 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
                 Vmm vscale = vmax;
                 uni_vmovups(vscale, ptr[reg_output_scale]);
                 uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
+            }
+            if (with_postops_) apply_postops(unroll, tail);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
                 store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
                         dst_d_.data_type(), tail);
             }
@@ -832,6 +937,55 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
     jit_softmax_t(const softmax_pd_t *pd) : jit_softmax_base_t(pd) {}
 };
 
+// Post-ops are applied by the avx512_core kernel only.
+template <cpu_isa_t isa>
+bool jit_uni_softmax_fwd_t<isa>::pd_t::pre_ops_ok() const {
+    using namespace format_tag;
+    const bool with_src_scale
+            = !attr()->scales_.get(DNNL_ARG_SRC).has_default_values();
+    if (!with_src_scale && !with_softmax_mask()) return true;
+    if (!is_superset(isa, avx512_core)) return false;
+
+    // The mask row of a source row is addressed as a single dense vector
+    const memory_desc_wrapper src_d(src_md());
+    return IMPLICATION(with_softmax_mask(),
+            axis() == ndims() - 1
+                    && src_d.matches_one_of_tag(a, ab, abc, abcd, abcde, abcdef)
+                            != undef);
+}
+
+template <cpu_isa_t isa>
+bool jit_uni_softmax_fwd_t<isa>::pd_t::post_ops_ok() const {
+    using namespace injector;
+    const auto &po = attr()->post_ops_;
+    if (po.has_default_values()) return true;
+    if (!is_superset(isa, avx512_core)) return false;
+
+    const memory_desc_wrapper dst_d(dst_md());
+    bool is_per_oc_sp_bcast {}, is_per_mb_sp_bcast {}, is_per_mb_w_bcast {},
+            is_per_w_bcast {};
+    std::tie(is_per_oc_sp_bcast, is_per_mb_sp_bcast, is_per_mb_w_bcast,
+            is_per_w_bcast)
+            = binary_injector_utils::bcast_strategies_present_tup(
+                    po.entry_, dst_d,
+                    broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::per_mb_spatial,
+                    broadcasting_strategy_t::per_mb_w,
+                    broadcasting_strategy_t::per_w);
+    const int nd = ndims();
+    const bool bcast_ok = IMPLICATION(is_per_oc_sp_bcast, nd < 4)
+            && IMPLICATION(is_per_mb_sp_bcast, utils::one_of(nd, 3, 4))
+            && IMPLICATION(is_per_mb_w_bcast, utils::one_of(nd, 3, 4))
+            && IMPLICATION(is_per_w_bcast, utils::one_of(nd, 3, 4));
+    return bcast_ok
+            && injector::post_ops_ok(post_ops_ok_args_t(isa,
+                    {eltwise, binary}, po, &dst_d,
+                    false /*sum_at_pos_0_only*/,
+                    false /*sum_requires_scale_one*/,
+                    false /*sum_requires_zp_zero*/,
+                    softmax_impl::get_supported_bcast_strategies()));
+}
+
 template <cpu_isa_t isa>
 jit_uni_softmax_fwd_t<isa>::jit_uni_softmax_fwd_t(const pd_t *apd)
     : primitive_t(apd)
@@ -854,6 +1008,15 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto scratchpad_ptr = ctx.get_scratchpad_grantor().template get<char>(
             memory_tracking::names::key_softmax_interim_store);
     const float *oscales = pd()->attr()->output_scales_.scales_;
+    const float *src_scales = nullptr;
+    ASSIGN_INPUT_SCALE_VALUE(src_scales, DNNL_ARG_SRC);
+    const auto softmax_mask
+            = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SOFTMAX_MASK);
+    if (pd()->with_softmax_mask() && !softmax_mask)
+        return status::invalid_arguments;
+    const auto &post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -872,6 +1035,22 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     const int nthr = pd()->nthr_;
 
+    // With the softmax mask, the source is row-major with the axis innermost,
+    // so the outer index enumerates the leading dimensions in row-major order.
+    const int outer_ndims = pd()->ndims() - 1;
+    const memory_desc_wrapper mask_d(pd()->softmax_mask_md());
+    auto softmax_mask_row = [&](dim_t ou) -> const float * {
+        if (!softmax_mask) return nullptr;
+        dim_t off = 0;
+        for (int d = outer_ndims - 1; d >= 0; --d) {
+            const dim_t dim = src_d.dims()[d];
+            if (mask_d.dims()[d] != 1)
+                off += (ou % dim) * mask_d.blocking_desc().strides[d];
+            ou /= dim;
+        }
+        return softmax_mask + off;
+    };
+
     parallel_nd_ext(nthr, outer_size, inner_size,
             [&](int ithr, int, dim_t ou, dim_t in) {
                 dim_t offset = (ou * outer_stride + in * inner_stride);
@@ -882,7 +1061,8 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                                                    : nullptr;
                 const auto *oscale_ptr = oscales;
                 softmax_driver_->exec(src_ptr, dst_ptr, interim_ptr, oscale_ptr,
-                        process_n_elems);
+                        process_n_elems, post_ops_binary_rhs_arg_vec.data(),
+                        dst, src_scales, softmax_mask_row(ou));
             });
 
     return status::success;
@@ -945,13 +1125,19 @@ struct driver_t : public c_compatible {
     driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
 
     void exec(const void *src, void *dst, void *interim, const void *oscale,
-            const dim_t process_n_elems) {
+            const dim_t process_n_elems,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
+            const void *src_scale, const void *softmax_mask) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.process_n_elems = process_n_elems;
         p.src = src;
         p.dst = dst;
         p.interim = interim;
         p.oscale = oscale;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+        p.dst_orig = dst_orig;
+        p.src_scale = src_scale;
+        p.softmax_mask = softmax_mask;
         ker_(&p);
     }
 
@@ -82,14 +82,20 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                                     || utils::one_of(s8, src_dt, dst_dt)
                                     || utils::one_of(u8, src_dt, dst_dt)),
                             is_superset(isa, avx512_core))
-                    && attr()->has_default_values(skip_mask_t::oscale)
-                    && attr_oscale_ok()
-                    && set_default_formats() == status::success;
+                    && attr()->has_default_values(skip_mask_t::oscale
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::scales_runtime
+                            | skip_mask_t::softmax_mask)
+                    && attr_oscale_ok() && attr_post_ops_ok()
+                    && attr_scales_ok() && attr_softmax_mask_ok()
+                    && set_default_formats() == status::success
+                    && attr_.set_default_formats(dst_md(0)) == status::success;
             if (!ok) return status::unimplemented;
 
             ok = memory_desc_wrapper(src_md()).similar_to(
                          memory_desc_wrapper(dst_md()), true, false, 0)
-                    && is_dense(); // not dense impl can be easily done
+                    && is_dense() // not dense impl can be easily done
+                    && pre_ops_ok() && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             nthr_ = dnnl_get_max_threads();
@@ -101,6 +107,11 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         int nthr_; // To not exceed the limit in execute used for set up.
 
     private:
+        // The source scale and the softmax mask are applied on the source
+        // load, before the maximum is computed
+        bool pre_ops_ok() const;
+        bool post_ops_ok() const;
+
         void init_scratchpad() {
             if (utils::one_of(
                         dst_md()->data_type, data_type::u8, data_type::s8)) {
@@ -0,0 +1,240 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_sum.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+#define GET_OFF(field) offsetof(jit_uni_sum_call_s, field)
+
+template <typename Vmm>
+void jit_uni_sum_kernel_t::load(const Vmm &vmm, int offt, int nelems) {
+    const Xmm xmm = Xmm(vmm.getIdx());
+    switch (jsp_.src_dt) {
+        case f32:
+            if (nelems == 1)
+                vmovss(xmm, dword[reg_addr + offt]);
+            else
+                uni_vmovups(vmm, ptr[reg_addr + offt]);
+            return;
+        case s8:
+            if (nelems == 1) {
+                movsx(reg_tmp.cvt32(), byte[reg_addr + offt]);
+                vmovd(xmm, reg_tmp.cvt32());
+            } else
+                vpmovsxbd(vmm, ptr[reg_addr + offt]);
+            break;
+        case u8:
+            if (nelems == 1) {
+                movzx(reg_tmp.cvt32(), byte[reg_addr + offt]);
+                vmovd(xmm, reg_tmp.cvt32());
+            } else
+                vpmovzxbd(vmm, ptr[reg_addr + offt]);
+            break;
+        default: assert(!"unsupported source data type");
+    }
+    vcvtdq2ps(vmm, vmm);
+}
+
+template <typename Vmm>
+void jit_uni_sum_kernel_t::store(const Vmm &vmm, int offt, int nelems) {
+    constexpr bool is_zmm = std::is_same<Vmm, Zmm>::value;
+    const Xmm xmm = Xmm(vmm.getIdx());
+
+    if (jsp_.dst_dt == f32) {
+        if (nelems == 1)
+            vmovss(dword[reg_addr + offt], xmm);
+        else
+            uni_vmovups(ptr[reg_addr + offt], vmm);
+        return;
+    }
+
+    saturate_f32(vmm, Vmm(lbound_idx()), Vmm(ubound_idx()), jsp_.dst_dt,
+            true /* force_lbound */);
+    vcvtps2dq(vmm, vmm);
+    if (nelems == 1) {
+        vmovd(reg_tmp.cvt32(), xmm);
+        mov(byte[reg_addr + offt], reg_tmp.cvt8());
+    } else if (is_zmm) {
+        // values are already saturated, so both conversions are exact
+        if (jsp_.dst_dt == s8)
+            vpmovsdb(ptr[reg_addr + offt], vmm);
+        else
+            vpmovusdb(ptr[reg_addr + offt], vmm);
+    } else {
+        store_data(jsp_.dst_dt, Ymm(vmm.getIdx()), reg_addr, offt, nelems);
+    }
+}
+
+template <typename Vmm>
+void jit_uni_sum_kernel_t::loop_iteration(int unroll, int nelems) {
+    const int src_size = types::data_type_size(jsp_.src_dt);
+    const int dst_size = types::data_type_size(jsp_.dst_dt);
+    const Vmm vmm_scale = Vmm(scale_idx());
+
+    for (int i = 0; i < unroll; i++)
+        uni_vpxor(Vmm(acc_idx(i)), Vmm(acc_idx(i)), Vmm(acc_idx(i)));
+
+    for (int a = 0; a < jsp_.num_srcs; a++) {
+        mov(reg_src, ptr[reg_srcs + a * sizeof(void *)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_scales + a * sizeof(float)]);
+        lea(reg_addr, ptr[reg_src + reg_idx * src_size]);
+        for (int i = 0; i < unroll; i++) {
+            load(Vmm(src_idx(i)), i * jsp_.simd_w * src_size, nelems);
+            vfmadd231ps(Vmm(acc_idx(i)), Vmm(src_idx(i)), vmm_scale);
+        }
+    }
+
+    lea(reg_addr, ptr[reg_dst + reg_idx * dst_size]);
+    for (int i = 0; i < unroll; i++)
+        store(Vmm(acc_idx(i)), i * jsp_.simd_w * dst_size, nelems);
+}
+
+template <typename Vmm>
+void jit_uni_sum_kernel_t::compute() {
+    init_saturate_f32(Vmm(lbound_idx()), Vmm(ubound_idx()), reg_tmp, f32,
+            jsp_.dst_dt, true /* force_lbound */);
+
+    for (const int unroll : {jsp_.loop_unroll, 1}) {
+        const int step = unroll * jsp_.simd_w;
+        Label loop, loop_end;
+        L(loop);
+        {
+            cmp(reg_sz, step);
+            jl(loop_end, T_NEAR);
+            loop_iteration<Vmm>(unroll, jsp_.simd_w);
+            add(reg_idx, step);
+            sub(reg_sz, step);
+            jmp(loop, T_NEAR);
+        }
+        L(loop_end);
+    }
+
+    Label tail_loop, tail_end;
+    L(tail_loop);
+    {
+        cmp(reg_sz, 0);
+        jle(tail_end, T_NEAR);
+        loop_iteration<Vmm>(1, 1);
+        inc(reg_idx);
+        dec(reg_sz);
+        jmp(tail_loop, T_NEAR);
+    }
+    L(tail_end);
+}
+
+void jit_uni_sum_kernel_t::generate() {
+    preamble();
+
+    mov(reg_srcs, ptr[reg_param + GET_OFF(srcs)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_scales, ptr[reg_param + GET_OFF(scales)]);
+    mov(reg_sz, ptr[reg_param + GET_OFF(size)]);
+    xor_(reg_idx, reg_idx);
+
+    if (jsp_.isa == avx512_core)
+        compute<Zmm>();
+    else
+        compute<Ymm>();
+
+    postamble();
+}
+
+#undef GET_OFF
+
+status_t jit_uni_sum_kernel_t::init_conf(jit_uni_sum_conf_t &jsp,
+        int num_srcs, data_type_t src_dt, data_type_t dst_dt) {
+    if (!mayiuse(avx2)) return status::unimplemented;
+
+    jsp.num_srcs = num_srcs;
+    jsp.src_dt = src_dt;
+    jsp.dst_dt = dst_dt;
+    jsp.isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    jsp.simd_w = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    if (jsp.isa == avx512_core)
+        jsp.simd_w = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    // 2 * unroll + 3 vector registers are used: accumulators, loaded values,
+    // the scale and the saturation bounds
+    jsp.loop_unroll = jsp.isa == avx512_core ? 8 : 4;
+    jsp.size_blocking = jsp.simd_w * jsp.loop_unroll;
+
+    return status::success;
+}
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+status_t jit_uni_sum_t<src_data_type, dst_data_type>::execute(
+        const exec_ctx_t &ctx) const {
+    auto output = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+    const memory_desc_wrapper o_d(pd()->dst_md());
+    output += o_d.blk_off(0);
+    const int num_arrs = pd()->n_inputs();
+    const dim_t nelems = o_d.nelems(true);
+    const src_data_t *input_ptrs[jit_uni_sum_kernel_t::max_num_arrs];
+    for (int a = 0; a < num_arrs; ++a) {
+        const memory_desc_wrapper i_d(pd()->src_md(a));
+        input_ptrs[a]
+                = CTX_IN_MEM(const src_data_t *, DNNL_ARG_MULTIPLE_SRC + a)
+                + i_d.blk_off(0);
+    }
+
+    // The block of all inputs and the output fits into a half of L1, so
+    // every input stream is read once and the output is written once.
+    const dim_t half_L1 = 16 * 1024; // bytes
+    const dim_t num_elems_in_block = utils::rnd_up(
+            utils::div_up(half_L1,
+                    num_arrs * sizeof(src_data_t) + sizeof(dst_data_t)),
+            pd()->jsp_.size_blocking);
+    const dim_t num_blocks = utils::div_up(nelems, num_elems_in_block);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(num_blocks, nthr, ithr, start, end);
+        auto arg = jit_uni_sum_call_s();
+        const src_data_t *local_input_ptrs[jit_uni_sum_kernel_t::max_num_arrs];
+
+        for (dim_t nb = start; nb < end; ++nb) {
+            const dim_t start_e = nb * num_elems_in_block;
+            for (int a = 0; a < num_arrs; ++a)
+                local_input_ptrs[a] = &input_ptrs[a][start_e];
+            arg.srcs = (const void **)local_input_ptrs;
+            arg.dst = (const void *)&output[start_e];
+            arg.scales = pd()->scales();
+            arg.size = nstl::min(num_elems_in_block, nelems - start_e);
+            (*kernel_)(&arg);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sum_t<f32, f32>;
+template struct jit_uni_sum_t<s8, s8>;
+template struct jit_uni_sum_t<u8, u8>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
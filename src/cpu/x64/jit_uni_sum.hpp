@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SUM_HPP
+#define CPU_X64_JIT_UNI_SUM_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sum_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_uni_sum_conf_t {
+    int num_srcs;
+    cpu_isa_t isa;
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    int simd_w;
+    int loop_unroll;
+    int size_blocking; /* number of elements processed by one iteration of
+                          the main unrolled loop */
+};
+
+struct jit_uni_sum_call_s {
+    const void **srcs;
+    const void *dst;
+    const float *scales;
+    dim_t size;
+};
+
+// Computes dst = sum_i(scales[i] * srcs[i]) in a single pass: every block of
+// dst is accumulated in registers over all the inputs and stored once.
+struct jit_uni_sum_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sum_kernel_t)
+
+    jit_uni_sum_kernel_t(const jit_uni_sum_conf_t &jsp)
+        : jit_generator(jit_name()), jsp_(jsp) {}
+
+    static status_t init_conf(jit_uni_sum_conf_t &jsp, int num_srcs,
+            data_type_t src_dt, data_type_t dst_dt);
+
+    static constexpr int max_num_arrs = 32;
+
+    bool is_relocatable() const override { return true; }
+
+private:
+    const jit_uni_sum_conf_t jsp_;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_srcs = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_scales = r10;
+    const Xbyak::Reg64 reg_sz = r11;
+    const Xbyak::Reg64 reg_src = r12;
+    const Xbyak::Reg64 reg_idx = r13;
+    const Xbyak::Reg64 reg_tmp = r14;
+    const Xbyak::Reg64 reg_addr = r15;
+
+    // Vector registers: accumulators [0, unroll), loaded values
+    // [unroll, 2 * unroll), then the scale and the saturation bounds.
+    int acc_idx(int i) const { return i; }
+    int src_idx(int i) const { return jsp_.loop_unroll + i; }
+    int scale_idx() const { return 2 * jsp_.loop_unroll; }
+    int lbound_idx() const { return 2 * jsp_.loop_unroll + 1; }
+    int ubound_idx() const { return 2 * jsp_.loop_unroll + 2; }
+
+    void generate() override;
+
+    template <typename Vmm>
+    void compute();
+    template <typename Vmm>
+    void loop_iteration(int unroll, int nelems);
+    template <typename Vmm>
+    void load(const Vmm &vmm, int offt, int nelems);
+    template <typename Vmm>
+    void store(const Vmm &vmm, int offt, int nelems);
+};
+
+template <data_type_t src_data_type, data_type_t dst_data_type>
+struct jit_uni_sum_t : public primitive_t {
+    struct pd_t : public cpu_sum_pd_t {
+        using cpu_sum_pd_t::cpu_sum_pd_t;
+
+        DECLARE_SUM_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", jsp_.isa, ""), jit_uni_sum_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = mayiuse(avx2)
+                    && cpu_sum_pd_t::init(engine) == status::success
+                    && src_mds_.size()
+                            <= jit_uni_sum_kernel_t::max_num_arrs;
+            if (!ok) return status::unimplemented;
+
+            const memory_desc_wrapper o_d(&dst_md_);
+            ok = o_d.data_type() == dst_data_type && o_d.is_dense(true);
+            if (!ok) return status::unimplemented;
+
+            for (size_t i = 0; i < src_mds_.size(); ++i) {
+                const memory_desc_wrapper i_d(&src_mds_[i]);
+                ok = src_data_type == i_d.data_type()
+                        && o_d.similar_to(i_d, true, false, 0)
+                        && i_d.is_dense(true);
+                if (!ok) return status::unimplemented;
+            }
+
+            return jit_uni_sum_kernel_t::init_conf(jsp_, (int)src_mds_.size(),
+                    src_data_type, dst_data_type);
+        }
+
+        jit_uni_sum_conf_t jsp_;
+    };
+
+    jit_uni_sum_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(kernel_, new jit_uni_sum_kernel_t(pd()->jsp_)));
+        return kernel_->create_kernel();
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+    typedef typename prec_traits<src_data_type>::type src_data_t;
+    typedef typename prec_traits<dst_data_type>::type dst_data_t;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<jit_uni_sum_kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -51,6 +51,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             && one_of(dst_dt, u8, s8, s32, f32, bf16);
     const bool is_bf16
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
+    // f16 and packed 4-bit weights are up-converted to f32 by the copy
+    // routine for B, 4-bit weights require the decompression parameters
+    const bool with_wei_decomp = !attr()->wei_decomp_.has_default_values();
+    const bool is_f16_wei = everyone_is(f32, src_dt, dst_dt) && wei_dt == f16
+            && isa == avx512_core;
+    const bool is_4bit_wei = everyone_is(f32, src_dt, dst_dt)
+            && one_of(wei_dt, s4, u4) && with_wei_decomp && isa == avx512_core;
 
     auto check_bias = [&]() -> bool {
         const bool is_bia_dt_correct
@@ -58,7 +65,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                           && one_of(weights_md(1)->data_type, f32, s32, s8, u8,
                                   bf16))
                 || (is_bf16 && one_of(weights_md(1)->data_type, f32, bf16))
-                || (is_f32 && weights_md(1)->data_type == f32);
+                || ((is_f32 || is_f16_wei || is_4bit_wei)
+                        && weights_md(1)->data_type == f32);
         return IMPLICATION(with_bias(), is_bia_dt_correct && is_bias_1xN());
     };
 
@@ -71,14 +79,22 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     auto check_attr_zero_points
             = [&]() -> bool { return attr()->zero_points_.common(); };
 
-    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32;
-    bool ok = mayiuse(isa) && problem_dt_correct
-            && !has_runtime_dims_or_strides()
+    // Only a runtime M is supported, the rest is checked on conf init
+    auto check_runtime_dims = [&]() -> bool {
+        return IMPLICATION(has_runtime_dims_or_strides(),
+                is_runtime_value(dst_md_.dims[dst_md_.ndims - 2]));
+    };
+
+    const bool problem_dt_correct
+            = is_int8 || is_bf16 || is_f32 || is_f16_wei || is_4bit_wei;
+    bool ok = mayiuse(isa) && problem_dt_correct && check_runtime_dims()
             && attr()->has_default_values(primitive_attr_t::skip_mask_t::oscale
                             | primitive_attr_t::skip_mask_t::zero_points_runtime
+                            | primitive_attr_t::skip_mask_t::wei_decomp
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt,
                     dst_dt)
+            && IMPLICATION(with_wei_decomp, is_f16_wei || is_4bit_wei)
             && attr()->post_ops_.check_sum_consistent_dt(dst_dt)
             && check_attr_oscale() && check_attr_zero_points() && check_bias();
     if (!ok) return status::unimplemented;
@@ -86,59 +102,17 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
-    const float alpha = 1.0;
-    const float beta = 1.0;
-    const float beta_init = 0.0;
-
     for_(int i_bs = 0; i_bs < 2; i_bs++)
     for_(int i_init = 0; i_init < 2; i_init++)
     for_(int i_M = 0; i_M < 2; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
     for (int i_K = 0; i_K < 2; i_K++) {
-        auto vbeta = (i_init) ? beta_init : beta;
         auto vM = (i_M) ? bgmmc_.M_tail : bgmmc_.M_blk;
-        auto vN = (i_N) ? bgmmc_.N_tail : bgmmc_.N_blk;
-        auto vK = (i_K) ? bgmmc_.K_tail : bgmmc_.K_blk;
 
-        int bs = get_brg_batchsize(bgmmc_, i_bs, i_K);
         int idx = get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
         brgemm_t &brg = brg_descs_[idx];
-        auto LDA = i_K && bgmmc_.use_buffer_a_tail_only
-                ? (dim_t)bgmmc_.wei_k_blk
-                : bgmmc_.LDA;
-        CHECK(brgemm_desc_init(&brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
-                bgmmc_.wei_dt, false, false, brgemm_row_major, alpha, vbeta,
-                LDA, bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
-
-        auto LDD = bgmmc_.LDD;
-        CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
-
-        brgemm_attr_t brgattr;
-        brgattr.generate_skip_accumulation
-                = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
-        constexpr bool is_amx = one_of(
-                isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
-        if (is_amx) {
-            if (!brgattr.generate_skip_accumulation) {
-                // TODO: uker doesn't yet support generate_skip_accumulation
-                brgattr.use_uker = true;
-                brgattr.use_interleave_stores = true;
-            }
-            brgattr.max_bs = bs;
-            brgattr.wary_tail_read = false;
-
-            // TODO: change expected sizes to local chunks wrt L2 blocking
-            brgattr.hint_expected_A_size = vM * vK * bs;
-            brgattr.hint_expected_B_size = vN * vK * bs;
-            brgattr.hint_expected_C_size = vM * vN * bs;
-            brgattr.hint_innermost_loop = brgemm_ld_loop_innermost;
-            brgattr.hint_prefetching
-                    = brgemm_kernel_prefetching_t::brgemm_prf_output1;
-        }
-
-        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(init_brg_desc(&brg, vM, i_bs, i_init, i_N, i_K));
         bgmmc_.wsp_tile_per_thr_bytes = nstl::max(
                 brg.get_wsp_buffer_size(), bgmmc_.wsp_tile_per_thr_bytes);
     }
@@ -149,6 +123,57 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_brg_desc(brgemm_t *brg, dim_t vM,
+        bool is_bs_tail, bool do_initialization, bool is_N_tail,
+        bool is_K_tail) const {
+    const float alpha = 1.0;
+    const float beta = 1.0;
+    const float beta_init = 0.0;
+
+    auto vbeta = (do_initialization) ? beta_init : beta;
+    auto vN = (is_N_tail) ? bgmmc_.N_tail : bgmmc_.N_blk;
+    auto vK = (is_K_tail) ? bgmmc_.K_tail : bgmmc_.K_blk;
+
+    int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+    auto LDA = is_K_tail && bgmmc_.use_buffer_a_tail_only
+            ? (dim_t)bgmmc_.wei_k_blk
+            : bgmmc_.LDA;
+    const auto brg_wei_dt
+            = bgmmc_.with_wei_decompression ? f32 : bgmmc_.wei_dt;
+    CHECK(brgemm_desc_init(brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
+            brg_wei_dt, false, false, brgemm_row_major, alpha, vbeta, LDA,
+            bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
+
+    auto LDD = bgmmc_.LDD;
+    CHECK(brgemm_desc_set_postops(brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+
+    brgemm_attr_t brgattr;
+    brgattr.generate_skip_accumulation
+            = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+    constexpr bool is_amx = one_of(
+            isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    if (is_amx) {
+        if (!brgattr.generate_skip_accumulation) {
+            // TODO: uker doesn't yet support generate_skip_accumulation
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        brgattr.max_bs = bs;
+        brgattr.wary_tail_read = false;
+
+        // TODO: change expected sizes to local chunks wrt L2 blocking
+        brgattr.hint_expected_A_size = vM * vK * bs;
+        brgattr.hint_expected_B_size = vN * vK * bs;
+        brgattr.hint_expected_C_size = vM * vN * bs;
+        brgattr.hint_innermost_loop = brgemm_ld_loop_innermost;
+        brgattr.hint_prefetching
+                = brgemm_kernel_prefetching_t::brgemm_prf_output1;
+    }
+
+    return brgemm_desc_set_attr(brg, brgattr);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     for_(int i_bs = 0; i_bs < 2; i_bs++)
@@ -193,10 +218,40 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     DEFINE_ZERO_POINT_VALUE(wei_zero_point, DNNL_ARG_WEIGHTS);
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
 
-    brg_matmul_exec_ctx_t brgmm_ctx(
-            ctx, pd(), src_zero_point, wei_zero_point, dst_zero_point);
+    const auto &conf = pd()->get_brgemm_matmul_conf();
+    if (conf.wei_decomp_group_size > 0
+            && CTX_IN_MEM(const float *,
+                       DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES)
+                    == nullptr)
+        return status::invalid_arguments;
+    if (conf.with_wei_decomp_zero_points
+            && CTX_IN_MEM(const int8_t *,
+                       DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS)
+                    == nullptr)
+        return status::invalid_arguments;
+
+    // For a runtime M the M-dependent part of the configuration and the
+    // M tail kernels are resolved from the actual destination dims.
+    brgemm_matmul_conf_t runtime_bgmmc;
+    const brg_M_tail_kernels_t *M_tail_kernels = nullptr;
+    if (pd()->get_brgemm_matmul_conf().is_runtime_M) {
+        const memory_desc_wrapper dst_d = ctx.memory_mdw(DNNL_ARG_DST);
+        const dim_t M = dst_d.dims()[dst_d.ndims() - 2];
+        if (M == 0) return status::success;
+
+        runtime_bgmmc = pd()->get_brgemm_matmul_conf();
+        update_runtime_M_values(runtime_bgmmc, M);
+        if (runtime_bgmmc.M_tail > 0)
+            CHECK(get_M_tail_kernels(runtime_bgmmc, &M_tail_kernels));
+    }
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(),
+            pd()->get_brgemm_matmul_conf().is_runtime_M
+                    ? runtime_bgmmc
+                    : pd()->get_brgemm_matmul_conf(),
+            M_tail_kernels, src_zero_point, wei_zero_point, dst_zero_point);
+
+    const auto &bgmmc = brgmm_ctx.get_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     constexpr bool is_amx
@@ -253,13 +308,79 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_M_tail_kernels(
+        const brgemm_matmul_conf_t &bgmmc,
+        const brg_M_tail_kernels_t **M_tail_kernels) const {
+    {
+        utils::lock_read_t lock_r(M_tail_kernels_mutex_);
+        const auto it = M_tail_kernels_.find(bgmmc.M_tail);
+        if (it != M_tail_kernels_.end()) {
+            *M_tail_kernels = it->second.get();
+            return status::success;
+        }
+    }
+
+    utils::lock_write_t lock_w(M_tail_kernels_mutex_);
+    auto it = M_tail_kernels_.find(bgmmc.M_tail);
+    if (it == M_tail_kernels_.end()) {
+        // The kernels are generated at execution, out of the accuracy mode
+        // scope set at the primitive creation
+        scoped_accuracy_mode_t scoped_accuracy(pd()->attr()->accuracy_mode_);
+        std::unique_ptr<brg_M_tail_kernels_t> tail_kernels(
+                new brg_M_tail_kernels_t());
+        for_(int i_bs = 0; i_bs < 2; i_bs++)
+        for_(int i_N = 0; i_N < 2; i_N++)
+        for_(int i_K = 0; i_K < 2; i_K++)
+        for (int i_init = 0; i_init < 2; i_init++) {
+            const int bs = get_brg_batchsize(bgmmc, i_bs, i_K);
+            const int idx = get_brg_kernel_index(
+                    bgmmc, i_bs, i_init, true, i_N, i_K, bs);
+            if (idx < 0) continue;
+
+            brgemm_t brg;
+            CHECK(pd()->init_brg_desc(
+                    &brg, bgmmc.M_tail, i_bs, i_init, i_N, i_K));
+            brgemm_kernel_t *ker = nullptr;
+            CHECK(brgemm_kernel_create(&ker, brg));
+            CHECK(safe_ptr_assign(tail_kernels->kernels[idx], ker));
+            if (one_of(isa, avx512_core_bf16_amx_int8,
+                        avx512_core_bf16_amx_bf16))
+                CHECK(brgemm_init_tiles(brg, &tail_kernels->palettes[idx][0]));
+        }
+        it = M_tail_kernels_.emplace(bgmmc.M_tail, std::move(tail_kernels))
+                     .first;
+    }
+    *M_tail_kernels = it->second.get();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+const brgemm_kernel_t *brgemm_matmul_t<isa>::get_brg_kernel(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int idx) const {
+    const auto M_tail_kernels = brgmm_ctx.get_M_tail_kernels();
+    if (M_tail_kernels && M_tail_kernels->kernels[idx])
+        return M_tail_kernels->kernels[idx].get();
+    return brg_kernels_[idx].get();
+}
+
+template <cpu_isa_t isa>
+const char *brgemm_matmul_t<isa>::get_brg_kernel_palette(
+        const brg_matmul_exec_ctx_t &brgmm_ctx, int idx) const {
+    const auto M_tail_kernels = brgmm_ctx.get_M_tail_kernels();
+    if (M_tail_kernels && M_tail_kernels->kernels[idx])
+        return &M_tail_kernels->palettes[idx][0];
+    return &brg_kernel_palettes_[idx][0];
+}
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::compute_kernel(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int m_blk_idx, int n_blk_idx, int k_chunk_idx, bool do_init) const {
     constexpr bool is_amx
             = one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_conf();
     const auto addr_batch = brgmm_ctx.get_batch_elem_ptr(ithr);
     const int base_brg_ker_idx = brgmm_ctx.get_base_brgemm_kernel_idx();
 
@@ -280,7 +401,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const bool is_K_tail
             = is_last_K_chunk && (gemm_batch * bgmmc.K_blk) != remaining_k_blks;
     auto is_bs_tail = (gemm_batch != bgmmc.brgemm_batch_size);
-    const int brg_ker_idx = pd()->get_brg_kernel_idx(
+    const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
             is_bs_tail, do_init, is_M_tail, is_N_tail, false);
     const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
     auto ptr_D = brgmm_ctx.get_data_C_ptr(b_idx, m, n);
@@ -298,12 +419,12 @@ void brgemm_matmul_t<isa>::compute_kernel(
             && (bgmmc.nthr_k <= 1 || bgmmc.K_chunks == 1);
 
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel = get_brg_kernel(brgmm_ctx, brg_ker_idx);
         assert(brg_kernel != nullptr);
 
         const bool is_tile_reconf_required = is_amx && (is_M_tail || is_N_tail);
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            amx_tile_configure(get_brg_kernel_palette(brgmm_ctx, brg_ker_idx));
 
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, 0, gemm_batch, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
@@ -346,13 +467,13 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 ithr, gemm_batch, 1, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
 
         const bool use_init_ker = (do_init && gemm_batch == 0);
-        const int brg_ker_idx = pd()->get_brg_kernel_idx(
+        const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
                 false, use_init_ker, is_M_tail, is_N_tail, true);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail = get_brg_kernel(brgmm_ctx, brg_ker_idx);
         const bool is_tile_reconf_required
                 = is_amx && bgmmc.K_tail != bgmmc.K_blk;
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            amx_tile_configure(get_brg_kernel_palette(brgmm_ctx, brg_ker_idx));
         if (post_ops_applicable) {
             void *scratch = is_amx
                     ? static_cast<void *>(wsp_tile)
@@ -392,7 +513,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
         const brg_matmul_exec_ctx_t &brgmm_ctx) const {
     if (!brgmm_ctx.parallel_reduction_is_used()) return;
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_conf();
     const int num_threads = brgmm_ctx.get_num_threads_for_parallelization();
 
     parallel(num_threads, [&](const int ithr, const int nthr) {
@@ -446,9 +567,10 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                     for (int nb = nb_start; nb < nb_end; nb++) {
                         const bool is_N_tail
                                 = (bgmmc.N - nb * bgmmc.N_blk < bgmmc.N_blk);
-                        const int brg_ker_idx = pd()->get_brg_kernel_idx(
+                        const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
                                 false, false, is_M_tail, is_N_tail, false);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel
+                                = get_brg_kernel(brgmm_ctx, brg_ker_idx);
                         const int m = mb * bgmmc.M_blk;
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -505,7 +627,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int m_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_conf();
 
     auto ctx = jit_brgemm_matmul_copy_a_t::ctx_t();
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
@@ -552,7 +674,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int n_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_conf();
 
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
     const bool is_K_tail
@@ -567,29 +689,44 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             = (void *)brgmm_ctx.get_zp_a_compensation_ptr(ithr, n_blk_idx);
     ctx.zp_a_neg_value_ptr = (void *)brgmm_ctx.get_zp_a_neg_val_ptr();
 
+    // The decompression parameters are the same for all the rows of a copy
+    // kernel call, so the rows are split at the group boundaries
+    auto copy_B = [&](int gb, int k, int K_iters) {
+        char *tr_src = brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
+        const int group_size = bgmmc.wei_decomp_group_size;
+        for (int k_iter = 0; k_iter < K_iters;) {
+            const int k_cur = k + k_iter;
+            int iters = K_iters - k_iter;
+            if (group_size > 0)
+                iters = nstl::min(iters, group_size - k_cur % group_size);
+
+            ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k_cur, n);
+            ctx.tr_src = (void *)(tr_src
+                    + k_iter * bgmmc.LDB * bgmmc.tr_b_dt_sz);
+            ctx.compensation_ptr = (void *)brgmm_ctx.get_s8s8_comp_ptr(
+                    ithr, b_idx, n_blk_idx);
+            ctx.wei_decomp_scales_ptr
+                    = (void *)brgmm_ctx.get_wei_decomp_scales_ptr(k_cur, n);
+            ctx.wei_decomp_zero_points_ptr
+                    = (void *)brgmm_ctx.get_wei_decomp_zero_points_ptr(
+                            k_cur, n);
+            ctx.current_K_start = k_cur;
+            ctx.current_K_iters = iters;
+
+            (*copy_B_kernel_)(&ctx);
+            k_iter += iters;
+        }
+    };
+
     int gb = 0;
     for (; gb < gemm_batch; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
-        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
-        ctx.compensation_ptr
-                = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
-        ctx.current_K_start = k;
-        ctx.current_K_iters = nstl::min(bgmmc.K_blk, bgmmc.K);
-
-        (*copy_B_kernel_)(&ctx);
+        copy_B(gb, k, nstl::min(bgmmc.K_blk, bgmmc.K));
     }
 
     if (is_K_tail) {
         const int k = k_start + gb * bgmmc.K_blk;
-        ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
-        ctx.tr_src = (void *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx);
-        ctx.compensation_ptr
-                = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
-        ctx.current_K_start = k;
-        ctx.current_K_iters = bgmmc.K % bgmmc.K_blk;
-
-        (*copy_B_kernel_)(&ctx);
+        copy_B(gb, k, bgmmc.K % bgmmc.K_blk);
     }
 }
 
@@ -608,9 +745,11 @@ void brgemm_matmul_t<isa>::accumulate(
 
 template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
-    brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd, int32_t src_zp,
+    brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
+            const brgemm_matmul_conf_t &bgmmc,
+            const brg_M_tail_kernels_t *M_tail_kernels, int32_t src_zp,
             int32_t wei_zp, int32_t dst_zp)
-        : bgmmc_(pd->get_brgemm_matmul_conf()) {
+        : bgmmc_(bgmmc), M_tail_kernels_(M_tail_kernels) {
 
         data_A_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
         data_B_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
@@ -618,8 +757,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
         oscales_ptr_ = pd->attr()->output_scales_.scales_;
+        wei_decomp_scales_ptr_ = CTX_IN_MEM(
+                const float *, DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES);
+        wei_decomp_zero_points_ptr_ = CTX_IN_MEM(const int8_t *,
+                DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS);
         memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
-        const auto &bgmmc = pd->get_brgemm_matmul_conf();
 
         batch_element_ptr_ = scratchpad.template get<brgemm_batch_element_t>(
                 key_brgemm_primitive_batch);
@@ -778,6 +920,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const char *get_data_B_ptr(int b, int k, int n) const {
         int cur_b = get_bb_idx(b, bgmmc_.bcast_B_desc);
+        // Offsets of packed 4-bit weights are computed in elements
+        if (one_of(bgmmc_.wei_dt, s4, u4))
+            return data_B_ptr_ + get_data_B_off(cur_b, k, n) / 2;
         return data_B_ptr_ + get_data_B_off(cur_b, k, n);
     }
 
@@ -955,6 +1100,19 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return &zero_point_a_negative_val_;
     }
 
+    // The decompression parameters are shared by all the matrices of a batch
+    const float *get_wei_decomp_scales_ptr(int k, int n) const {
+        if (bgmmc_.wei_decomp_group_size == 0) return nullptr;
+        const dim_t g = k / bgmmc_.wei_decomp_group_size;
+        return wei_decomp_scales_ptr_ + g * bgmmc_.N + n;
+    }
+
+    const int8_t *get_wei_decomp_zero_points_ptr(int k, int n) const {
+        if (!bgmmc_.with_wei_decomp_zero_points) return nullptr;
+        const dim_t g = k / bgmmc_.wei_decomp_group_size;
+        return wei_decomp_zero_points_ptr_ + g * bgmmc_.N + n;
+    }
+
     const int32_t *get_zp_b_neg_val_ptr() const {
         return &zero_point_b_negative_val_;
     }
@@ -1016,6 +1174,19 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     int get_base_brgemm_kernel_idx() const { return base_brg_ker_idx_; }
 
+    int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
+            bool is_M_tail, bool is_N_tail, bool is_K_tail) const {
+        int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+        return get_brg_kernel_index(bgmmc_, is_bs_tail, do_initialization,
+                is_M_tail, is_N_tail, is_K_tail, bs);
+    }
+
+    const brg_M_tail_kernels_t *get_M_tail_kernels() const {
+        return M_tail_kernels_;
+    }
+
+    const brgemm_matmul_conf_t &get_conf() const { return bgmmc_; }
+
     bool is_last_K_chunk(int k_chunk_idx) const {
         return k_chunk_idx == bgmmc_.K_chunks - 1;
     }
@@ -1047,6 +1218,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 private:
     bool is_amx_;
     const brgemm_matmul_conf_t &bgmmc_;
+    const brg_M_tail_kernels_t *M_tail_kernels_;
     const char *data_A_ptr_;
     const char *data_B_ptr_;
     char *data_C_ptr_;
@@ -1059,6 +1231,8 @@ private:
     char *wsp_tile_ptr_;
     const char *bias_ptr_;
     const float *oscales_ptr_;
+    const float *wei_decomp_scales_ptr_;
+    const int8_t *wei_decomp_zero_points_ptr_;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
@@ -1085,6 +1259,8 @@ template struct brgemm_matmul_t<avx512_core_bf16_amx_bf16>;
 template struct brgemm_matmul_t<avx512_core_bf16>;
 template struct brgemm_matmul_t<avx512_core_vnni>;
 template struct brgemm_matmul_t<avx512_core>;
+template struct brgemm_matmul_t<avx2_vnni>;
+template struct brgemm_matmul_t<avx2>;
 
 } // namespace matmul
 } // namespace x64
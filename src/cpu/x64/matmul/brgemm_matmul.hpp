@@ -17,8 +17,11 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <unordered_map>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
+#include "common/rw_mutex.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
@@ -78,6 +81,9 @@ struct brgemm_matmul_t : public primitive_t {
             return get_brg_kernel_index(bgmmc_, is_bs_tail, do_initialization,
                     is_M_tail, is_N_tail, is_K_tail, bs);
         }
+        status_t init_brg_desc(brgemm_t *brg, dim_t vM, bool is_bs_tail,
+                bool do_initialization, bool is_N_tail, bool is_K_tail) const;
+
         const brgemm_t &get_brg_desc(int idx) const { return brg_descs_[idx]; }
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
@@ -101,6 +107,12 @@ struct brgemm_matmul_t : public primitive_t {
 private:
     struct brg_matmul_exec_ctx_t;
 
+    // Kernels for the M tail of a runtime M, only M tail indices are set
+    struct brg_M_tail_kernels_t {
+        std::unique_ptr<brgemm_kernel_t> kernels[max_num_brg_kernels_matmul];
+        char palettes[max_num_brg_kernels_matmul][64];
+    };
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
@@ -114,6 +126,12 @@ private:
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
+    status_t get_M_tail_kernels(const brgemm_matmul_conf_t &bgmmc,
+            const brg_M_tail_kernels_t **M_tail_kernels) const;
+    const brgemm_kernel_t *get_brg_kernel(
+            const brg_matmul_exec_ctx_t &brgmm_ctx, int idx) const;
+    const char *get_brg_kernel_palette(
+            const brg_matmul_exec_ctx_t &brgmm_ctx, int idx) const;
 
     std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
     char brg_kernel_palettes_[max_num_brg_kernels_matmul][64];
@@ -121,6 +139,11 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+
+    // M tail kernels are generated on first use of a given tail size
+    mutable utils::rw_mutex_t M_tail_kernels_mutex_;
+    mutable std::unordered_map<dim_t, std::unique_ptr<brg_M_tail_kernels_t>>
+            M_tail_kernels_;
 };
 
 } // namespace matmul
@@ -388,7 +388,7 @@ struct jit_brgemm_matmul_copy_a_transposed_impl_t
         , m_loop_dst_shift(columns_step * dst_stride)
         , k_loop_src_shift(rows_step * src_stride)
         , k_loop_dst_shift(rows_step * typesize)
-        , is_f32(everyone_is(data_type::f32, conf_->src_dt, conf_->wei_dt)) {}
+        , is_f32(conf_->src_dt == data_type::f32) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -1556,8 +1556,13 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
     jit_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
         , jit_generator(jit_name())
-        , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
-                                             : conf_->N * typesize)
+        , src_typesize_(conf_->b_dt_sz)
+        , is_wei_4bit_(one_of(conf_->wei_dt, data_type::s4, data_type::u4))
+        , with_scales_(conf_->wei_decomp_group_size > 0)
+        , with_zero_points_(conf_->with_wei_decomp_zero_points)
+        , src_stride_(conf_->wei_tag == acbd
+                          ? conf_->copy_B_wei_stride
+                          : conf_->N * src_typesize_ / (is_wei_4bit_ ? 2 : 1))
         , tr_src_stride_(conf_->LDB * typesize) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
@@ -1569,11 +1574,16 @@ private:
     using opmask_t = const Xbyak::Opmask;
     using zmm = const Xbyak::Zmm;
 
-    enum { typesize = sizeof(float), n_blk_step = 16, max_regs_available = 30 };
+    enum { typesize = sizeof(float), n_blk_step = 16, max_regs_available = 27 };
+    const dim_t src_typesize_;
+    const bool is_wei_4bit_, with_scales_, with_zero_points_;
     dim_t src_stride_, tr_src_stride_;
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    // Masks for the bytes of packed 4-bit weights, a byte holds 2 columns
+    opmask_t kTail4bit = k5;
+    opmask_t kFF = k4;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -1581,9 +1591,14 @@ private:
     reg64_t reg_K_iters = r8;
     reg64_t reg_N_blk = r9;
     reg64_t reg_K_start = r10;
+    reg64_t reg_scales = r11;
+    reg64_t reg_zero_points = r12;
     reg32_t regw_tmp = r14d;
     reg64_t imm_addr64 = r15;
 
+    zmm zmm_4bit_permd = zmm27;
+    zmm zmm_4bit_shift = zmm28;
+    zmm zmm_tmp = zmm29;
     zmm zmm_permw = zmm30;
     zmm zmm_zero = zmm31;
 
@@ -1604,16 +1619,58 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_x_n_block(
         return zmm(reg_idx);
     };
 
-    auto load = [=](int blk, int k, int n, opmask_t current_mask) {
+    // Packed 4-bit values are unpacked from 8 bytes into 16 dwords:
+    // every byte is duplicated, moved so that the nibble of the column lands
+    // into the topmost bits and shifted back with a sign or zero extension
+    auto load_4bit = [=](const zmm &src_zmm, int k, int n, bool is_tail) {
+        const auto addr
+                = EVEX_compress_addr(reg_src, k * src_stride_ + n / 2);
+        const auto src_ymm = Xbyak::Ymm(src_zmm.getIdx());
+        vpmovzxbd(src_ymm | (is_tail ? kTail4bit : kFF) | T_z, addr);
+        vpermd(src_zmm, zmm_4bit_permd, src_zmm);
+        vpsllvd(src_zmm, src_zmm, zmm_4bit_shift);
+        if (conf_->wei_dt == data_type::s4)
+            vpsrad(src_zmm, src_zmm, 28);
+        else
+            vpsrld(src_zmm, src_zmm, 28);
+    };
+
+    auto load = [=](int blk, int k, int n, bool is_tail) {
+        const opmask_t current_mask = is_tail ? kTail : kFFFF;
         auto src_zmm = get_zmm(blk);
         auto src_zmm_m = src_zmm | current_mask | T_z;
-        vmovups(src_zmm_m,
-                EVEX_compress_addr(reg_src, k * src_stride_ + n * typesize));
+        if (is_wei_4bit_) {
+            load_4bit(src_zmm, k, n, is_tail);
+            if (with_zero_points_) {
+                vpmovsxbd(zmm_tmp | current_mask | T_z,
+                        EVEX_compress_addr(reg_zero_points, n));
+                vpsubd(src_zmm, src_zmm, zmm_tmp);
+            }
+            vcvtdq2ps(src_zmm, src_zmm);
+        } else {
+            const auto addr = EVEX_compress_addr(
+                    reg_src, k * src_stride_ + n * src_typesize_);
+            if (conf_->wei_dt == data_type::f16)
+                vcvtph2ps(src_zmm_m, addr);
+            else
+                vmovups(src_zmm_m, addr);
+            if (with_zero_points_) {
+                vpmovsxbd(zmm_tmp | current_mask | T_z,
+                        EVEX_compress_addr(reg_zero_points, n));
+                vcvtdq2ps(zmm_tmp, zmm_tmp);
+                vsubps(src_zmm, src_zmm, zmm_tmp);
+            }
+        }
+        if (with_scales_)
+            vmulps(src_zmm_m, src_zmm,
+                    EVEX_compress_addr(reg_scales, n * sizeof(float)));
     };
 
     const int columns_tail = ncolumns % n_blk_step;
     const auto tail_mask = (1 << columns_tail) - 1;
     if (columns_tail < n_blk_step) kmovw(kTail, tail_mask);
+    if (is_wei_4bit_ && columns_tail < n_blk_step)
+        kmovw(kTail4bit, (1 << div_up(columns_tail, 2)) - 1);
 
     int iter = 0;
     for_(int k = 0; k < nrows; k++)
@@ -1627,9 +1684,8 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_x_n_block(
             continue;
         }
 
-        const opmask_t curr_msk = zero_padding < n_blk_step ? kTail : kFFFF;
         const int blk_idx = iter % max_regs_available;
-        load(blk_idx, k, n, curr_msk);
+        load(blk_idx, k, n, zero_padding < n_blk_step);
 
         const auto src_zmm0 = get_zmm(blk_idx);
         vmovups(store_addr, src_zmm0);
@@ -1671,6 +1727,27 @@ void jit_brgemm_matmul_copy_b_f32_t::generate() {
     mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
     kmovw(kFFFF, 0xffff); // 1111111111111111
 
+    if (with_scales_)
+        mov(reg_scales, ptr[param1 + GET_OFF(wei_decomp_scales_ptr)]);
+    if (with_zero_points_)
+        mov(reg_zero_points,
+                ptr[param1 + GET_OFF(wei_decomp_zero_points_ptr)]);
+    if (is_wei_4bit_) {
+        alignas(64) static constexpr const int32_t permd_4bit[16]
+                = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7};
+        alignas(64) static constexpr const int32_t shift_4bit[16]
+                = {28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28,
+                        24};
+        auto vmovdqa32 = [=](zmm z, const int32_t *addr) {
+            mov(imm_addr64, reinterpret_cast<size_t>(addr));
+            jit_generator::vmovdqa32(z, ptr[imm_addr64]);
+        };
+
+        kmovw(kFF, 0xff);
+        vmovdqa32(zmm_4bit_permd, permd_4bit);
+        vmovdqa32(zmm_4bit_shift, shift_4bit);
+    }
+
     Label done;
     if (conf_->N_tail > 0) {
         Label not_N_tail;
@@ -2114,7 +2191,8 @@ status_t create_brgemm_matmul_copy_b(
                     abcdefhg, abcdefgih, abcdefghji, abcdefghikj, abcdefghijlk);
     const bool is_bf16
             = everyone_is(data_type::bf16, conf->src_dt, conf->wei_dt);
-    const bool is_f32 = everyone_is(data_type::f32, conf->src_dt, conf->wei_dt);
+    const bool is_f32 = everyone_is(data_type::f32, conf->src_dt, conf->wei_dt)
+            || conf->with_wei_decompression;
     if (is_B_transposed) {
         CHECK(safe_ptr_assign(
                 copy_ker, new jit_brgemm_matmul_copy_b_transposed_t(conf)));
@@ -87,7 +87,9 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
             && IMPLICATION(
                     is_binary_po_per_w_bcast, utils::one_of(ndims, 3, 4));
     return supported_binary_bcast
-            && injector::post_ops_ok(post_ops_ok_args_t(get_max_cpu_isa(),
+            && injector::post_ops_ok(post_ops_ok_args_t(
+                    is_superset(bgmmc.isa, avx512_core) ? get_max_cpu_isa()
+                                                         : avx2,
                     {sum, eltwise, binary}, post_ops, &dst_d,
                     false /*sum_at_pos_0_only*/,
                     false /*sum_requires_scale_one*/,
@@ -103,13 +105,15 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
 
 status_t check_isa_with_datatype(
         const cpu_isa_t isa, const brgemm_matmul_conf_utils_t &bm_conf_utils) {
-    const bool ok = IMPLICATION(bm_conf_utils.is_f32(), isa == avx512_core)
+    const bool ok = IMPLICATION(bm_conf_utils.is_f32(),
+                            one_of(isa, avx512_core, avx2))
             && IMPLICATION(bm_conf_utils.is_int8(),
-                    one_of(isa, avx512_core_bf16_amx_int8, avx512_core_vnni))
+                    one_of(isa, avx512_core_bf16_amx_int8, avx512_core_vnni,
+                            avx2_vnni))
             && IMPLICATION(bm_conf_utils.is_bf16(),
                     one_of(isa, avx512_core_bf16_amx_bf16, avx512_core_bf16))
             && IMPLICATION(bm_conf_utils.is_int8_with_bf16_dst(),
-                    mayiuse(avx512_core_vnni));
+                    is_superset(isa, avx512_core_vnni));
     return ok ? status::success : status::unimplemented;
 }
 
@@ -117,7 +121,8 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
         brgemm_matmul_conf_t &bgmmc, bool A_any_layout, bool B_any_layout,
         bool C_any_layout, bool bias_any_layout)
     : bgmmc(bgmmc)
-    , f32_dt(utils::everyone_is(f32, bgmmc.src_dt, bgmmc.wei_dt, bgmmc.dst_dt))
+    , f32_dt(utils::everyone_is(f32, bgmmc.src_dt, bgmmc.dst_dt)
+              && (bgmmc.wei_dt == f32 || bgmmc.with_wei_decompression))
     , bf16_dt(utils::everyone_is(bf16, bgmmc.src_dt, bgmmc.wei_dt)
               && one_of(bgmmc.dst_dt, bf16, f32))
     , int8_dt(utils::one_of(bgmmc.src_dt, u8, s8) && bgmmc.wei_dt == s8
@@ -243,7 +248,8 @@ status_t brgemm_matmul_conf_utils_t::set_B_flags(memory_desc_t &B_md) const {
 
 format_tag_t brgemm_matmul_conf_utils_t::pick_blocked_B_layout(
         int n_blk) const {
-    if (bgmmc.ndims > 2) return format_tag::undef;
+    if (bgmmc.ndims > 2 || bgmmc.with_wei_decompression)
+        return format_tag::undef;
     if (this->is_int8()) switch (n_blk) {
             case 64: return BA16a64b4a;
             case 48: return BA16a48b4a;
@@ -508,6 +514,7 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
             = div_up(static_cast<int>(bgmmc.K), min_k_per_thread);
     const bool is_amx_bf16 = bgmmc.isa == avx512_core_bf16_amx_bf16;
     const int max_nthr_k = is_amx_bf16 && bgmmc.batch == 1
+                    && !bgmmc.is_runtime_M
             ? nstl::min(saturate(1, 7, bgmmc.nthr / 8), max_k_parallel_work)
             : 1;
     int iter = 0;
@@ -758,11 +765,18 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.with_wei_decompression = everyone_is(f32, bgmmc.src_dt, bgmmc.dst_dt)
+            && one_of(bgmmc.wei_dt, f16, s4, u4);
+    bgmmc.wei_decomp_group_size = attr.wei_decomp_.group_size_;
+    bgmmc.with_wei_decomp_zero_points = attr.wei_decomp_.with_zero_points_;
+    // 4-bit weights are meaningless without the decompression parameters
+    if (one_of(bgmmc.wei_dt, s4, u4) && bgmmc.wei_decomp_group_size == 0)
+        return status::unimplemented;
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
     bgmmc.s8s8_compensation_required
-            = isa == avx512_core_vnni && bgmmc.src_dt == s8;
+            = one_of(isa, avx512_core_vnni, avx2_vnni) && bgmmc.src_dt == s8;
     bgmmc.ndims = dst_d.ndims();
 
     brgemm_matmul_conf_utils_t bm_conf_utils(bgmmc,
@@ -781,6 +795,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     bgmmc.a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    bgmmc.tr_b_dt_sz = bgmmc.with_wei_decompression
+            ? types::data_type_size(f32)
+            : bgmmc.b_dt_sz;
     bgmmc.c_dt_sz = types::data_type_size(bgmmc.dst_dt);
     bgmmc.acc_dt_sz = types::data_type_size(bgmmc.acc_dt);
     if (bgmmc.with_bias) bgmmc.bias_dt_sz = types::data_type_size(bgmmc.bia_dt);
@@ -815,8 +832,25 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
+    // Only M is allowed to be a runtime value, the strides must not depend
+    // on it and the blocking is selected for a hint value of M.
+    bgmmc.is_runtime_M = is_runtime_value(helper.M());
+    if (bgmmc.is_runtime_M) {
+        const int m_dim = bgmmc.ndims - 2;
+        for (int d = 0; d < bgmmc.ndims; d++) {
+            if (d == m_dim) continue;
+            if (is_runtime_value(src_d.dims()[d])
+                    || is_runtime_value(dst_d.dims()[d]))
+                return status::unimplemented;
+        }
+        if (weights_d.has_runtime_dims_or_strides()
+                || src_d.has_runtime_strides() || dst_d.has_runtime_strides()
+                || bgmmc.with_binary)
+            return status::unimplemented;
+    }
+
     bgmmc.batch_ndims = bgmmc.ndims - 2;
-    bgmmc.M = helper.M();
+    bgmmc.M = bgmmc.is_runtime_M ? runtime_M_hint : helper.M();
     bgmmc.N = helper.N();
     bgmmc.K = helper.K();
     bgmmc.batch = helper.batch();
@@ -832,10 +866,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.required_k_granularity
             = bgmmc.is_amx ? data_type_vnni_granularity(bgmmc.wei_dt) : 1;
     if (bgmmc.required_k_granularity == 0) return status::unimplemented;
-    bgmmc.wei_k_blk = data_type_vnni_simd_elems<avx512_core>(bgmmc.wei_dt);
+    bgmmc.wei_k_blk = data_type_vnni_simd_elems<avx512_core>(
+            bgmmc.with_wei_decompression ? f32 : bgmmc.wei_dt);
 
     CHECK(bm_conf_utils.set_or_check_tags(src_md, dst_md, bias_md));
     CHECK(bm_conf_utils.set_or_check_B_tag(weights_md));
+    // The copy routine up-converts the weights for a plain layout only
+    if (bgmmc.with_wei_decompression
+            && !bm_conf_utils.check_is_plain(bgmmc.wei_tag))
+        return status::unimplemented;
     CHECK(attr.set_default_formats(&dst_md));
 
     bgmmc.wei_n_blk = get_default_n_block(bgmmc.wei_tag);
@@ -853,6 +892,14 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             || bgmmc.transposed_A || lda_is_big_2pow;
     bgmmc.use_buffer_a = is_copy_a_required;
 
+    // Copy routines for A and B are implemented for avx512 only. On avx2 and
+    // avx2_vnni the weights are expected in the blocked layout picked for
+    // format_kind::any (reordered ahead of time), and src must be usable in
+    // place, otherwise other implementations are used.
+    if (!is_superset(isa, avx512_core)
+            && (bgmmc.use_buffer_a || bgmmc.use_buffer_b))
+        return status::unimplemented;
+
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
     // show worse performance for it in comparison with copy whole A approach
@@ -875,6 +922,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - nthr_K
     CHECK(compute_blocking_heuristic(bgmmc, bm_conf_utils));
 
+    // Parallel reduction over K requires buffers sized by M
+    if (bgmmc.is_runtime_M && bgmmc.nthr_k > 1) return status::unimplemented;
+
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
                     bgmmc.N == bgmmc.N_blk, bgmmc.N >= bgmmc.wei_n_blk)) {
@@ -885,8 +935,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     CHECK(bm_conf_utils.set_B_flags(weights_md));
 
-    bgmmc.M_tail = bgmmc.M % bgmmc.M_blk;
+    // M tail of a runtime M is set on execute
+    bgmmc.M_tail = bgmmc.is_runtime_M ? 0 : bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.N % bgmmc.N_blk;
+    // Packed 4-bit weights are copied by pairs of columns
+    if (one_of(bgmmc.wei_dt, s4, u4)
+            && (bgmmc.N % 2 != 0 || bgmmc.N_blk % 2 != 0))
+        return status::unimplemented;
     bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
             ? rnd_up(bgmmc.K % bgmmc.K_blk, bgmmc.required_k_granularity)
             : 0;
@@ -933,8 +988,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.buffer_a_per_thread_sz
             = bgmmc.buffer_a_chunk_shift_along_m * bgmmc.M_chunk_size;
 
-    bgmmc.buffer_b_chunk_sz
-            = bgmmc.b_dt_sz * bgmmc.LDB * rnd_up(bgmmc.K_blk, bgmmc.wei_k_blk);
+    bgmmc.buffer_b_chunk_sz = bgmmc.tr_b_dt_sz * bgmmc.LDB
+            * rnd_up(bgmmc.K_blk, bgmmc.wei_k_blk);
     bgmmc.buffer_b_per_thread_sz
             = bgmmc.buffer_b_chunk_sz * bgmmc.brgemm_batch_size;
 
@@ -1007,6 +1062,14 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.brgemm_batch_element_per_thr_sz = 16 * bgmmc.brgemm_batch_size;
 }
 
+void update_runtime_M_values(brgemm_matmul_conf_t &bgmmc, dim_t M) {
+    assert(bgmmc.is_runtime_M);
+    bgmmc.M = M;
+    bgmmc.M_tail = M % bgmmc.M_blk;
+    bgmmc.M_chunks = div_up(M, bgmmc.M_chunk_elems);
+    bgmmc.num_M_blocks = div_up(M, bgmmc.M_blk);
+}
+
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc) {
     const size_t default_data_align = sizeof(char);
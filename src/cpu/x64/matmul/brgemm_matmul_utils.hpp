@@ -104,6 +104,13 @@ struct brgemm_matmul_conf_t {
     bool use_buffer_a_tail_only;
     bool use_buffer_b;
     bool use_buffer_c;
+    // The weights are stored in a lower precision data type and up-converted
+    // to f32 by the copy routine for B, the computations are done in f32
+    bool with_wei_decompression;
+    // The number of elements along K that share a decompression scale and a
+    // zero point, 0 if the decompressed weights are not scaled
+    dim_t wei_decomp_group_size;
+    bool with_wei_decomp_zero_points;
 
     brgemm_matmul_bcast_desc_t bcast_A_desc;
     brgemm_matmul_bcast_desc_t bcast_B_desc;
@@ -118,6 +125,8 @@ struct brgemm_matmul_conf_t {
 
     // Auxiliary values for init_config() and execute()
     dim_t a_dt_sz, b_dt_sz, c_dt_sz, acc_dt_sz, bias_dt_sz;
+    // Size of an element of B in the copy buffer
+    dim_t tr_b_dt_sz;
 
     int M_chunks;
     int N_chunks;
@@ -168,6 +177,10 @@ struct brgemm_matmul_conf_t {
     bool is_amx;
 
     int required_k_granularity;
+
+    // M is only known at execution time; blocking is chosen for
+    // `runtime_M_hint` and the M-dependent values are updated on execute
+    bool is_runtime_M;
 };
 
 struct brgemm_matmul_conf_utils_t {
@@ -194,9 +207,11 @@ struct brgemm_matmul_conf_utils_t {
         // between plain and copy-to-blocked routine.
         size_t big_LDB = bgmmc.N > 256;
         bool is_pow2 = math::is_pow2(bgmmc.N);
-        bool use_copy_buffer = IMPLICATION(
-                this->is_f32(), use_heuristic && (big_LDB && is_pow2));
-        return (use_copy_buffer && this->check_is_plain(bgmmc.wei_tag))
+        bool use_copy_buffer = IMPLICATION(this->is_f32(),
+                use_heuristic && (big_LDB && is_pow2)
+                        && is_superset(bgmmc.isa, avx512_core));
+        return bgmmc.with_wei_decompression
+                || (use_copy_buffer && this->check_is_plain(bgmmc.wei_tag))
                 || this->check_is_transposed(bgmmc.wei_tag)
                 || (bgmmc.wei_tag == format_tag::acbd)
                 || (bgmmc.wei_tag == format_tag::adbc);
@@ -267,6 +282,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc);
 
+// Value of M used to select blocking parameters when M is a runtime value.
+constexpr dim_t runtime_M_hint = 512;
+
+void update_runtime_M_values(brgemm_matmul_conf_t &bgmmc, dim_t M);
+
 } // namespace matmul
 } // namespace x64
 } // namespace cpu
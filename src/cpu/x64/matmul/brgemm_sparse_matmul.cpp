@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_sparse_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const bool ok = mayiuse(isa) && !batched()
+            && everyone_is(f32, src_md_.data_type, weights_md_.data_type,
+                    dst_md_.data_type)
+            && IMPLICATION(with_bias(), bias_md_.data_type == f32)
+            && attr()->has_default_values(skip_mask_t::post_ops)
+            && !has_runtime_dims_or_strides()
+            && set_default_formats() == status::success
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // Block rows of the weights go along N
+    CHECK(brgemm_sparse_utils::init_conf(conf_, src_md_, weights_md_,
+            bias_md_, dst_md_, *attr(), 1));
+    CHECK(brgemm_sparse_utils::init_brgemm_descs(
+            isa, conf_, attr(), &dst_md_, brg_descs_));
+
+    auto scratchpad = scratchpad_registry().registrar();
+    brgemm_sparse_utils::init_scratchpad(scratchpad, conf_);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::pd_t::set_default_formats() {
+    using namespace format_tag;
+    for (auto md : {&src_md_, &bias_md_, &dst_md_})
+        if (md->format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(*md, ab));
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sparse_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    brgemm_sparse_utils::execute(pd()->conf_, brg_kernels_,
+            src + src_d.offset0() * sizeof(float), weights, bias,
+            dst + dst_d.offset0() * sizeof(float),
+            ctx.get_scratchpad_grantor());
+    return status::success;
+}
+
+template struct brgemm_sparse_matmul_t<avx2>;
+template struct brgemm_sparse_matmul_t<avx512_core>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_SPARSE_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_sparse_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with block-sparse weights, only the non-zero blocks of the weights
+// are read and multiplied
+template <cpu_isa_t isa>
+struct brgemm_sparse_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_sparse:", isa, ""),
+                brgemm_sparse_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        bool supports_sparse_weights() const override { return true; }
+
+        brgemm_sparse_conf_t conf_;
+        brgemm_t brg_descs_[brgemm_sparse_utils::max_num_brg_kernels];
+
+    private:
+        status_t set_default_formats();
+    };
+
+    brgemm_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        return brgemm_sparse_utils::create_brgemm_kernels(
+                pd()->conf_, pd()->brg_descs_, brg_kernels_);
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t>
+            brg_kernels_[brgemm_sparse_utils::max_num_brg_kernels];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -881,6 +881,238 @@ void brgemm_gru_t<src_t, weights_t, scratch_t, gemm_acc_t>::kernel(
     }
 }
 
+template <typename src_t, typename weights_t, typename scratch_t,
+        typename gemm_acc_t>
+brgemm_gru_lbr_t<src_t, weights_t, scratch_t, gemm_acc_t>::brgemm_gru_lbr_t(
+        const ref_rnn_brgemm_t &rnn_brgemm, const rnn_utils::rnn_conf_t &rnn,
+        rnn_utils::cell_position_t cell_position, const src_t *src_iter,
+        const src_t *src_layer, weights_t *w_iter, weights_t *w_layer,
+        scratch_t *scratch_gates, scratch_t *scratch_cell,
+        gemm_acc_t *amx_scratchpad,
+        x64::brgemm_batch_element_t *addr_batch_global,
+        const postgemm_fused_t &fused_postgemm)
+    : rnn_brgemm_(rnn_brgemm)
+    , rnn_(rnn)
+    , need_gemm_layer_(rnn_.need_gemm_layer(cell_position))
+    , layer_desc_idx_(rnn_.layer_brgemm_desc(cell_position))
+    , iter_desc_idx_(rnn_.iter_brgemm_desc(cell_position))
+    , Al_(src_layer)
+    , Ai_(src_iter)
+    , Bl_(w_layer)
+    , Bi_(w_iter)
+    , C_gates_(scratch_gates)
+    , C_cell_(scratch_cell)
+    , LDAl_(rnn_.src_layer_ld(cell_position))
+    , LDAi_(rnn_.src_iter_ld(cell_position))
+    , max_nthr_(rnn_.nthr)
+    , n_blocking_(rnn_.N_blocks)
+    , m_blocking_(rnn_.M_blocks)
+    , work_amount_(n_blocking_ * m_blocking_)
+    , Bl_n_offset_(rnn_.K1padded * rnn_.n_block)
+    , Bi_n_offset_(rnn_.K2padded * rnn_.n_block)
+    , Bl_g_offset_(rnn_.N_blocks * Bl_n_offset_)
+    , Bi_g_offset_(rnn_.N_blocks * Bi_n_offset_)
+    , Al_k_tail_offset_(rnn_.KB1_blocks * rnn_.k1_block)
+    , Ai_k_tail_offset_(rnn_.KB2_blocks * rnn_.k2_block)
+    , Bl_kb_offset_(rnn_.k1_block * rnn_.n_block)
+    , Bi_kb_offset_(rnn_.k2_block * rnn_.n_block)
+    , Bl_k_tail_offset_(rnn_.KB1_blocks * rnn_.k1_block * rnn_.n_block)
+    , Bi_k_tail_offset_(rnn_.KB2_blocks * rnn_.k2_block * rnn_.n_block)
+    , n_gates_(rnn.n_gates)
+    , brgemm_kernel_iter_main_(
+              rnn_brgemm_.kernel_iter_b0_[iter_desc_idx_].get())
+    , brgemm_kernel_iter_n_tail_(
+              rnn_brgemm_.kernel_iter_N_tail_b0_[iter_desc_idx_].get())
+    , brgemm_kernel_iter_k_tail_(
+              rnn_brgemm_.kernel_iter_K2_tail_b1_[iter_desc_idx_].get())
+    , brgemm_kernel_iter_nk_tail_(
+              rnn_brgemm_.kernel_iter_NK2_tail_b1_[iter_desc_idx_].get())
+    , brgemm_kernel_layer_main_(
+              rnn_brgemm_.kernel_layer_b0_[layer_desc_idx_].get())
+    , brgemm_kernel_layer_n_tail_(
+              rnn_brgemm_.kernel_layer_N_tail_b0_[layer_desc_idx_].get())
+    , brgemm_kernel_layer_k_tail_(
+              rnn_brgemm_.kernel_layer_K1_tail_b1_[layer_desc_idx_].get())
+    , brgemm_kernel_layer_nk_tail_(
+              rnn_brgemm_.kernel_layer_NK1_tail_b1_[layer_desc_idx_].get())
+    , pallete_buff_iter_main_(rnn.k1_block == rnn.k2_block
+                      ? rnn_brgemm_.pallete_buff_layer_
+                      : rnn_brgemm_.pallete_buff_iter_)
+    , pallete_buff_iter_n_tail_(rnn.k1_block == rnn.k2_block
+                      ? rnn_brgemm_.pallete_buff_layer_n_tail_
+                      : rnn_brgemm_.pallete_buff_iter_n_tail_)
+    , pallete_buff_iter_k_tail_(rnn.k1_tail == rnn.k2_tail
+                      ? rnn_brgemm_.pallete_buff_k1_tail_
+                      : rnn_brgemm_.pallete_buff_k2_tail_)
+    , pallete_buff_iter_nk_tail_(rnn.k1_tail == rnn.k2_tail
+                      ? rnn_brgemm_.pallete_buff_nk1_tail_
+                      : rnn_brgemm_.pallete_buff_nk2_tail_)
+    , pallete_buff_layer_main_(rnn_brgemm_.pallete_buff_layer_)
+    , pallete_buff_layer_n_tail_(rnn_brgemm_.pallete_buff_layer_n_tail_)
+    , pallete_buff_layer_k_tail_(rnn_brgemm_.pallete_buff_k1_tail_)
+    , pallete_buff_layer_nk_tail_(rnn_brgemm_.pallete_buff_nk1_tail_)
+    , amx_scratchpad_(amx_scratchpad)
+    , addr_batch_global_(addr_batch_global)
+    , fused_postgemm_(fused_postgemm) {}
+
+template <typename src_t, typename weights_t, typename scratch_t,
+        typename gemm_acc_t>
+void brgemm_gru_lbr_t<src_t, weights_t, scratch_t, gemm_acc_t>::execute()
+        const {
+    parallel(max_nthr_, [this](const int ithr, const int nthr) {
+        this->kernel(ithr, nthr);
+    });
+}
+
+template <typename src_t, typename weights_t, typename scratch_t,
+        typename gemm_acc_t>
+void brgemm_gru_lbr_t<src_t, weights_t, scratch_t, gemm_acc_t>::kernel(
+        const int ithr, const int nthr) const {
+    using namespace cpu::rnn_utils;
+
+    int start = 0, end = 0;
+    balance211(work_amount_, nthr, ithr, start, end);
+
+    const bool is_amx = rnn_.is_int8_amx() || rnn_.is_bf16_amx();
+    gemm_acc_t *const amx_buffer = is_amx
+            ? amx_scratchpad_ + rnn_.m_block * rnn_.n_block * ithr
+            : nullptr;
+    const int max_K_Block = nstl::max(rnn_.KB1_blocks + 1,
+            nstl::max(rnn_.KBproj_blocks + 1, rnn_.KB2_blocks + 1));
+    brgemm_batch_element_t *const addr_batch
+            = addr_batch_global_ + ithr * max_K_Block;
+
+    const char *pallete_buff_iter = nullptr;
+    const char *pallete_buff_layer = nullptr;
+    const char *pallete_buff_iter_k_tail = nullptr;
+    const char *pallete_buff_layer_k_tail = nullptr;
+
+    dim_t nb = 0, mb = 0;
+    switch (rnn_.loop_order) {
+        case brgemm_rnn_execute_loop_order_t::mblk_nblk:
+            nd_iterator_init(start, mb, m_blocking_, nb, n_blocking_);
+            break;
+        case brgemm_rnn_execute_loop_order_t::nblk_mblk:
+            nd_iterator_init(start, nb, n_blocking_, mb, m_blocking_);
+            break;
+        default: assert(!"unsupported loop order");
+    }
+
+    amx_tile_configuration_loader_t load_cfg_if_needed;
+
+    while (start < end) {
+        const auto m = mb * rnn_.m_block;
+        const auto n = nb * rnn_.n_block;
+
+        const auto *const Al_m = Al_ + m * LDAl_;
+        const auto *const Ai_m = Ai_ + m * LDAi_;
+        const auto *const Bl_n = Bl_ + nb * Bl_n_offset_;
+        const auto *const Bi_n = Bi_ + nb * Bi_n_offset_;
+        auto *const C_gates_n = C_gates_ + m * rnn_.LDC + n;
+        auto *const C_cell_n = C_cell_ + m * rnn_.LDC + n;
+
+        const brgemm_kernel_t *brgemm_kernel_layer = brgemm_kernel_layer_main_;
+        const brgemm_kernel_t *brgemm_kernel_iter = brgemm_kernel_iter_main_;
+        const brgemm_kernel_t *brgemm_kernel_layer_k_tail
+                = brgemm_kernel_layer_k_tail_;
+        const brgemm_kernel_t *brgemm_kernel_iter_k_tail
+                = brgemm_kernel_iter_k_tail_;
+
+        if (is_amx) {
+            pallete_buff_iter = pallete_buff_iter_main_;
+            pallete_buff_layer = pallete_buff_layer_main_;
+            pallete_buff_iter_k_tail = pallete_buff_iter_k_tail_;
+            pallete_buff_layer_k_tail = pallete_buff_layer_k_tail_;
+        }
+
+        const bool do_n_tail = (n + rnn_.n_block) > rnn_.N;
+        if (do_n_tail) {
+            brgemm_kernel_layer = brgemm_kernel_layer_n_tail_;
+            brgemm_kernel_iter = brgemm_kernel_iter_n_tail_;
+            brgemm_kernel_layer_k_tail = brgemm_kernel_layer_nk_tail_;
+            brgemm_kernel_iter_k_tail = brgemm_kernel_iter_nk_tail_;
+
+            if (is_amx) {
+                pallete_buff_iter = pallete_buff_iter_n_tail_;
+                pallete_buff_layer = pallete_buff_layer_n_tail_;
+                pallete_buff_iter_k_tail = pallete_buff_iter_nk_tail_;
+                pallete_buff_layer_k_tail = pallete_buff_layer_nk_tail_;
+            }
+        }
+
+        if (need_gemm_layer_) {
+            if (is_amx) load_cfg_if_needed(pallete_buff_layer);
+            for (int g = 0; g < n_gates_; g++) {
+                const auto *const Bl_g = Bl_n + g * Bl_g_offset_;
+                auto *const C_gates_g = C_gates_n + g * rnn_.N;
+
+                for (int i = 0; i < rnn_.KB1_blocks; i++) {
+                    addr_batch[i].ptr.A = Al_m + i * rnn_.k1_block;
+                    addr_batch[i].ptr.B = Bl_g + i * Bl_kb_offset_;
+                }
+                brgemm_kernel_execute(brgemm_kernel_layer, rnn_.KB1_blocks,
+                        addr_batch, reinterpret_cast<void *>(C_gates_g),
+                        amx_buffer);
+            }
+        }
+
+        if (need_gemm_layer_ && rnn_.k1_tail) {
+            if (is_amx) load_cfg_if_needed(pallete_buff_layer_k_tail);
+            for (int g = 0; g < n_gates_; g++) {
+                const auto *const Bl_g = Bl_n + g * Bl_g_offset_;
+                auto *const C_gates_g = C_gates_n + g * rnn_.N;
+
+                addr_batch[0].ptr.A = Al_m + Al_k_tail_offset_;
+                addr_batch[0].ptr.B = Bl_g + Bl_k_tail_offset_;
+                brgemm_kernel_execute(brgemm_kernel_layer_k_tail, 1, addr_batch,
+                        reinterpret_cast<void *>(C_gates_g), amx_buffer);
+            }
+        }
+
+        if (is_amx) load_cfg_if_needed(pallete_buff_iter);
+        for (int g = 0; g < n_gates_; g++) {
+            const auto *const Bi_g = Bi_n + g * Bi_g_offset_;
+            auto *const C_cell_g = C_cell_n + g * rnn_.N;
+
+            for (int i = 0; i < rnn_.KB2_blocks; i++) {
+                addr_batch[i].ptr.A = Ai_m + i * rnn_.k2_block;
+                addr_batch[i].ptr.B = Bi_g + i * Bi_kb_offset_;
+            }
+            brgemm_kernel_execute(brgemm_kernel_iter, rnn_.KB2_blocks,
+                    addr_batch, reinterpret_cast<void *>(C_cell_g),
+                    amx_buffer);
+        }
+
+        if (rnn_.k2_tail) {
+            if (is_amx) load_cfg_if_needed(pallete_buff_iter_k_tail);
+            for (int g = 0; g < n_gates_; g++) {
+                const auto *const Bi_g = Bi_n + g * Bi_g_offset_;
+                auto *const C_cell_g = C_cell_n + g * rnn_.N;
+
+                addr_batch[0].ptr.A = Ai_m + Ai_k_tail_offset_;
+                addr_batch[0].ptr.B = Bi_g + Bi_k_tail_offset_;
+                brgemm_kernel_execute(brgemm_kernel_iter_k_tail, 1, addr_batch,
+                        reinterpret_cast<void *>(C_cell_g), amx_buffer);
+            }
+        }
+
+        const auto block_step
+                = (do_n_tail ? rnn_.n_tail : rnn_.n_block) * sizeof(scratch_t);
+        fused_postgemm_(m, n, Ai_m + n, C_gates_n, C_cell_n, block_step);
+
+        ++start;
+        switch (rnn_.loop_order) {
+            case brgemm_rnn_execute_loop_order_t::mblk_nblk:
+                nd_iterator_step(mb, m_blocking_, nb, n_blocking_);
+                break;
+            case brgemm_rnn_execute_loop_order_t::nblk_mblk:
+                nd_iterator_step(nb, n_blocking_, mb, m_blocking_);
+                break;
+            default: assert(!"unsupported loop order");
+        }
+    }
+}
+
 template class brgemm_dst_layer_iter_t<uint8_t, int8_t, int32_t, int32_t>;
 template class brgemm_dst_layer_iter_t<int8_t, int8_t, int32_t, int32_t>;
 template class brgemm_dst_layer_iter_t<float, float, float, float>;
@@ -896,6 +1128,11 @@ template class brgemm_gru_t<int8_t, int8_t, int32_t, int32_t>;
 template class brgemm_gru_t<float, float, float, float>;
 template class brgemm_gru_t<bfloat16_t, bfloat16_t, float, float>;
 
+template class brgemm_gru_lbr_t<uint8_t, int8_t, int32_t, int32_t>;
+template class brgemm_gru_lbr_t<int8_t, int8_t, int32_t, int32_t>;
+template class brgemm_gru_lbr_t<float, float, float, float>;
+template class brgemm_gru_lbr_t<bfloat16_t, bfloat16_t, float, float>;
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
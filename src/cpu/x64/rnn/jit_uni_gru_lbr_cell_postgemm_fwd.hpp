@@ -250,7 +250,16 @@ protected:
         // initialize registers with addresses and constants
         mov(table_reg, table_label);
         init_regs(vlen, loop_tail_bytes / scratch_dt_size);
-        mov(loop_cnt, loop_len_bytes);
+        const bool is_brgemm = rnn_.is_brgemm && !rnn_.unfused_post_gemm;
+        if (is_brgemm) {
+            // the block size in bytes is passed as param #10
+#ifdef _WIN32
+            mov(loop_cnt, ptr[base_args + 40]);
+#else
+            mov(loop_cnt, ptr[base_args + 24]);
+#endif
+        } else
+            mov(loop_cnt, loop_len_bytes);
         if (loop_tail_bytes > 0) {
             cmp(loop_cnt, vlen);
             jl(tail_processing_or_exit_label, T_NEAR);
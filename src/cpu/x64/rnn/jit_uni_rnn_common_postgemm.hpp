@@ -171,8 +171,11 @@ struct jit_uni_rnn_postgemm : public jit_generator {
         const auto src_iter_c = rnn_utils::make_raw_aoc(src_iter_c_,
                 types::data_type_size(rnn.src_iter_c_dt),
                 rnn.ws_states_iter_c_nld, src_iter_c_ld);
-        const rnn_utils::ws_gates_aoc<scratch_t> scratch_cell(
-                rnn, scratch_cell_);
+        // brgemm-based cell computes scratch_cell with the scratch_gates
+        // leading dimension
+        const utils::array_offset_calculator<scratch_t, 2> scratch_cell(
+                scratch_cell_, rnn.scratch_gates_nld,
+                rnn.is_brgemm ? rnn.scratch_gates_ld : rnn.ws_gates_ld);
         const utils::array_offset_calculator<gates_t, 2> ws_Wh_b(
                 ws_grid_, rnn.mb, rnn.dhc);
 
@@ -199,7 +202,7 @@ struct jit_uni_rnn_postgemm : public jit_generator {
                 break;
             case alg_kind::lbr_gru:
                 param6_ = SAFE_PTR(src_iter, m, 0);
-                param7_ = SAFE_PTR(scratch_cell, m, 0, 0);
+                param7_ = SAFE_PTR(scratch_cell, m, 0);
                 param8_ = ws_grid_ ? &ws_Wh_b(m, 0) : nullptr;
                 break;
             case alg_kind::vanilla_gru:
@@ -209,7 +212,7 @@ struct jit_uni_rnn_postgemm : public jit_generator {
                 break;
             case alg_kind::lbr_augru:
                 param6_ = SAFE_PTR(src_iter, m, 0);
-                param7_ = SAFE_PTR(scratch_cell, m, 0, 0);
+                param7_ = SAFE_PTR(scratch_cell, m, 0);
                 param8_ = ws_grid_ ? &ws_Wh_b(m, 0) : nullptr;
                 param11_ = SAFE_PTR(augru_attention, m);
                 break;
@@ -75,6 +75,7 @@ jit_io_helper_t<Vmm>::jit_io_helper_t(jit_generator *host, const cpu_isa_t &isa,
     , isa_(isa)
     , data_type_(data_type)
     , bf16_supported_(utils::one_of(isa, avx512_core, avx512_core_bf16))
+    , f16_supported_(is_superset(isa, avx512_core))
     , bf16_emu_(nullptr)
     , io_conf_(io_conf)
     , tail_conf_(tail_conf)
@@ -91,9 +92,10 @@ jit_io_helper_t<Vmm>::jit_io_helper_t(jit_generator *host, const cpu_isa_t &isa,
                 bf16_conf->bf16_emu_reserv_4_);
     }
 
-    assert(utils::one_of(data_type_, data_type::bf16, data_type::f32,
-                   data_type::s8, data_type::u8, data_type::s32)
-            && "Supported data types bf16, f32, s8, u8, s32");
+    assert(utils::one_of(data_type_, data_type::bf16, data_type::f16,
+                   data_type::f32, data_type::s8, data_type::u8,
+                   data_type::s32)
+            && "Supported data types bf16, f16, f32, s8, u8, s32");
 
     /*
      * vpmovsxbd, vpmovzxbd for AVX are defined only for XMM. Since AVX2
@@ -363,8 +365,8 @@ template <typename Vmm>
 void jit_io_helper_t<Vmm>::prepare_full_mask() {
     assert(gather_conf_.has_value() && "Config for loading with the use of gather instruction is not set.");
 
-    if (data_type_ == data_type::bf16 || data_type_ == data_type::s8
-            || data_type_ == data_type::u8)
+    if (utils::one_of(data_type_, data_type::bf16, data_type::f16,
+                data_type::s8, data_type::u8))
         return;
 
     if (is_superset(isa_, avx512_core))
@@ -466,6 +468,7 @@ void jit_io_helper_t<Vmm>::load(const Xbyak::Address &src_addr,
             case data_type::f32: load_f32(src_addr, dst_vmm, tail); break;
             case data_type::s32: load_s32(src_addr, dst_vmm, tail); break;
             case data_type::bf16: load_bf16(src_addr, dst_vmm); break;
+            case data_type::f16: load_f16(src_addr, dst_vmm); break;
             case data_type::s8:
             case data_type::u8: load_i8(src_addr, dst_vmm); break;
             default: assert(!"Unsupported data type.");
@@ -523,6 +526,14 @@ void jit_io_helper_t<Vmm>::load_bf16(
     convert_to_f32(dst_vmm, dst_vmm, data_type::bf16);
 }
 
+template <typename Vmm>
+void jit_io_helper_t<Vmm>::load_f16(
+        const Xbyak::Address &src_addr, const Vmm &dst_vmm) {
+    assert(f16_supported_ && "Unsupported data type.");
+
+    host_->vcvtph2ps(dst_vmm, src_addr);
+}
+
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::load_i8(
         const Xbyak::Address &src_addr, const Vmm &dst_vmm) {
@@ -567,6 +578,7 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
             case data_type::f32:
             case data_type::s32: store_f32(src_vmm, dst_addr, tail); break;
             case data_type::bf16: store_bf16(src_vmm, dst_addr); break;
+            case data_type::f16: store_f16(src_vmm, dst_addr); break;
             case data_type::s8:
             case data_type::u8: store_i8(src_vmm, dst_raw_addr); break;
             default: assert(!"Unsupported data type.");
@@ -641,6 +653,27 @@ void jit_io_helper_t<Vmm>::store_bf16(
         host_->vmovdqu16(dst_addr, src);
 }
 
+template <typename Vmm>
+void jit_io_helper_t<Vmm>::store_f16(
+        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+    assert(f16_supported_ && "Unsupported data type.");
+    assert((src_vmm.isZMM() || src_vmm.isYMM())
+            && "Store operation for f16 is not supported for Xmms.");
+
+    static constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+
+    const Vmm src_raw_vmm(src_vmm.getIdx());
+    const Xbyak::Ymm src_ymm(src_vmm.getIdx());
+    const Xbyak::Xmm src_xmm(src_vmm.getIdx());
+    const Xbyak::Xmm &src = is_zmm ? src_ymm : src_xmm;
+    host_->vcvtps2ph(src, src_raw_vmm, jit_generator::_op_mxcsr);
+
+    if (io_conf_.nt_stores_enabled_)
+        host_->uni_vmovntps(dst_addr, src);
+    else
+        host_->vmovdqu16(dst_addr, src);
+}
+
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_i8(
         const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
@@ -707,6 +740,15 @@ void jit_io_helper_t<Vmm>::broadcast(
             host_->vpbroadcastw(dst_vmm, src_addr);
             convert_to_f32(dst_vmm, dst_vmm, data_type_);
             break;
+        case data_type::f16: {
+            assert(f16_supported_ && "Unsupported data type.");
+            static constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+            const Xbyak::Ymm dst_ymm(dst_vmm.getIdx());
+            const Xbyak::Xmm dst_xmm(dst_vmm.getIdx());
+            host_->vpbroadcastw(dst_vmm, src_addr);
+            host_->vcvtph2ps(dst_vmm, is_zmm ? dst_ymm : dst_xmm);
+            break;
+        }
         case data_type::s32: {
             if (is_superset(isa_, avx512_core)) {
                 host_->uni_vcvtdq2ps(
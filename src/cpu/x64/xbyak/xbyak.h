@@ -1192,6 +1192,22 @@ public:
 	}
 	bool isAutoGrow() const { return type_ == AUTO_GROW; }
 	bool isCalledCalcJmpAddress() const { return isCalledCalcJmpAddress_; }
+	/*
+		oneDNN: get the code locations which hold addresses relative to top in AutoGrow mode
+		@param f [in] callback f(codeOffset, offsetFromTop, size) called for each location
+		@return false if the code holds addresses that can not be moved with the code
+	*/
+	template<class F>
+	bool forEachTopRelativeAddr(F f) const
+	{
+		for (AddrInfoList::const_iterator i = addrInfoList_.begin(), ie = addrInfoList_.end(); i != ie; ++i) {
+			if (i->mode == inner::Labs) return false;
+		}
+		for (AddrInfoList::const_iterator i = addrInfoList_.begin(), ie = addrInfoList_.end(); i != ie; ++i) {
+			if (i->mode == inner::LaddTop) f(i->codeOffset, i->jmpAddr, i->jmpSize);
+		}
+		return true;
+	}
 	/**
 		change exec permission of memory
 		@param addr [in] buffer address
@@ -46,6 +46,8 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            // Scaled dot-product attention is not implemented on GPU
+            case primitive_kind::sdpa: return empty_list;
             CASE(shuffle);
             case primitive_kind::softmax:
             CASE(softmax_v2);
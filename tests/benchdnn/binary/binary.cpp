@@ -115,7 +115,7 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     std::vector<dnnl_data_type_t> dts = {prb->sdt[0], prb->sdt[1], prb->ddt};
-    skip_unimplemented_data_type(dts, prb->dir, res);
+    skip_unimplemented_data_type(dts, prb->dir, res, dnnl_binary);
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
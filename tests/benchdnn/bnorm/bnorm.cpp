@@ -295,7 +295,8 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+    skip_unimplemented_data_type(
+            {prb->dt}, prb->dir, res, dnnl_batch_normalization);
     skip_unimplemented_sum_po(prb->attr, res);
 
     // Non-zero alpha is not supported on GPU and for training in general.
@@ -93,7 +93,8 @@ int fill_src(int input_idx, dnnl_data_type_t dt, dnn_mem_t &mem_dt,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->sdt, prb->ddt}, prb->dir, res);
+    skip_unimplemented_data_type(
+            {prb->sdt, prb->ddt}, prb->dir, res, dnnl_concat);
     skip_unimplemented_sum_po(prb->attr, res);
 
     // ref concat is reorder-based, hence, inherits some reorder limitations.
@@ -104,8 +105,17 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     bool valid_bf16_output
             = IMPLICATION(prb->ddt == dnnl_bf16 && prb->dtag != tag::undef,
                     (prb->sdt == dnnl_f32 || prb->sdt == dnnl_bf16));
-
-    if (is_cpu() && (!valid_bf16_input || !valid_bf16_output)) {
+    // f16 reorder on cpu supports only f16/f32 src_dt/dst_dt
+    bool valid_f16_input = IMPLICATION(prb->sdt == dnnl_f16,
+            prb->dtag == tag::undef || prb->ddt == dnnl_f32
+                    || prb->ddt == dnnl_f16);
+    bool valid_f16_output
+            = IMPLICATION(prb->ddt == dnnl_f16 && prb->dtag != tag::undef,
+                    (prb->sdt == dnnl_f32 || prb->sdt == dnnl_f16));
+
+    if (is_cpu()
+            && (!valid_bf16_input || !valid_bf16_output || !valid_f16_input
+                    || !valid_f16_output)) {
         res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
         return;
     }
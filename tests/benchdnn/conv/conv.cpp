@@ -432,7 +432,7 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
 
     skip_unimplemented_data_type(
             {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt}, prb->dir,
-            res);
+            res, dnnl_convolution);
     skip_unimplemented_sum_po(prb->attr, res, prb->cfg[DST].dt);
 
     if (is_cpu()) {
@@ -445,8 +445,11 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
                 = prb->cfg[DST].dt == dnnl_s8 || prb->cfg[DST].dt == dnnl_u8;
         const bool is_f32f32x8 = is_f32_src && is_f32_wei && is_int8_dst;
         const bool is_bf16bf16x8 = is_bf16_src && is_bf16_wei && is_int8_dst;
+        // f16 is supported with floating-point sources only.
+        const bool is_x8x8f16 = prb->cfg[WEI].dt == dnnl_s8
+                && prb->cfg[DST].dt == dnnl_f16;
 
-        if (is_f32f32x8 || is_bf16bf16x8) {
+        if (is_f32f32x8 || is_bf16bf16x8 || is_x8x8f16) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
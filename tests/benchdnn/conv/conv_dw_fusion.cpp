@@ -168,7 +168,7 @@ std::unique_ptr<prb_t> get_fused_conv_prb(const prb_t *prb) {
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type(
             {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt}, prb->dir,
-            res);
+            res, dnnl_convolution);
     skip_unimplemented_sum_po(prb->attr, res);
 
     // GPU does not support depthwise fusion
@@ -142,7 +142,7 @@ int init_prim_ref(
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type(
             {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt}, prb->dir,
-            res);
+            res, dnnl_deconvolution);
     skip_unimplemented_sum_po(prb->attr, res);
 
     // GPU supports only post ops and all but x8s8bf16 cfg
@@ -542,7 +542,8 @@ bool attr_t::is_def() const {
     return oscale.is_def() && scales.is_def() && zero_points.is_def()
             && post_ops.is_def()
             && scratchpad_mode == dnnl_scratchpad_mode_library
-            && fpmath_mode == dnnl_fpmath_mode_strict;
+            && fpmath_mode == dnnl_fpmath_mode_strict
+            && accuracy_mode == dnnl_accuracy_mode_strict;
 }
 
 int attr_t::post_ops_t::find(pk_t kind, int start, int stop) const {
@@ -760,6 +761,11 @@ std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm) {
     return s;
 }
 
+std::ostream &operator<<(std::ostream &s, dnnl_accuracy_mode_t am) {
+    s << (am == dnnl_accuracy_mode_fast ? "fast" : "strict");
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
     if (!attr.is_def()) {
         if (!attr.oscale.is_def()) s << "--attr-oscale=" << attr.oscale << " ";
@@ -772,6 +778,8 @@ std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
             s << "--attr-scratchpad=" << attr.scratchpad_mode << " ";
         if (attr.fpmath_mode != dnnl_fpmath_mode_strict)
             s << "--attr-fpmath=" << attr.fpmath_mode << " ";
+        if (attr.accuracy_mode != dnnl_accuracy_mode_strict)
+            s << "--attr-accuracy=" << attr.accuracy_mode << " ";
     }
     return s;
 }
@@ -852,6 +860,22 @@ dnnl_fpmath_mode_t str2fpmath_mode(const char *str) {
 #undef CASE
 }
 
+dnnl_accuracy_mode_t str2accuracy_mode(const char *str) {
+#define CASE(am) \
+    param = #am; \
+    if (!strncasecmp(param, str, strlen(param))) return dnnl_accuracy_mode_##am;
+
+    const char *param;
+
+    CASE(strict);
+    CASE(fast);
+
+    assert(!"not expected");
+    return dnnl_accuracy_mode_strict;
+
+#undef CASE
+}
+
 void attr_args_t::prepare_output_scales(
         const attr_t &attr, const void *vals, int64_t count, int mask) {
     insert(DNNL_ARG_ATTR_OUTPUT_SCALES, vals, count, mask, attr.oscale.runtime);
@@ -1032,6 +1056,9 @@ dnnl_primitive_attr_t create_dnnl_attr(
     DNN_SAFE_V(
             dnnl_primitive_attr_set_fpmath_mode(dnnl_attr, attr.fpmath_mode));
 
+    DNN_SAFE_V(dnnl_primitive_attr_set_accuracy_mode(
+            dnnl_attr, attr.accuracy_mode));
+
     return dnnl_attr;
 }
 
@@ -337,7 +337,8 @@ struct attr_t {
 
     attr_t()
         : scratchpad_mode(dnnl_scratchpad_mode_library)
-        , fpmath_mode(dnnl_fpmath_mode_strict) {}
+        , fpmath_mode(dnnl_fpmath_mode_strict)
+        , accuracy_mode(dnnl_accuracy_mode_strict) {}
 
     void insert(const scale_t &s) { this->oscale = s; }
     void insert(const arg_scales_t &as) { this->scales = as; }
@@ -345,6 +346,7 @@ struct attr_t {
     void insert(const post_ops_t &po) { this->post_ops = po; }
     void insert(dnnl_scratchpad_mode_t sm) { this->scratchpad_mode = sm; }
     void insert(dnnl_fpmath_mode_t fpm) { this->fpmath_mode = fpm; }
+    void insert(dnnl_accuracy_mode_t am) { this->accuracy_mode = am; }
 
     scale_t oscale;
     arg_scales_t scales;
@@ -352,6 +354,7 @@ struct attr_t {
     post_ops_t post_ops;
     dnnl_scratchpad_mode_t scratchpad_mode;
     dnnl_fpmath_mode_t fpmath_mode;
+    dnnl_accuracy_mode_t accuracy_mode;
 
     bool is_def() const;
 };
@@ -409,6 +412,7 @@ std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t::kind_t &k);
 std::ostream &operator<<(std::ostream &s, const attr_t::post_ops_t &post_ops);
 std::ostream &operator<<(std::ostream &s, dnnl_scratchpad_mode_t sm);
 std::ostream &operator<<(std::ostream &s, dnnl_fpmath_mode_t fm);
+std::ostream &operator<<(std::ostream &s, dnnl_accuracy_mode_t am);
 std::ostream &operator<<(std::ostream &s, const attr_t &attr);
 
 // A container for additional data and info, not available from user's input at
@@ -512,6 +516,7 @@ dnnl_primitive_attr_t create_dnnl_attr(
 dnnl_engine_kind_t str2engine_kind(const char *str);
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str);
 dnnl_fpmath_mode_t str2fpmath_mode(const char *str);
+dnnl_accuracy_mode_t str2accuracy_mode(const char *str);
 
 void maybe_oscale(
         const attr_t &attr, float &d, const float *scales, int64_t oc);
@@ -493,13 +493,24 @@ void skip_start(res_t *res) {
     }
 }
 
-void skip_unimplemented_data_type(
-        const std::vector<dnnl_data_type_t> &v_dt, dir_t dir, res_t *res) {
+void skip_unimplemented_data_type(const std::vector<dnnl_data_type_t> &v_dt,
+        dir_t dir, res_t *res, dnnl_primitive_kind_t prim_kind) {
     bool has_bf16_support = is_gpu();
+    bool has_f16_support = is_gpu();
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
     using namespace dnnl::impl::cpu::platform;
+    // These primitives have no f16 implementation on CPU
+    const bool has_cpu_f16_impl = !(prim_kind == dnnl_batch_normalization
+            || prim_kind == dnnl_deconvolution
+            || prim_kind == dnnl_inner_product
+            || prim_kind == dnnl_layer_normalization || prim_kind == dnnl_lrn
+            || prim_kind == dnnl_pooling_v2 || prim_kind == dnnl_reduction
+            || prim_kind == dnnl_rnn || prim_kind == dnnl_softmax_v2);
     has_bf16_support = has_bf16_support
             || (is_cpu() && has_data_type_support(dnnl_bf16));
+    has_f16_support = has_f16_support
+            || (is_cpu() && has_data_type_support(dnnl_f16)
+                    && has_cpu_f16_impl);
 #endif
 
     for (const auto &i_dt : v_dt) {
@@ -508,8 +519,9 @@ void skip_unimplemented_data_type(
             res->state = SKIPPED, res->reason = DATA_TYPE_NOT_SUPPORTED;
             break;
         }
-        // f16 is supported on GPU only
-        if (i_dt == dnnl_f16 && is_cpu()) {
+        // f16 is supported on GPU and on CPU with AVX512-CORE+ for some
+        // primitives
+        if (!has_f16_support && i_dt == dnnl_f16) {
             res->state = SKIPPED, res->reason = DATA_TYPE_NOT_SUPPORTED;
             break;
         }
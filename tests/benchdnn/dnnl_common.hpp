@@ -388,8 +388,9 @@ int check_pd_w_and_wo_attr(
         const_dnnl_primitive_desc_t pd, const attr_t &attr, res_t *res);
 
 void skip_start(res_t *res);
-void skip_unimplemented_data_type(
-        const std::vector<dnnl_data_type_t> &v_dt, dir_t dir, res_t *res);
+void skip_unimplemented_data_type(const std::vector<dnnl_data_type_t> &v_dt,
+        dir_t dir, res_t *res,
+        dnnl_primitive_kind_t prim_kind = dnnl_undefined_primitive);
 void skip_unimplemented_sum_po(const attr_t &attr, res_t *res,
         dnnl_data_type_t dst_dt = dnnl_data_type_undef);
 void skip_invalid_inplace(res_t *res, dnnl_data_type_t sdt,
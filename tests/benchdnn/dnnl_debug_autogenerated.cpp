@@ -41,6 +41,8 @@ dnnl_data_type_t str2dt(const char *str) {
     CASE(s8);
     CASE(u8);
     CASE(f64);
+    CASE(s4);
+    CASE(u4);
 #undef CASE
     if (!strcmp("undef", str) || !strcmp("dnnl_data_type_undef", str))
         return dnnl_data_type_undef;
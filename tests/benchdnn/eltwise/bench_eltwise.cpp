@@ -36,6 +36,7 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_mb : s.mb)
     for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
+    for_(const auto &i_accuracy_mode : s.accuracy_mode)
     for (auto i_inplace : s.inplace) {
         bool ok = i_alg > alg_t::ELTWISE_START && i_alg < alg_t::ELTWISE_END;
         if (!ok) SAFE_V(FAIL);
@@ -84,6 +85,7 @@ void check_correctness(const settings_t &s) {
         attr_t attr;
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
+        attr.insert(i_accuracy_mode);
 
         const prb_t prb(s.prb_dims, i_dir, i_dt, i_tag, i_alg, i_alpha, i_beta,
                 i_inplace, attr, i_mb);
@@ -131,6 +133,8 @@ int bench(int argc, char **argv) {
                 || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
+                || parse_attr_accuracy_mode(
+                        s.accuracy_mode, def.accuracy_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv(), argv[0])
                 || parse_reset(s, argv[0]) || parse_help(argv[0]);
@@ -172,6 +172,22 @@ float get_eltwise_threshold(dnnl_data_type_t dt, alg_t alg, bool is_fwd) {
     return trh;
 }
 
+bool alg_has_fast_approx(alg_t alg) {
+    switch (alg) {
+        case alg_t::EXP:
+        case alg_t::EXP_DST:
+        case alg_t::GELU_ERF:
+        case alg_t::GELU_TANH:
+        case alg_t::LOGISTIC:
+        case alg_t::LOGISTIC_DST:
+        case alg_t::MISH:
+        case alg_t::SWISH:
+        case alg_t::TANH:
+        case alg_t::TANH_DST: return true;
+        default: return false;
+    }
+}
+
 static float get_eltwise_zero_trust_percent(const prb_t *prb) {
     float ztp = 65.f; // default for eltwise due to filling.
     switch (prb->alg) {
@@ -273,7 +289,7 @@ int fill_data(const prb_t *prb, data_kind_t kind, dnn_mem_t &mem_dt,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+    skip_unimplemented_data_type({prb->dt}, prb->dir, res, dnnl_eltwise);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -315,14 +331,21 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
         const args_t &ref_args) {
     const float trh
             = get_eltwise_threshold(prb->dt, prb->alg, prb->dir & FLAG_FWD);
-    cmp.set_threshold(trh);
+    // Fast approximations are checked against their documented bound, while
+    // the catastrophic cancellation cases are still detected with the strict
+    // threshold
+    const bool is_fast_approx
+            = prb->attr.accuracy_mode == dnnl_accuracy_mode_fast
+            && (prb->dir & FLAG_FWD) && alg_has_fast_approx(prb->alg);
+    cmp.set_threshold(is_fast_approx ? MAX2(trh, fast_approx_threshold) : trh);
 
     cmp.set_zero_trust_percent(get_eltwise_zero_trust_percent(prb));
 
     // Since lambda is called when stack is unavailable, need to capture `prb`
     // by value to avoid using dangling references.
     const auto eltwise_add_check =
-            [&, prb](const compare::compare_t::driver_check_func_args_t &args) {
+            [&, prb, trh](
+                    const compare::compare_t::driver_check_func_args_t &args) {
                 // Some algorithms require absolute value comparison for inputs
                 // where catastrophic cancellation may happen.
                 const auto &src = ref_args.find(DNNL_ARG_SRC);
@@ -330,8 +353,7 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
                 const auto &source
                         = ((prb->dir & FLAG_BWD) && prb->use_dst()) ? dst : src;
                 const float s = source.get_elem(args.idx);
-                if (check_abs_err(prb, s, args.trh))
-                    return args.diff <= args.trh;
+                if (check_abs_err(prb, s, trh)) return args.diff <= args.trh;
                 if (prb->attr.post_ops.binary_index() != -1)
                     return args.diff <= args.trh;
                 return false;
@@ -117,6 +117,9 @@ private:
 };
 
 float get_eltwise_threshold(dnnl_data_type_t dt, alg_t alg, bool is_fwd = true);
+// Relative error bound of the approximations under accuracy_mode::fast
+constexpr float fast_approx_threshold = 1e-4f;
+bool alg_has_fast_approx(alg_t alg);
 void skip_unimplemented_prb(const prb_t *prb, res_t *res);
 void skip_invalid_prb(const prb_t *prb, res_t *res);
 void compute_ref(const prb_t *prb, const args_t &args,
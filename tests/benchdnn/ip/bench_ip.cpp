@@ -36,12 +36,14 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for_(const auto &i_fpmath_mode : s.fpmath_mode)
+    for_(const auto &i_accuracy_mode : s.accuracy_mode)
     for (const auto &i_mb : s.mb) {
         attr_t attr;
         attr.insert(i_oscale);
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
         attr.insert(i_fpmath_mode);
+        attr.insert(i_accuracy_mode);
         handle_legacy_attr(attr, s.attr);
 
         const prb_t prb(
@@ -85,6 +87,8 @@ int bench(int argc, char **argv) {
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_attr_fpmath_mode(
                         s.fpmath_mode, def.fpmath_mode, argv[0])
+                || parse_attr_accuracy_mode(
+                        s.accuracy_mode, def.accuracy_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv(), argv[0])
                 || parse_reset(s, argv[0]) || parse_help(argv[0]);
@@ -241,7 +241,7 @@ int fill_dst(
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type(
             {prb->cfg[SRC].dt, prb->cfg[WEI].dt, prb->cfg[DST].dt}, prb->dir,
-            res);
+            res, dnnl_inner_product);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -47,12 +47,14 @@ void check_correctness(const settings_t &s, const settings_t &def) {
     for_(const auto &i_zero_points : s.zero_points)
     for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
+    for_(const auto &i_accuracy_mode : s.accuracy_mode)
     for (const auto &i_bia_cfg : bia_cfg) {
         attr_t attr;
         attr.insert(i_oscale);
         attr.insert(i_zero_points);
         attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
+        attr.insert(i_accuracy_mode);
         handle_legacy_attr(attr, s.attr);
 
         const bool strided_input = !i_strides[STRIDES_SRC].empty()
@@ -132,6 +134,8 @@ int bench(int argc, char **argv) {
                 || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
+                || parse_attr_accuracy_mode(
+                        s.accuracy_mode, def.accuracy_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
                         s.perf_template_csv(), argv[0])
                 || parse_reset(s, argv[0]) || parse_help(argv[0]);
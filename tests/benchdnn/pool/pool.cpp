@@ -122,8 +122,8 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type(
-            {prb->cfg[SRC].dt, prb->cfg[DST].dt}, prb->dir, res);
+    skip_unimplemented_data_type({prb->cfg[SRC].dt, prb->cfg[DST].dt},
+            prb->dir, res, dnnl_pooling_v2);
     skip_unimplemented_sum_po(prb->attr, res);
 
     if (is_cpu() && prb->cfg[SRC].dt != prb->cfg[DST].dt) {
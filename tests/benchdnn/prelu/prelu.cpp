@@ -151,7 +151,7 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type(prb->sdt, FWD_D, res);
+    skip_unimplemented_data_type(prb->sdt, FWD_D, res, dnnl_prelu);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -131,7 +131,8 @@ int fill_dst(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->sdt, prb->ddt}, prb->dir, res);
+    skip_unimplemented_data_type(
+            {prb->sdt, prb->ddt}, prb->dir, res, dnnl_reduction);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -193,7 +193,7 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     const auto sdt = prb->conf_in->dt;
     const auto ddt = prb->conf_out->dt;
-    skip_unimplemented_data_type({sdt, ddt}, prb->dir, res);
+    skip_unimplemented_data_type({sdt, ddt}, prb->dir, res, dnnl_reorder);
     skip_unimplemented_sum_po(prb->attr, res);
 
     bool oscale_ok = true;
@@ -236,8 +236,13 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
                 sdt == dnnl_bf16, ddt != dnnl_s32 && ddt != dnnl_f16);
         const bool bf16_dst_ok = IMPLICATION(
                 ddt == dnnl_bf16, sdt != dnnl_s32 && sdt != dnnl_f16);
+        // CPU reorder supports only f16<-->f16/f32 combinations.
+        const bool f16_src_ok = IMPLICATION(
+                sdt == dnnl_f16, ddt == dnnl_f16 || ddt == dnnl_f32);
+        const bool f16_dst_ok = IMPLICATION(
+                ddt == dnnl_f16, sdt == dnnl_f16 || sdt == dnnl_f32);
 
-        if (!bf16_src_ok || !bf16_dst_ok) {
+        if (!bf16_src_ok || !bf16_dst_ok || !f16_src_ok || !f16_dst_ok) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
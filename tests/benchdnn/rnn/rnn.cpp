@@ -716,7 +716,8 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *p_ptr,
 void skip_unimplemented_prb(const prb_t *prb_, res_t *res) {
     const prb_t &prb = *prb_;
     dir_t dir = str2dir(prop2str(prb.prop));
-    skip_unimplemented_data_type({prb.cfg[SRC_LAYER].dt}, dir, res);
+    skip_unimplemented_data_type(
+            {prb.cfg[SRC_LAYER].dt}, dir, res, dnnl_rnn);
     skip_unimplemented_sum_po(prb.attr, res);
 
 #if !defined(DNNL_X64) || DNNL_X64 == 0 \
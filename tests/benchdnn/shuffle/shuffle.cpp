@@ -83,7 +83,7 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+    skip_unimplemented_data_type({prb->dt}, prb->dir, res, dnnl_shuffle);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
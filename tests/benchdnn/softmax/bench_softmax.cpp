@@ -34,8 +34,11 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_dtag : s.dtag)
     for_(const auto &i_alg : s.alg)
     for_(const auto &i_axis : s.axis)
+    for_(const auto &i_mask : s.mask)
     for_(const auto &i_mb : s.mb)
     for_(const auto &i_oscale : s.oscale)
+    for_(const auto &i_scales : s.scales)
+    for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for (auto i_inplace : s.inplace) {
         if (i_oscale.policy != policy_t::COMMON) {
@@ -48,10 +51,12 @@ void check_correctness(const settings_t &s) {
 
         attr_t attr;
         attr.insert(i_oscale);
+        attr.insert(i_scales);
+        attr.insert(i_post_ops);
         attr.insert(i_scratchpad_mode);
 
         const prb_t prb(s.prb_dims, i_dir, i_sdt, i_ddt, i_stag, i_dtag, i_alg,
-                i_axis, i_inplace, attr, i_mb);
+                i_axis, i_mask, i_inplace, attr, i_mb);
         std::stringstream ss;
         ss << prb;
         const std::string cpp_pstr = ss.str();
@@ -75,6 +80,11 @@ int bench(int argc, char **argv) {
     using namespace parser;
     static settings_t s;
     static const settings_t def {};
+    static const std::string help_mask
+            = "INT    (Default: `-1`)\n    Specifies the softmax mask "
+              "correspondence mask. The mask is added to the source before "
+              "the softmax; the i-th bit is set if the mask varies along the "
+              "i-th dimension. A negative value means no mask.\n";
     for (; argc > 0; --argc, ++argv) {
         const bool parsed_options = parse_bench_settings(argv[0])
                 || parse_batch(bench, argv[0])
@@ -85,9 +95,13 @@ int bench(int argc, char **argv) {
                 || parse_tag(s.dtag, def.dtag, argv[0], "dtag")
                 || parse_alg(s.alg, def.alg, str2alg, argv[0])
                 || parse_axis(s.axis, def.axis, argv[0])
+                || parse_vector_option(
+                        s.mask, def.mask, atoi, argv[0], "mask", help_mask)
                 || parse_inplace(s.inplace, def.inplace, argv[0])
                 || parse_mb(s.mb, def.mb, argv[0])
                 || parse_attr_oscale(s.oscale, argv[0])
+                || parse_attr_scales(s.scales, argv[0])
+                || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
@@ -23,13 +23,23 @@ namespace softmax {
 void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &mask = args.find(DNNL_ARG_ATTR_SOFTMAX_MASK);
 
     float *dst_ptr = (float *)dst;
+    const float src_scale = prb->attr.scales.get(DNNL_ARG_SRC).scale;
+
+    // The source scale and the softmax mask are applied before the maximum
+    auto get_src = [&](int64_t idx) {
+        float s = src_scale * src.get_elem(idx);
+        if (prb->mask >= 0) s += mask.get_elem(prb->get_mask_off(idx));
+        return s;
+    };
 
     const auto alg = prb->alg;
     int64_t outer_size {0}, inner_size {0}, axis_size {0};
     get_sizes(prb, outer_size, inner_size, axis_size);
 
+    auto v_po_masks = prb->attr.post_ops.get_po_masks();
     benchdnn_parallel_nd(outer_size, inner_size, [&](int64_t ou, int64_t in) {
         float space_denom = 0.;
         float space_max = -FLT_MAX;
@@ -37,12 +47,12 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
 
         for (int64_t as = 0; as < axis_size; ++as) {
             int64_t idx = ou_in_offset + as * inner_size;
-            space_max = MAX2(space_max, src.get_elem(idx));
+            space_max = MAX2(space_max, get_src(idx));
         }
 
         for (int64_t as = 0; as < axis_size; ++as) {
             int64_t idx = ou_in_offset + as * inner_size;
-            float s = src.get_elem(idx);
+            float s = get_src(idx);
             if (alg == SOFTMAX) {
                 float D = dst_ptr[idx] = expf(s - space_max);
                 space_denom += D;
@@ -66,6 +76,9 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
                 dst_ptr[idx] -= space_denom;
             }
             maybe_oscale(prb->attr, dst_ptr[idx], prb->scales, 0);
+
+            const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, idx);
+            maybe_post_ops(prb->attr, dst_ptr[idx], 0.f, v_po_vals);
         }
     });
 }
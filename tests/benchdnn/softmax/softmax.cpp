@@ -28,6 +28,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "softmax/softmax.hpp"
 
 namespace softmax {
@@ -71,8 +72,12 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
 
     attr_args_t attr_args;
     attr_args.prepare_output_scales(prb->attr, prb->scales, 1);
+    attr_args.prepare_post_ops_mds(prb->attr, prb->ndims, prb->dims.data());
     auto dnnl_attr = make_benchdnn_dnnl_wrapper(
             create_dnnl_attr(prb->attr, attr_args));
+    if (prb->mask >= 0)
+        DNN_SAFE_STATUS(
+                dnnl_primitive_attr_set_softmax_mask(dnnl_attr, prb->mask));
 
     return dnnl_primitive_desc_create(&spd, &sd, dnnl_attr, engine, nullptr);
 }
@@ -157,6 +162,22 @@ int fill_data_fwd(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
     return OK;
 }
 
+int fill_mask(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    // Like an attention mask, every 5th value is masked out with a large
+    // negative number and the rest are kept. Masking a top source value makes
+    // the lower ones the top, and fully masked rows keep their values apart,
+    // so LOGSOFTMAX results are not affected by cancellation.
+    const auto nelems = mem_fp.nelems();
+    benchdnn_parallel_nd(nelems, [&](int64_t i) {
+        const float value = i % 5 == 0 ? -100.f : 0.f;
+        mem_fp.set_elem(i, value);
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
 int fill_data_bwd(
         const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp, int seed) {
     const auto nelems = mem_fp.nelems();
@@ -180,11 +201,32 @@ int fill_data_bwd(
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->sdt, prb->ddt}, prb->dir, res);
+    skip_unimplemented_data_type(
+            {prb->sdt, prb->ddt}, prb->dir, res, dnnl_softmax_v2);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    // Post-ops, scales and the softmax mask are defined for forward
+    // propagation only.
+    if (!(prb->dir & FLAG_FWD)
+            && (!prb->attr.post_ops.is_def() || !prb->attr.scales.is_def()
+                    || prb->mask >= 0)) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
+    // Output scales and argument scales are mutually exclusive
+    if (!prb->attr.oscale.is_def() && !prb->attr.scales.is_def()) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
+    if (prb->mask >= 0 && (prb->mask >> prb->ndims) != 0) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
     // See `skip_invalid_inplace` for details.
     if (prb->inplace) {
         skip_invalid_inplace(res, prb->sdt, prb->ddt, prb->stag, prb->dtag);
@@ -198,8 +240,14 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     const float trh_coeff_log = prb->alg == LOGSOFTMAX ? 5 : 1;
     const float trh_coeff_f32 = trh_dt == dnnl_f32 ? 10.f : 1.f;
     const float trh_coeff_bwd = (prb->dir & FLAG_FWD) ? 1.f : 4.f;
+    // Binary post-op values reach 10 in magnitude, a multiplication by them
+    // scales the error of the softmax output.
+    const float trh_coeff_po
+            = prb->attr.post_ops.find(attr_t::post_ops_t::kind_t::MUL) >= 0
+            ? 10.f
+            : 1.f;
     const float trh = trh_coeff_log * trh_coeff_bwd * trh_coeff_f32
-            * epsilon_dt(trh_dt);
+            * trh_coeff_po * epsilon_dt(trh_dt);
     cmp.set_threshold(trh);
 
     const int64_t axis_size = prb->dims[prb->axis];
@@ -215,12 +263,16 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     if (prb->dir & FLAG_BWD) zero_trust_percent = 30.f;
     cmp.set_zero_trust_percent(zero_trust_percent);
 
-    const auto softmax_add_check
-            = [&](const compare::compare_t::driver_check_func_args_t &args) {
-                  // SSE4.1 and OpenCL rdiff tolerance is too high for
-                  // certain scenarios.
-                  return args.diff < epsilon_dt(args.dt);
-              };
+    const bool with_po_mul = trh_coeff_po > 1.f;
+    const auto softmax_add_check =
+            [=](const compare::compare_t::driver_check_func_args_t &args) {
+                // SSE4.1 and OpenCL rdiff tolerance is too high for
+                // certain scenarios.
+                if (args.diff < epsilon_dt(args.dt)) return true;
+                // A post-op add after a multiplication may cancel digits out,
+                // the error is then bounded by the product, not the result.
+                return with_po_mul && args.diff < trh;
+            };
     cmp.set_driver_check_function(softmax_add_check);
 }
 
@@ -266,15 +318,41 @@ int doit(const prb_t *prb, res_t *res) {
 
         SAFE(fill_data_fwd(prb, src_dt, src_fp), WARN);
 
+        dnn_mem_t mask_dt, mask_fp;
+        if (prb->mask >= 0) {
+            const auto &mask_md
+                    = query_md(const_pd, DNNL_ARG_ATTR_SOFTMAX_MASK);
+            mask_dt = dnn_mem_t(mask_md, test_engine);
+            mask_fp = dnn_mem_t(mask_md, dnnl_f32, tag::abx, ref_engine);
+            SAFE(fill_mask(prb, mask_dt, mask_fp), WARN);
+        }
+
+        dnn_mem_t src_scales_m;
+        const auto &src_scale = prb->attr.scales.get(DNNL_ARG_SRC);
+        const float src_scale_val = src_scale.scale;
+        maybe_prepare_runtime_scales(
+                src_scales_m, src_scale, 1, &src_scale_val);
+
+        std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+        std::vector<int> binary_po_args;
+        SAFE(binary::setup_binary_po(
+                     const_pd, binary_po_args, binary_po_dt, binary_po_fp),
+                WARN);
+
         args.set(DNNL_ARG_SRC, src_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        args.set(binary_po_args, binary_po_dt);
+        args.set(DNNL_ARG_ATTR_SOFTMAX_MASK, mask_dt);
+        args.set(DNNL_ARG_ATTR_INPUT_SCALES | DNNL_ARG_SRC, src_scales_m);
 
         SAFE(execute_and_wait(prim, args, res), WARN);
 
         if (is_bench_mode(CORR)) {
             ref_args.set(DNNL_ARG_SRC, src_fp);
             ref_args.set(DNNL_ARG_DST, dst_fp);
+            ref_args.set(binary_po_args, binary_po_fp);
+            ref_args.set(DNNL_ARG_ATTR_SOFTMAX_MASK, mask_fp);
 
             check_correctness(prb, {DST}, args, ref_args, setup_cmp, res);
         }
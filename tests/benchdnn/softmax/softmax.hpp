@@ -55,6 +55,7 @@ struct settings_t : public base_settings_t {
     std::vector<std::string> stag {tag::abx}, dtag {tag::any};
     std::vector<alg_t> alg {SOFTMAX};
     std::vector<int> axis {1};
+    std::vector<int> mask {-1};
 
     const char *perf_template_csv() const {
         static const std::string args
@@ -68,8 +69,8 @@ struct settings_t : public base_settings_t {
 struct prb_t : public prb_dims_t {
     prb_t(const prb_dims_t &prb_dims, dir_t dir, dnnl_data_type_t sdt,
             dnnl_data_type_t ddt, const std::string &stag,
-            const std::string &dtag, alg_t alg, int axis, bool inplace,
-            const attr_t &attr, int64_t mb = 0)
+            const std::string &dtag, alg_t alg, int axis, int mask,
+            bool inplace, const attr_t &attr, int64_t mb = 0)
         : prb_dims_t(prb_dims)
         , dir(dir)
         , sdt(sdt)
@@ -78,6 +79,7 @@ struct prb_t : public prb_dims_t {
         , dtag(dtag)
         , alg(alg)
         , axis(axis)
+        , mask(mask)
         , inplace(inplace)
         , attr(attr)
         , user_mb(mb)
@@ -94,12 +96,27 @@ struct prb_t : public prb_dims_t {
     std::string stag, dtag;
     alg_t alg;
     int axis;
+    int mask; // softmax mask correspondence mask, negative if not set
     bool inplace;
     attr_t attr;
     int64_t user_mb;
 
     float *scales;
     void generate_oscales();
+
+    // Returns the offset of the softmax mask element added to the source
+    // element at the logical offset `off`.
+    int64_t get_mask_off(int64_t off) const {
+        int64_t mask_off = 0, stride = 1;
+        for (int d = ndims - 1; d >= 0; d--) {
+            const int64_t pos = off % dims[d];
+            off /= dims[d];
+            if (!(mask & (1 << d))) continue;
+            mask_off += pos * stride;
+            stride *= dims[d];
+        }
+        return mask_off;
+    }
 };
 std::ostream &operator<<(std::ostream &s, const prb_t &prb);
 
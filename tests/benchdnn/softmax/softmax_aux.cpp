@@ -65,6 +65,7 @@ std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
     if (canonical || prb.alg != def.alg[0])
         s << "--alg=" << alg2str(prb.alg) << " ";
     if (canonical || prb.axis != def.axis[0]) s << "--axis=" << prb.axis << " ";
+    if (canonical || prb.mask != def.mask[0]) s << "--mask=" << prb.mask << " ";
     if (canonical || prb.inplace != def.inplace[0])
         s << "--inplace=" << bool2str(prb.inplace) << " ";
 
@@ -79,7 +79,7 @@ int fill_src(
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     std::vector<dnnl_data_type_t> dts = prb->sdt;
     dts.push_back(prb->ddt);
-    skip_unimplemented_data_type(dts, prb->dir, res);
+    skip_unimplemented_data_type(dts, prb->dir, res, dnnl_sum);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -212,6 +212,10 @@ int compare_t::compare_p2p(const dnn_mem_t &exp_mem, const dnn_mem_t &got_mem,
                 const float experimental_tolerated_trh
                         = std::max(epsilon_dt(dt), 2e-5f);
                 ok = args.diff <= experimental_tolerated_trh;
+                // Fast approximations of eltwise post-ops are only bounded in
+                // the relative error.
+                if (!ok && attr.accuracy_mode == dnnl_accuracy_mode_fast)
+                    ok = args.rel_diff <= eltwise::fast_approx_threshold;
             }
             // Binary MAX, MIN and comparison operations post-ops may return
             // different results for different backends when NaN is one of
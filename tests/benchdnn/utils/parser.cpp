@@ -222,6 +222,20 @@ bool parse_attr_fpmath_mode(std::vector<dnnl_fpmath_mode_t> &fpmath_mode,
             str, option_name, help);
 }
 
+bool parse_attr_accuracy_mode(
+        std::vector<dnnl_accuracy_mode_t> &accuracy_mode,
+        const std::vector<dnnl_accuracy_mode_t> &def_accuracy_mode,
+        const char *str,
+        const std::string &option_name /* = "attr-accuracy"*/) {
+    static const std::string help
+            = "MODE    (Default: `strict`)\n    Specifies accuracy_mode "
+              "attribute. `MODE` values can be `strict` or `fast`.\n    More "
+              "details at "
+            + doc_url + "knobs_attr.md\n";
+    return parse_vector_option(accuracy_mode, def_accuracy_mode,
+            str2accuracy_mode, str, option_name, help);
+}
+
 bool parse_axis(std::vector<int> &axis, const std::vector<int> &def_axis,
         const char *str, const std::string &option_name /* = "axis"*/) {
     static const std::string help
@@ -201,6 +201,11 @@ bool parse_attr_fpmath_mode(std::vector<dnnl_fpmath_mode_t> &fpmath_mode,
         const std::vector<dnnl_fpmath_mode_t> &def_fpmath_mode, const char *str,
         const std::string &option_name = "attr-fpmath");
 
+bool parse_attr_accuracy_mode(
+        std::vector<dnnl_accuracy_mode_t> &accuracy_mode,
+        const std::vector<dnnl_accuracy_mode_t> &def_accuracy_mode,
+        const char *str, const std::string &option_name = "attr-accuracy");
+
 bool parse_axis(std::vector<int> &axis, const std::vector<int> &def_axis,
         const char *str, const std::string &option_name = "axis");
 
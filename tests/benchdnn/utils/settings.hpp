@@ -29,6 +29,8 @@ struct base_settings_t {
     std::vector<dnnl_scratchpad_mode_t> scratchpad_mode {
             dnnl_scratchpad_mode_library};
     std::vector<dnnl_fpmath_mode_t> fpmath_mode {dnnl_fpmath_mode_strict};
+    std::vector<dnnl_accuracy_mode_t> accuracy_mode {
+            dnnl_accuracy_mode_strict};
     attr_t attr = {};
     const char *pattern = NULL;
 
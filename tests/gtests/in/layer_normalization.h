@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -72,6 +72,9 @@ CPU_INST_TEST_CASE(SimpleZeroDim, PARAMS_NC({0, 9}), PARAMS_NC({1, 0}));
 CPU_INST_TEST_CASE(
         Simple_NC, PARAMS_NC({1, 100}), PARAMS_NC({20, 8}), PARAMS_NC({2, 10}));
 
+// Fewer rows than threads with a large normalized axis (split-C mode).
+CPU_INST_TEST_CASE(LargeC_NC, PARAMS_NC({1, 4096}), PARAMS_NC({2, 1031}));
+
 CPU_INST_TEST_CASE(Simple_TNC, PARAMS_TNC({6, 32, 8}), PARAMS_TNC({2, 10, 4}),
         PARAMS_TNC({2, 8, 16}));
 
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+// The jit concat bypasses the cache with non-temporal stores when the
+// destination is larger than the last level cache. The chunk sizes of the
+// inputs are not multiples of the vector length, so the rows start at
+// unaligned destination addresses and the alignment prologue is covered.
+TEST(concat_nt_stores_test_t, TestLargeDestination) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test checks CPU kernels only.");
+
+    // The same threshold as in jit_uni_concat_t
+    const size_t llc_size
+            = (size_t)impl::cpu::platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    SKIP_IF(llc_size > ((size_t)1 << 30),
+            "The last level cache is too large for the test.");
+
+    const memory::dim C0 = 1000, C1 = 1003;
+    const memory::dim N = llc_size / (C0 + C1) + 1;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    std::vector<memory::desc> src_mds {
+            {{N, C0}, dt::u8, tag::ab}, {{N, C1}, dt::u8, tag::ab}};
+    memory::desc dst_md({N, C0 + C1}, dt::u8, tag::ab);
+    ASSERT_GT(dst_md.get_size(), llc_size);
+
+    auto pd = concat::primitive_desc(dst_md, 1, src_mds, eng);
+    ASSERT_EQ(std::string(pd.impl_info_str()).find("jit:"), 0u)
+            << pd.impl_info_str();
+
+    std::vector<memory> srcs;
+    for (int i = 0; i < 2; i++) {
+        srcs.push_back(test::make_memory(src_mds[i], eng));
+        auto ptr = map_memory<uint8_t>(srcs[i]);
+        const memory::dim nelems = N * (i == 0 ? C0 : C1);
+        for (memory::dim e = 0; e < nelems; e++)
+            ptr[e] = (uint8_t)((e * 13 + i * 7) % 251);
+    }
+    auto dst = test::make_memory(dst_md, eng);
+
+    concat(pd).execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, srcs[0]},
+                    {DNNL_ARG_MULTIPLE_SRC + 1, srcs[1]},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    auto dst_ptr = map_memory<uint8_t>(dst);
+    for_(memory::dim n = 0; n < N; n++)
+    for (memory::dim c = 0; c < C0 + C1; c++) {
+        const int i = c < C0 ? 0 : 1;
+        const memory::dim e = i == 0 ? n * C0 + c : n * C1 + c - C0;
+        const uint8_t ref = (uint8_t)((e * 13 + i * 7) % 251);
+        ASSERT_EQ(dst_ptr[n * (C0 + C1) + c], ref) << "n: " << n << " c: " << c;
+    }
+}
+
+} // namespace dnnl
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+// Allocator recording the live buffers and the number of calls
+struct counting_allocator_t {
+    std::map<void *, size_t> buffers;
+    int n_mallocs = 0;
+    int n_frees = 0;
+
+    static void *malloc_fn(size_t size, size_t alignment, void *data) {
+        auto *a = static_cast<counting_allocator_t *>(data);
+        void *ptr = nullptr;
+#ifdef _WIN32
+        ptr = _aligned_malloc(size, alignment);
+#else
+        if (posix_memalign(&ptr, alignment, size) != 0) ptr = nullptr;
+#endif
+        if (ptr) {
+            a->buffers[ptr] = size;
+            a->n_mallocs++;
+        }
+        return ptr;
+    }
+
+    static void free_fn(void *ptr, void *data) {
+        auto *a = static_cast<counting_allocator_t *>(data);
+        if (a->buffers.erase(ptr) == 1) a->n_frees++;
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        ::free(ptr);
+#endif
+    }
+};
+} // namespace
+
+class cpu_allocator_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "The allocator is a CPU engine feature.");
+    }
+
+    memory::desc md_ {{2, 16, 32, 32}, memory::data_type::f32,
+            memory::format_tag::nchw};
+};
+
+TEST_F(cpu_allocator_test_t, TestUserAllocator) {
+    engine eng(engine::kind::cpu, 0);
+    counting_allocator_t allocator;
+    eng.set_cpu_allocator(counting_allocator_t::malloc_fn,
+            counting_allocator_t::free_fn, &allocator);
+    {
+        memory mem(md_, eng);
+        ASSERT_EQ(allocator.n_mallocs, 1);
+        ASSERT_EQ(allocator.n_frees, 0);
+        void *handle = mem.get_data_handle();
+        ASSERT_EQ(allocator.buffers.count(handle), 1u);
+        ASSERT_GE(allocator.buffers[handle], md_.get_size());
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(handle) % 64, 0u);
+
+        // A user-provided handle does not go through the allocator
+        std::vector<float> buf(md_.get_size() / sizeof(float));
+        memory user_mem(md_, eng, buf.data());
+        ASSERT_EQ(allocator.n_mallocs, 1);
+    }
+    ASSERT_EQ(allocator.n_frees, 1);
+    ASSERT_TRUE(allocator.buffers.empty());
+
+    // A memory object is released with the allocator it was created with,
+    // even if the engine allocator has been replaced since then
+    {
+        memory mem(md_, eng);
+        ASSERT_EQ(allocator.n_mallocs, 2);
+        eng.set_cpu_allocator(nullptr, nullptr);
+        memory mem_default(md_, eng);
+        ASSERT_EQ(allocator.n_mallocs, 2);
+        ASSERT_EQ(allocator.buffers.count(mem_default.get_data_handle()), 0u);
+    }
+    ASSERT_EQ(allocator.n_frees, 2);
+    ASSERT_TRUE(allocator.buffers.empty());
+}
+
+TEST_F(cpu_allocator_test_t, TestPoolReuse) {
+    engine eng(engine::kind::cpu, 0);
+    eng.set_cpu_allocator_flags(engine::cpu_allocator_flags::pool);
+
+    void *handle = nullptr;
+    {
+        memory mem(md_, eng);
+        handle = mem.get_data_handle();
+        ASSERT_NE(handle, nullptr);
+    }
+    {
+        // The freed buffer is reused for an allocation of the same size
+        memory mem(md_, eng);
+        ASSERT_EQ(mem.get_data_handle(), handle);
+
+        // ... but not while it is in use
+        memory other_mem(md_, eng);
+        ASSERT_NE(other_mem.get_data_handle(), handle);
+    }
+    {
+        // A slightly smaller buffer falls into the same size class
+        memory::desc smaller_md({2, 16, 32, 31}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        memory mem(smaller_md, eng);
+        ASSERT_EQ(mem.get_data_handle(), handle);
+    }
+
+    // The pooled memory is usable
+    {
+        memory mem(md_, eng);
+        fill_data<float>(md_.get_size() / sizeof(float), mem, 1.f, 0.5f);
+        auto ptr = map_memory<float>(mem);
+        for (size_t i = 0; i < md_.get_size() / sizeof(float); i++)
+            ASSERT_TRUE(std::isfinite(ptr[i]));
+    }
+}
+
+TEST_F(cpu_allocator_test_t, TestInvalidArguments) {
+    engine eng(engine::kind::cpu, 0);
+    counting_allocator_t allocator;
+
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator(nullptr,
+                      counting_allocator_t::malloc_fn,
+                      counting_allocator_t::free_fn, &allocator),
+            dnnl_invalid_arguments);
+    // malloc and free go in pairs
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator(eng.get(),
+                      counting_allocator_t::malloc_fn, nullptr, &allocator),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator(eng.get(), nullptr,
+                      counting_allocator_t::free_fn, &allocator),
+            dnnl_invalid_arguments);
+    EXPECT_ANY_THROW(eng.set_cpu_allocator(
+            counting_allocator_t::malloc_fn, nullptr, &allocator));
+
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator_flags(
+                      nullptr, dnnl_cpu_allocator_pool),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator_flags(eng.get(), 0x100U),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator_flags(eng.get(),
+                      dnnl_cpu_allocator_numa_interleave
+                              | dnnl_cpu_allocator_numa_local),
+            dnnl_invalid_arguments);
+
+    // Failed calls keep the allocator
+    eng.set_cpu_allocator(counting_allocator_t::malloc_fn,
+            counting_allocator_t::free_fn, &allocator);
+    ASSERT_EQ(dnnl_cpu_engine_set_allocator(eng.get(),
+                      counting_allocator_t::malloc_fn, nullptr, &allocator),
+            dnnl_invalid_arguments);
+    {
+        memory mem(md_, eng);
+        ASSERT_EQ(allocator.n_mallocs, 1);
+    }
+    ASSERT_EQ(allocator.n_frees, 1);
+
+    // Null callbacks restore the built-in allocator
+    eng.set_cpu_allocator(nullptr, nullptr);
+    {
+        memory mem(md_, eng);
+        ASSERT_EQ(allocator.n_mallocs, 1);
+    }
+}
+
+} // namespace dnnl
@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+struct gemm_grouped_problem_t {
+    char transa, transb;
+    dnnl_dim_t M, N, K;
+    float alpha, beta;
+};
+
+class gemm_grouped_test_t : public ::testing::Test {
+protected:
+    // Row-major reference
+    static void ref_sgemm(const gemm_grouped_problem_t &p, const float *A,
+            dnnl_dim_t lda, const float *B, dnnl_dim_t ldb, float *C,
+            dnnl_dim_t ldc) {
+        const bool tr_a = p.transa == 'T', tr_b = p.transb == 'T';
+        for (dnnl_dim_t m = 0; m < p.M; m++)
+            for (dnnl_dim_t n = 0; n < p.N; n++) {
+                double acc = 0;
+                for (dnnl_dim_t k = 0; k < p.K; k++) {
+                    const float a = tr_a ? A[k * lda + m] : A[m * lda + k];
+                    const float b = tr_b ? B[n * ldb + k] : B[k * ldb + n];
+                    acc += (double)a * b;
+                }
+                float &c = C[m * ldc + n];
+                c = p.alpha * (float)acc + (p.beta == 0.f ? 0.f : p.beta * c);
+            }
+    }
+
+    static void check(const std::vector<gemm_grouped_problem_t> &problems) {
+        const dnnl_dim_t group_size = (dnnl_dim_t)problems.size();
+
+        std::vector<char> transa, transb;
+        std::vector<dnnl_dim_t> M, N, K, lda, ldb, ldc;
+        std::vector<float> alpha, beta;
+        std::vector<std::vector<float>> A, B, C, C_ref;
+        for (const auto &p : problems) {
+            transa.push_back(p.transa);
+            transb.push_back(p.transb);
+            M.push_back(p.M);
+            N.push_back(p.N);
+            K.push_back(p.K);
+            alpha.push_back(p.alpha);
+            beta.push_back(p.beta);
+            lda.push_back(p.transa == 'T' ? p.M : p.K);
+            ldb.push_back(p.transb == 'T' ? p.K : p.N);
+            ldc.push_back(p.N);
+
+            const size_t idx = A.size();
+            A.emplace_back(std::max<dnnl_dim_t>(1, p.M * p.K));
+            B.emplace_back(std::max<dnnl_dim_t>(1, p.K * p.N));
+            C.emplace_back(std::max<dnnl_dim_t>(1, p.M * p.N));
+            for (size_t i = 0; i < A[idx].size(); i++)
+                A[idx][i] = (float)((i * 7 + idx) % 13) - 6.f;
+            for (size_t i = 0; i < B[idx].size(); i++)
+                B[idx][i] = (float)((i * 5 + idx) % 11) - 5.f;
+            for (size_t i = 0; i < C[idx].size(); i++)
+                C[idx][i] = p.beta == 0.f ? NAN : (float)(i % 3);
+            C_ref.push_back(C[idx]);
+        }
+
+        std::vector<const float *> A_ptrs, B_ptrs;
+        std::vector<float *> C_ptrs;
+        for (dnnl_dim_t i = 0; i < group_size; i++) {
+            A_ptrs.push_back(A[i].data());
+            B_ptrs.push_back(B[i].data());
+            C_ptrs.push_back(C[i].data());
+            ref_sgemm(problems[i], A[i].data(), std::max<dnnl_dim_t>(1, lda[i]),
+                    B[i].data(), std::max<dnnl_dim_t>(1, ldb[i]),
+                    C_ref[i].data(), std::max<dnnl_dim_t>(1, ldc[i]));
+        }
+        for (auto *lds : {&lda, &ldb, &ldc})
+            for (auto &ld : *lds)
+                ld = std::max<dnnl_dim_t>(1, ld);
+
+        ASSERT_EQ(dnnl_sgemm_grouped(group_size, transa.data(), transb.data(),
+                          M.data(), N.data(), K.data(), alpha.data(),
+                          A_ptrs.data(), lda.data(), B_ptrs.data(), ldb.data(),
+                          beta.data(), C_ptrs.data(), ldc.data()),
+                dnnl_success);
+
+        for (dnnl_dim_t i = 0; i < group_size; i++) {
+            const auto &p = problems[i];
+            for (dnnl_dim_t j = 0; j < p.M * p.N; j++)
+                ASSERT_NEAR(C[i][j], C_ref[i][j], 1e-4 * (1 + p.K))
+                        << "problem " << i << " element " << j;
+        }
+    }
+};
+
+TEST_F(gemm_grouped_test_t, TestSmallProblems) {
+    std::vector<gemm_grouped_problem_t> problems;
+    for (int i = 0; i < 64; i++)
+        problems.push_back({i % 2 ? 'T' : 'N', i % 3 ? 'N' : 'T', 1 + i % 7,
+                8 + i % 5, 16 + i, 1.f, i % 4 ? 0.f : 2.f});
+    check(problems);
+}
+
+TEST_F(gemm_grouped_test_t, TestMixedProblems) {
+    check({{'N', 'N', 256, 128, 64, 1.f, 0.f},
+            {'T', 'N', 3, 500, 17, 0.5f, 1.f},
+            {'N', 'T', 100, 1, 300, 1.f, 0.f},
+            {'T', 'T', 64, 64, 64, 2.f, -1.f},
+            {'N', 'N', 0, 10, 10, 1.f, 0.f},
+            {'N', 'N', 10, 10, 0, 1.f, 0.f},
+            {'N', 'N', 10, 10, 10, 0.f, 3.f}});
+}
+
+TEST_F(gemm_grouped_test_t, TestInvalidArguments) {
+    const char trans = 'N', bad_trans = 'P';
+    const dnnl_dim_t dim = 4, ld = 4;
+    const float alpha = 1.f, beta = 0.f;
+    float a[16] = {0}, b[16] = {0}, c[16] = {0};
+    const float *A = a, *B = b;
+    float *C = c;
+
+    ASSERT_EQ(dnnl_sgemm_grouped(0, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                      nullptr, nullptr, nullptr),
+            dnnl_success);
+    ASSERT_EQ(dnnl_sgemm_grouped(-1, &trans, &trans, &dim, &dim, &dim, &alpha,
+                      &A, &ld, &B, &ld, &beta, &C, &ld),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_grouped(1, &bad_trans, &trans, &dim, &dim, &dim,
+                      &alpha, &A, &ld, &B, &ld, &beta, &C, &ld),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_grouped(1, &trans, &trans, &dim, &dim, &dim, &alpha,
+                      &A, &ld, &B, &ld, &beta, nullptr, &ld),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
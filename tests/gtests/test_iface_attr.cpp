@@ -61,6 +61,180 @@ TEST_F(attr_test_t, TestScratchpadMode) {
     }
 }
 
+TEST_F(attr_test_t, TestNumThreads) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_num_threads(), 0);
+    for (int nthr : {1, 3, 0}) {
+        attr.set_num_threads(nthr);
+        ASSERT_EQ(nthr, attr.get_num_threads());
+    }
+    EXPECT_ANY_THROW(attr.set_num_threads(-1));
+}
+
+TEST_F(attr_test_t, TestNumThreadsEx) {
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    memory::desc md({2, 16, 8, 8}, data_type::f32, memory::format_tag::nchw);
+    auto src = test::make_memory(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src, 1., true);
+
+    auto eltwise_d = eltwise_forward::desc(
+            prop_kind::forward_inference, algorithm::eltwise_relu, md);
+
+    std::vector<memory> dsts;
+    for (int nthr : {0, 1, 2}) {
+        dnnl::primitive_attr attr;
+        attr.set_num_threads(nthr);
+        auto pd = eltwise_forward::primitive_desc(eltwise_d, attr, eng);
+        ASSERT_EQ(pd.get_primitive_attr().get_num_threads(), nthr);
+
+        auto dst = test::make_memory(md, eng);
+        eltwise_forward(pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+        dsts.push_back(dst);
+    }
+
+    for (size_t i = 1; i < dsts.size(); i++)
+        compare_data<float>(dsts[0], dsts[i]);
+}
+
+TEST_F(attr_test_t, TestAccuracyMode) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_accuracy_mode(), accuracy_mode::strict);
+    for (auto m : {accuracy_mode::fast, accuracy_mode::strict}) {
+        attr.set_accuracy_mode(m);
+        ASSERT_EQ(m, attr.get_accuracy_mode());
+    }
+}
+
+TEST_F(attr_test_t, TestAccuracyModeEx) {
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    memory::desc md({2, 16, 8, 8}, data_type::f32, memory::format_tag::nchw);
+    auto src = test::make_memory(md, eng);
+    {
+        // Inputs where the functions are well conditioned, so that the strict
+        // results are accurate enough to be the reference
+        const memory::dim nelems = md.get_size() / sizeof(float);
+        auto ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            ptr[i] = -2.f + 4.f * i / nelems;
+    }
+
+    for (auto alg : {algorithm::eltwise_exp, algorithm::eltwise_logistic,
+                 algorithm::eltwise_tanh, algorithm::eltwise_swish,
+                 algorithm::eltwise_gelu_tanh, algorithm::eltwise_gelu_erf,
+                 algorithm::eltwise_mish}) {
+        const float alpha = alg == algorithm::eltwise_swish ? 1.f : 0.f;
+        auto eltwise_d = eltwise_forward::desc(
+                prop_kind::forward_inference, alg, md, alpha);
+
+        std::vector<memory> dsts;
+        for (auto m : {accuracy_mode::strict, accuracy_mode::fast}) {
+            dnnl::primitive_attr attr;
+            attr.set_accuracy_mode(m);
+            auto pd = eltwise_forward::primitive_desc(eltwise_d, attr, eng);
+            ASSERT_EQ(pd.get_primitive_attr().get_accuracy_mode(), m);
+
+            auto dst = test::make_memory(md, eng);
+            eltwise_forward(pd).execute(
+                    strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+            strm.wait();
+            dsts.push_back(dst);
+        }
+        // The documented bound of the fast approximations
+        compare_data<float>(dsts[0], dsts[1], 1e-4f);
+    }
+}
+
+TEST_F(attr_test_t, TestAccuracyModeRuntimeM) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The accuracy mode is applied on CPU only.");
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    // M is not a multiple of the block size, so the tail rows use kernels
+    // created at execution when M is a runtime dimension
+    const memory::dim M = 37, N = 64, K = 32;
+    memory::desc src_md({M, K}, data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, memory::format_tag::ab);
+    memory::desc rt_src_md(
+            {DNNL_RUNTIME_DIM_VAL, K}, data_type::f32, memory::format_tag::ab);
+    memory::desc rt_dst_md(
+            {DNNL_RUNTIME_DIM_VAL, N}, data_type::f32, memory::format_tag::ab);
+
+    auto src = test::make_memory(src_md, eng);
+    auto wei = test::make_memory(wei_md, eng);
+    fill_data<float>(M * K, src, 0.f, 1.f);
+    fill_data<float>(K * N, wei, 0.f, 0.25f);
+
+    post_ops ops;
+    ops.append_eltwise(1.f, algorithm::eltwise_tanh, 0.f, 0.f);
+    dnnl::primitive_attr attr;
+    attr.set_accuracy_mode(accuracy_mode::fast);
+    attr.set_post_ops(ops);
+
+    std::vector<memory> dsts;
+    for (bool runtime_M : {false, true}) {
+        auto pd = matmul::primitive_desc(
+                matmul::desc(runtime_M ? rt_src_md : src_md, wei_md,
+                        runtime_M ? rt_dst_md : dst_md),
+                attr, eng);
+        SKIP_IF(std::string(pd.impl_info_str()).find("brg")
+                        == std::string::npos,
+                "The test checks the brgemm matmul.");
+
+        auto dst = test::make_memory(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+        dsts.push_back(dst);
+    }
+
+    // All the rows are computed by kernels generated in the fast mode
+    auto ref = map_memory<float>(dsts[0]);
+    auto got = map_memory<float>(dsts[1]);
+    for (memory::dim i = 0; i < M * N; i++)
+        ASSERT_EQ(ref[i], got[i]) << "m: " << i / N << " n: " << i % N;
+}
+
+TEST_F(attr_test_t, TestSoftmaxMask) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_softmax_mask(), -1);
+    for (int mask : {12, 0}) {
+        attr.set_softmax_mask(mask);
+        ASSERT_EQ(mask, attr.get_softmax_mask());
+    }
+    EXPECT_ANY_THROW(attr.set_softmax_mask(-1));
+}
+
+TEST_F(attr_test_t, TestSoftmaxMaskEx) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The softmax mask is implemented on CPU only.");
+    engine eng = get_test_engine();
+
+    memory::desc md({2, 4, 8, 16}, data_type::f32, memory::format_tag::abcd);
+    auto softmax_d = softmax_v2_forward::desc(prop_kind::forward_inference,
+            algorithm::softmax_accurate, md, md, 3);
+
+    // The mask descriptor is dense with the broadcast dimensions set to one
+    dnnl::primitive_attr attr;
+    attr.set_softmax_mask((1 << 0) | (1 << 3));
+    auto pd = softmax_v2_forward::primitive_desc(softmax_d, attr, eng);
+    auto mask_md = pd.query_md(query::exec_arg_md, DNNL_ARG_ATTR_SOFTMAX_MASK);
+    ASSERT_EQ(mask_md, memory::desc({2, 1, 1, 16}, data_type::f32,
+                               memory::format_tag::abcd));
+
+    // Bits beyond the source dimensions are rejected
+    attr.set_softmax_mask(1 << 4);
+    EXPECT_ANY_THROW(softmax_v2_forward::primitive_desc(softmax_d, attr, eng));
+}
+
 TEST_F(attr_test_t, TestScratchpadModeEx) {
     engine eng = get_test_engine();
 
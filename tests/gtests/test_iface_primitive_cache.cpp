@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2021 Intel Corporation
+* Copyright 2020-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -22,18 +22,22 @@
 
 namespace dnnl {
 
-void fill_primitive_cache(int n) {
+eltwise_forward make_relu(const engine &eng, memory::dim mb) {
     using tag = memory::format_tag;
     using dt = memory::data_type;
 
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, {{mb, 1, 1, 1}, dt::f32, tag::nchw}, 0.f,
+            0.f);
+    auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
+    return eltwise_forward(relu_pd);
+}
+
+void fill_primitive_cache(int n) {
     engine eng(get_test_engine_kind(), 0);
     for (int i = 0; i < n; i++) {
         // fill primitive cache with n primitives
-        auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
-                algorithm::eltwise_relu, {{i, 1, 1, 1}, dt::f32, tag::nchw},
-                0.f, 0.f);
-        auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
-        auto relu = eltwise_forward(relu_pd);
+        auto relu = make_relu(eng, i);
     }
 }
 
@@ -89,6 +93,104 @@ TEST(primitive_cache_test, TestSizeGreaterCapacity) {
     ASSERT_EQ(get_primitive_cache_size(), 10);
 }
 
+TEST(primitive_cache_test, TestCapacityLessShards) {
+    // The capacity limits the whole cache, not a single shard
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(3);
+    fill_primitive_cache(50);
+    ASSERT_EQ(get_primitive_cache_size(), 3);
+
+    set_primitive_cache_capacity(1);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+}
+
+TEST(primitive_cache_test, TestEvictionOrder) {
+    // A single shard makes the cache a plain CLOCK cache
+    const int n_shards = impl::set_primitive_cache_n_shards(1);
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    engine eng(get_test_engine_kind(), 0);
+    const auto in_cache = [](const primitive &p) {
+        return impl::is_primitive_in_cache(p.get());
+    };
+
+    std::vector<primitive> prims;
+    for (int i = 0; i < 4; i++)
+        prims.push_back(make_relu(eng, i + 1));
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+
+    // All the entries are referenced: the clock hand clears the marks on
+    // the first pass and evicts one entry on the second one.
+    auto new_prim = make_relu(eng, 5);
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+    ASSERT_TRUE(in_cache(new_prim));
+    int n_evicted = 0;
+    int hot = -1;
+    for (int i = 0; i < 4; i++) {
+        if (!in_cache(prims[i]))
+            n_evicted++;
+        else if (hot < 0)
+            hot = i;
+    }
+    ASSERT_EQ(n_evicted, 1);
+
+    // A hit marks the entry as referenced again. The next eviction takes one
+    // of the remaining not referenced entries, while the hot entry and the
+    // new one, which is referenced on insertion, stay in the cache.
+    auto hot_prim = make_relu(eng, hot + 1);
+    auto new_prim2 = make_relu(eng, 6);
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+    ASSERT_TRUE(in_cache(hot_prim));
+    ASSERT_TRUE(in_cache(new_prim));
+    ASSERT_TRUE(in_cache(new_prim2));
+
+    // Only one entry of the first ones is left after the hits
+    hot_prim = make_relu(eng, hot + 1);
+    new_prim = make_relu(eng, 5);
+    auto new_prim3 = make_relu(eng, 7);
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+    ASSERT_TRUE(in_cache(hot_prim));
+    ASSERT_TRUE(in_cache(new_prim));
+    ASSERT_TRUE(in_cache(new_prim2));
+    ASSERT_TRUE(in_cache(new_prim3));
+    for (int i = 0; i < 4; i++)
+        if (i != hot) ASSERT_FALSE(in_cache(prims[i]));
+
+    set_primitive_cache_capacity(0);
+    impl::set_primitive_cache_n_shards(n_shards);
+}
+
+TEST(primitive_cache_test, TestAccuracyMode) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    engine eng(get_test_engine_kind(), 0);
+    auto tanh_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_tanh, {{2, 16, 4, 4}, dt::f32, tag::nchw}, 0.f,
+            0.f);
+    const auto make_tanh = [&](accuracy_mode mode) {
+        primitive_attr attr;
+        attr.set_accuracy_mode(mode);
+        return eltwise_forward(
+                eltwise_forward::primitive_desc(tanh_d, attr, eng));
+    };
+
+    // The kernels differ, the primitives must not share a cache entry
+    auto strict_prim = make_tanh(accuracy_mode::strict);
+    auto fast_prim = make_tanh(accuracy_mode::fast);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+    ASSERT_TRUE(impl::is_primitive_in_cache(strict_prim.get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(fast_prim.get()));
+
+    // ... while each of them is hit by the same request
+    make_tanh(accuracy_mode::strict);
+    make_tanh(accuracy_mode::fast);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+}
+
 TEST(primitive_cache_test, TestCacheHit) {
     set_primitive_cache_capacity(0);
     set_primitive_cache_capacity(2);
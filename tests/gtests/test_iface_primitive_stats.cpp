@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class primitive_stats_test_t : public ::testing::Test {};
+
+TEST_F(primitive_stats_test_t, TestStats) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dims dims = {2, 16, 4, 4};
+    auto md = memory::desc(
+            dims, memory::data_type::f32, memory::format_tag::nchw);
+    auto src = test::make_memory(md, eng);
+    auto dst = test::make_memory(md, eng);
+
+    auto pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_relu, md, 0.f},
+            eng);
+    auto prim = eltwise_forward(pd);
+    // A primitive from the cache has its own counters
+    auto prim_cached = eltwise_forward(pd);
+
+    auto stats = prim.get_stats();
+    ASSERT_EQ(stats.ncalls, 0u);
+    ASSERT_EQ(stats.bytes, 0u);
+    ASSERT_EQ(stats.total_ms, 0.);
+    ASSERT_EQ(stats.min_ms, 0.);
+
+    const int niters = 3;
+    for (int i = 0; i < niters; i++)
+        prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    stats = prim.get_stats(true);
+    ASSERT_EQ(stats.ncalls, (uint64_t)niters);
+    ASSERT_EQ(stats.bytes, (uint64_t)niters * 2 * md.get_size());
+    ASSERT_GE(stats.total_ms, 0.);
+    ASSERT_LE(stats.min_ms, stats.max_ms);
+    ASSERT_LE(stats.max_ms, stats.total_ms);
+
+    ASSERT_EQ(prim.get_stats().ncalls, 0u);
+    ASSERT_EQ(prim_cached.get_stats().ncalls, 0u);
+
+    // Statistics can be reset without being read
+    prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+    ASSERT_EQ(dnnl_primitive_get_stats(prim.get(), 1, nullptr), dnnl_success);
+    ASSERT_EQ(prim.get_stats().ncalls, 0u);
+
+    ASSERT_EQ(dnnl_primitive_get_stats(prim.get(), 0, nullptr),
+            dnnl_invalid_arguments);
+}
+
+} // namespace dnnl
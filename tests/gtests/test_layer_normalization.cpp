@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 
@@ -694,5 +695,98 @@ private:
 
 TEST_P(lnorm_test_t, TestsLnormF32) {}
 
+TEST(lnorm_int8_test_t, TestsLnormOutputScales) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "int8 layer normalization is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm = make_stream(eng);
+
+    const float eps = 1e-5f;
+    const float oscale = 16.f;
+    const memory::dim N = 5;
+
+    for (auto dt : {memory::data_type::s8, memory::data_type::u8}) {
+        // Cover the scalar tail, a single vector with a tail and the
+        // unrolled statistics loop of the optimized kernel.
+        for (memory::dim C : {3, 19, 40}) {
+            memory::desc data_md({N, C}, dt, memory::format_tag::ab);
+            memory::desc ss_md({2, C}, memory::data_type::f32,
+                    memory::format_tag::ab);
+
+            primitive_attr attr;
+            attr.set_output_scales(0, {oscale});
+            auto pd = layer_normalization_forward::primitive_desc(
+                    {prop_kind::forward_inference, data_md, eps,
+                            normalization_flags::use_scale_shift},
+                    attr, eng);
+
+            memory src(data_md, eng), dst(data_md, eng), ss(ss_md, eng);
+            const bool is_s8 = dt == memory::data_type::s8;
+            {
+                auto ss_ptr = map_memory<float>(ss);
+                for (memory::dim c = 0; c < C; c++) {
+                    ss_ptr[c] = 0.5f + (c % 4) * 0.25f;
+                    ss_ptr[C + c] = (c % 3) * 0.5f;
+                }
+                auto src_ptr = map_memory<uint8_t>(src);
+                for (memory::dim i = 0; i < N * C; i++) {
+                    const int v = (int)((i * 37) % 101);
+                    src_ptr[i] = is_s8 ? (uint8_t)(int8_t)(v - 50)
+                                       : (uint8_t)v;
+                }
+            }
+
+            layer_normalization_forward(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_SCALE_SHIFT, ss}});
+            strm.wait();
+
+            auto ss_ptr = map_memory<float>(ss);
+            auto src_ptr = map_memory<uint8_t>(src);
+            auto dst_ptr = map_memory<uint8_t>(dst);
+            const auto to_f32 = [&](uint8_t v) {
+                return is_s8 ? (float)(int8_t)v : (float)v;
+            };
+            for (memory::dim n = 0; n < N; n++) {
+                float mean = 0, var = 0;
+                for (memory::dim c = 0; c < C; c++)
+                    mean += to_f32(src_ptr[n * C + c]);
+                mean /= C;
+                for (memory::dim c = 0; c < C; c++) {
+                    const float d = to_f32(src_ptr[n * C + c]) - mean;
+                    var += d * d;
+                }
+                var /= C;
+                for (memory::dim c = 0; c < C; c++) {
+                    const float x = to_f32(src_ptr[n * C + c]);
+                    float ref = oscale
+                            * (ss_ptr[c] * (x - mean) / std::sqrt(var + eps)
+                                    + ss_ptr[C + c]);
+                    ref = std::min(std::max(ref, is_s8 ? -128.f : 0.f),
+                            is_s8 ? 127.f : 255.f);
+                    // Allow off-by-one due to rounding of the accumulated
+                    // statistics.
+                    ASSERT_NEAR(to_f32(dst_ptr[n * C + c]),
+                            std::nearbyint(ref), 1.f);
+                }
+            }
+        }
+    }
+}
+
+TEST(lnorm_int8_test_t, TestsLnormOutputScalesF32Unsupported) {
+    engine eng = get_test_engine();
+    memory::desc data_md(
+            {2, 16}, memory::data_type::f32, memory::format_tag::ab);
+
+    primitive_attr attr;
+    attr.set_output_scales(0, {2.f});
+    EXPECT_ANY_THROW(layer_normalization_forward::primitive_desc(
+            {prop_kind::forward_inference, data_md, 1e-5f,
+                    normalization_flags::none},
+            attr, eng));
+}
+
 #include "layer_normalization.h"
 } // namespace dnnl
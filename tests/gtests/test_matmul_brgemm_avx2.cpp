@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+template <typename T>
+static void fill_memory(const memory &mem, const std::vector<T> &vals) {
+    auto ptr = map_memory<T>(mem);
+    for (size_t i = 0; i < vals.size(); i++)
+        ptr[i] = vals[i];
+}
+
+// The s8s8 brgemm kernel keeps the +128 source shift in a vector register.
+// With a single load register per reduction step the broadcasts of all the
+// rows are kept in registers too, and for some M and N they used to reach
+// the shift register. The avx2_vnni kernel has only 16 vector registers, so
+// the shapes below cover blockings that fill all of them.
+TEST(matmul_brgemm_avx2_vnni_test_t, TestS8S8Compensation) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test checks CPU kernels only.");
+
+    // The max ISA is set before any code is generated in the process
+    const status st = set_max_cpu_isa(cpu_isa::avx2_vnni);
+    SKIP_IF(st != status::success, "The max CPU ISA can't be set.");
+    SKIP_IF(!mayiuse(cpu_isa::avx2_vnni), "The CPU has no avx2_vnni.");
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dim K = 64;
+    for_(memory::dim N : {8, 16, 24})
+    for (memory::dim M = 1; M <= 8; M++) {
+        memory::desc src_md({M, K}, dt::s8, tag::ab);
+        memory::desc wei_md({K, N}, dt::s8, tag::any);
+        memory::desc dst_md({M, N}, dt::s32, tag::ab);
+        auto pd = matmul::primitive_desc(
+                matmul::desc(src_md, wei_md, dst_md), eng);
+        ASSERT_EQ(std::string(pd.impl_info_str()), "brg:avx2_vnni")
+                << "M: " << M << " N: " << N;
+
+        memory::desc user_wei_md({K, N}, dt::s8, tag::ab);
+        auto src = test::make_memory(src_md, eng);
+        auto user_wei = test::make_memory(user_wei_md, eng);
+        auto wei = test::make_memory(pd.weights_desc(), eng);
+        auto dst = test::make_memory(dst_md, eng);
+
+        std::vector<int8_t> src_vals(M * K), wei_vals(K * N);
+        for (size_t i = 0; i < src_vals.size(); i++)
+            src_vals[i] = (int8_t)((int)((i * 13) % 255) - 127);
+        for (size_t i = 0; i < wei_vals.size(); i++)
+            wei_vals[i] = (int8_t)((int)((i * 7 + 3) % 15) - 7);
+        fill_memory(src, src_vals);
+        fill_memory(user_wei, wei_vals);
+
+        reorder(user_wei, wei).execute(strm, user_wei, wei);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        auto dst_ptr = map_memory<int32_t>(dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            int32_t ref = 0;
+            for (memory::dim k = 0; k < K; k++)
+                ref += src_vals[m * K + k] * wei_vals[k * N + n];
+            ASSERT_EQ(dst_ptr[m * N + n], ref)
+                    << "M: " << M << " N: " << N << " m: " << m << " n: " << n;
+        }
+    }
+}
+
+} // namespace dnnl
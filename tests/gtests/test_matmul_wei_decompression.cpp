@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct wei_decomp_params_t {
+    dt wei_dt;
+    memory::dim M, N, K, group_size;
+    bool with_zero_points;
+};
+
+class wei_decomp_test_t
+    : public ::testing::TestWithParam<wei_decomp_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Weights decompression is supported on CPU only.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        const bool is_s4 = p.wei_dt == dt::s4;
+        const bool is_f16 = p.wei_dt == dt::f16;
+        const memory::dim G = p.group_size;
+        const memory::dim n_groups = (p.K + G - 1) / G;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc src_md({p.M, p.K}, dt::f32, tag::ab);
+        memory::desc wei_md({p.K, p.N}, p.wei_dt, tag::ab);
+        memory::desc dst_md({p.M, p.N}, dt::f32, tag::ab);
+        memory::desc scales_md({n_groups, p.N}, dt::f32, tag::ab);
+        memory::desc zp_md({n_groups, p.N}, dt::s8, tag::ab);
+        if (is_f16)
+            ASSERT_EQ(wei_md.get_size(), (size_t)(p.K * p.N) * 2);
+        else
+            ASSERT_EQ(wei_md.get_size(), (size_t)(p.K * p.N + 1) / 2);
+
+        primitive_attr attr;
+        attr.set_weights_decompression(G, p.with_zero_points);
+        auto pd = matmul::primitive_desc(
+                matmul::desc(src_md, wei_md, dst_md), attr, eng);
+#if DNNL_X64
+        // The reference implementation is the fallback for the other ISAs
+        if (mayiuse(cpu_isa::avx512_core))
+            ASSERT_EQ(std::string(pd.impl_info_str()), "brg:avx512_core");
+#endif
+
+        auto src = test::make_memory(src_md, eng);
+        auto wei = test::make_memory(wei_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+        auto scales = test::make_memory(scales_md, eng);
+        auto zp = test::make_memory(zp_md, eng);
+
+        // Unpacked weights values, the first value of a pair is stored in
+        // the low nibble. f16 weights hold the same values as s4.
+        std::vector<int> wei_vals(p.K * p.N);
+        for (size_t i = 0; i < wei_vals.size(); i++)
+            wei_vals[i] = (int)((i * 7 + 3) % 16) - (is_s4 || is_f16 ? 8 : 0);
+        if (is_f16) {
+            auto ptr = map_memory<float16_t>(wei);
+            for (memory::dim i = 0; i < p.K * p.N; i++)
+                ptr[i] = (float)wei_vals[i];
+        } else {
+            auto ptr = map_memory<uint8_t>(wei);
+            for (memory::dim i = 0; i < p.K * p.N; i += 2) {
+                const int lo = wei_vals[i] & 0xf;
+                const int hi = i + 1 < p.K * p.N ? wei_vals[i + 1] & 0xf : 0;
+                ptr[i / 2] = (uint8_t)(lo | (hi << 4));
+            }
+        }
+        std::vector<float> src_vals(p.M * p.K);
+        std::vector<float> scales_vals(n_groups * p.N);
+        std::vector<int8_t> zp_vals(n_groups * p.N);
+        for (size_t i = 0; i < src_vals.size(); i++)
+            src_vals[i] = (float)((i * 5) % 9) - 4.f;
+        for (size_t i = 0; i < scales_vals.size(); i++)
+            scales_vals[i] = 0.25f * (float)(1 + i % 5);
+        for (size_t i = 0; i < zp_vals.size(); i++)
+            zp_vals[i] = (int8_t)((i % 3) + (is_s4 || is_f16 ? -1 : 7));
+        fill_memory(src, src_vals);
+        fill_memory(scales, scales_vals);
+        fill_memory(zp, zp_vals);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                {DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_SCALES, scales}};
+        if (p.with_zero_points)
+            args.insert({DNNL_ARG_ATTR_WEIGHTS_DECOMPRESSION_ZERO_POINTS, zp});
+        matmul(pd).execute(strm, args);
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        for_(memory::dim m = 0; m < p.M; m++)
+        for (memory::dim n = 0; n < p.N; n++) {
+            double ref = 0;
+            for (memory::dim k = 0; k < p.K; k++) {
+                const memory::dim off = (k / G) * p.N + n;
+                const int zp_val = p.with_zero_points ? zp_vals[off] : 0;
+                const float w = (wei_vals[k * p.N + n] - zp_val)
+                        * scales_vals[off];
+                ref += (double)src_vals[m * p.K + k] * w;
+            }
+            ASSERT_NEAR(dst_ptr[m * p.N + n], ref, 1e-4 * (1 + std::fabs(ref)))
+                    << "m: " << m << " n: " << n;
+        }
+    }
+
+    template <typename T>
+    void fill_memory(const memory &mem, const std::vector<T> &vals) {
+        auto ptr = map_memory<T>(mem);
+        for (size_t i = 0; i < vals.size(); i++)
+            ptr[i] = vals[i];
+    }
+};
+
+TEST(wei_decomp_attr_test_t, TestAttr) {
+    primitive_attr attr;
+    memory::dim group_size = -1;
+    bool with_zero_points = true;
+    attr.get_weights_decompression(group_size, with_zero_points);
+    ASSERT_EQ(group_size, 0);
+    ASSERT_FALSE(with_zero_points);
+
+    attr.set_weights_decompression(128, true);
+    attr.get_weights_decompression(group_size, with_zero_points);
+    ASSERT_EQ(group_size, 128);
+    ASSERT_TRUE(with_zero_points);
+
+    EXPECT_ANY_THROW(attr.set_weights_decompression(0));
+}
+
+// 4-bit data types are only supported as decompressed matmul weights. The
+// implementations that move data byte by byte must not accept them.
+TEST(wei_decomp_attr_test_t, Test4BitUnsupported) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Weights decompression is supported on CPU only.");
+    auto eng = get_test_engine();
+    for (auto dt_4bit : {dt::s4, dt::u4}) {
+        memory::desc md({2, 16, 4, 4}, dt_4bit, tag::abcd);
+        memory::desc f32_md({2, 16, 4, 4}, dt::f32, tag::abcd);
+        EXPECT_ANY_THROW(concat::primitive_desc(1, {md, md}, eng));
+        EXPECT_ANY_THROW(sum::primitive_desc({1.f, 1.f}, {md, md}, eng));
+        EXPECT_ANY_THROW(shuffle_forward::primitive_desc(
+                shuffle_forward::desc(prop_kind::forward_inference, md, 1, 4),
+                eng));
+        EXPECT_ANY_THROW(reorder::primitive_desc(eng, md, eng, md));
+        EXPECT_ANY_THROW(reorder::primitive_desc(eng, f32_md, eng, md));
+
+        // Without the decompression attribute matmul rejects 4-bit weights
+        memory::desc src_md({4, 32}, dt::f32, tag::ab);
+        memory::desc wei_md({32, 16}, dt_4bit, tag::ab);
+        memory::desc dst_md({4, 16}, dt::f32, tag::ab);
+        EXPECT_ANY_THROW(matmul::primitive_desc(
+                matmul::desc(src_md, wei_md, dst_md), eng));
+    }
+}
+
+TEST_P(wei_decomp_test_t, TestsWeiDecompression) {}
+
+INSTANTIATE_TEST_SUITE_P(TestWeiDecompression, wei_decomp_test_t,
+        ::testing::Values(wei_decomp_params_t {dt::s4, 1, 64, 128, 32, false},
+                wei_decomp_params_t {dt::s4, 3, 64, 128, 32, true},
+                wei_decomp_params_t {dt::u4, 1, 64, 128, 32, true},
+                wei_decomp_params_t {dt::u4, 5, 50, 70, 16, false},
+                wei_decomp_params_t {dt::s4, 4, 1024, 256, 128, true},
+                wei_decomp_params_t {dt::u4, 2, 36, 33, 7, true},
+                wei_decomp_params_t {dt::f16, 1, 64, 128, 32, false},
+                wei_decomp_params_t {dt::f16, 3, 50, 70, 16, true}));
+
+} // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021 Intel Corporation
+* Copyright 2021-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -44,9 +44,13 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
+    const bool is_cache_blob_supported
+            = (get_test_engine_kind() == engine::kind::cpu
+                      && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL)
             || (get_test_engine_kind() == engine::kind::gpu
-                    && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
+                    && DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL);
+
+    if (!is_cache_blob_supported) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
@@ -60,4 +64,72 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPICPURestore) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "CPU specific test.");
+
+    engine e = get_test_engine();
+    stream s(e);
+
+    const memory::dim M = 17, K = 33, N = 45;
+    memory::desc a_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc b_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc c_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    post_ops ops;
+    ops.append_sum(0.5f);
+    ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    auto pd = matmul::primitive_desc(
+            matmul::desc(a_md, b_md, c_md), attr, e);
+    auto p = matmul(pd);
+
+    std::vector<uint8_t> cache_blob;
+    ASSERT_NO_THROW(cache_blob = p.get_cache_blob());
+    ASSERT_EQ(cache_blob.empty(), false);
+
+    // Disable the primitive cache to make the primitive restored from the
+    // cache blob rather than taken from the cache.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    matmul p_restored;
+    ASSERT_NO_THROW(p_restored = matmul(pd, cache_blob));
+    ASSERT_EQ(cache_blob, p_restored.get_cache_blob());
+
+    // A damaged blob must be rejected.
+    auto broken_blob = cache_blob;
+    broken_blob.resize(broken_blob.size() / 2);
+    EXPECT_ANY_THROW(matmul(pd, broken_blob));
+    set_primitive_cache_capacity(capacity);
+
+    memory a_mem(a_md, e), b_mem(b_md, e);
+    fill_data<float>(a_md.get_size() / sizeof(float), a_mem);
+    fill_data<float>(b_md.get_size() / sizeof(float), b_mem);
+
+    memory c_ref(c_md, e), c_mem(c_md, e);
+    fill_data<float>(c_md.get_size() / sizeof(float), c_ref);
+    {
+        auto src = map_memory<float>(c_ref);
+        auto dst = map_memory<float>(c_mem);
+        for (size_t i = 0; i < c_md.get_size() / sizeof(float); i++)
+            dst[i] = src[i];
+    }
+
+    p.execute(s,
+            {{DNNL_ARG_SRC, a_mem}, {DNNL_ARG_WEIGHTS, b_mem},
+                    {DNNL_ARG_DST, c_ref}});
+    p_restored.execute(s,
+            {{DNNL_ARG_SRC, a_mem}, {DNNL_ARG_WEIGHTS, b_mem},
+                    {DNNL_ARG_DST, c_mem}});
+    s.wait();
+
+    compare_data<float>(c_ref, c_mem);
+}
+#endif
+
 } // namespace dnnl
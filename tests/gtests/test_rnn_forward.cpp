@@ -817,4 +817,128 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+// With a small batch and several layers and iterations the cells on the same
+// anti-diagonal of the grid are computed concurrently on CPU. The threads are
+// set with an attribute so that this schedule is picked regardless of the
+// machine, and the results are compared with a single-threaded run.
+struct rnn_wavefront_params_t {
+    algorithm cell_kind;
+    rnn_direction direction;
+    memory::dim l, t, mb;
+};
+
+class rnn_wavefront_test_t
+    : public ::testing::TestWithParam<rnn_wavefront_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "The wavefront schedule is a CPU feature.");
+        Test();
+    }
+
+    void Test() {
+        using tag = memory::format_tag;
+        const auto p = GetParam();
+        const bool is_lstm = p.cell_kind == algorithm::vanilla_lstm;
+        const bool is_bidir
+                = p.direction == rnn_direction::bidirectional_concat
+                || p.direction == rnn_direction::bidirectional_sum;
+        const memory::dim d = is_bidir ? 2 : 1;
+        const memory::dim c = 16; // channels of all the states
+        const memory::dim dlc
+                = p.direction == rnn_direction::bidirectional_concat ? 2 * c
+                                                                     : c;
+        const memory::dim g = is_lstm ? 4 : 3;
+        const auto dt = memory::data_type::f32;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::desc src_layer_md({p.t, p.mb, c}, dt, tag::tnc);
+        memory::desc src_iter_md({p.l, d, p.mb, c}, dt, tag::ldnc);
+        memory::desc wei_md({p.l, d, c, g, c}, dt, tag::ldigo);
+        memory::desc bias_md({p.l, d, g, c}, dt, tag::ldgo);
+        memory::desc dst_layer_md({p.t, p.mb, dlc}, dt, tag::tnc);
+
+        auto src_layer = test::make_memory(src_layer_md, eng);
+        auto src_iter = test::make_memory(src_iter_md, eng);
+        auto src_iter_c = test::make_memory(src_iter_md, eng);
+        auto wei_layer = test::make_memory(wei_md, eng);
+        auto wei_iter = test::make_memory(wei_md, eng);
+        auto bias = test::make_memory(bias_md, eng);
+        fill_data<float>(src_layer_md.get_size() / sizeof(float), src_layer,
+                0.f, 1.f);
+        fill_data<float>(
+                src_iter_md.get_size() / sizeof(float), src_iter, 0.f, 1.f);
+        fill_data<float>(
+                src_iter_md.get_size() / sizeof(float), src_iter_c, 0.f, 1.f);
+        fill_data<float>(
+                wei_md.get_size() / sizeof(float), wei_layer, 0.f, 0.1f);
+        fill_data<float>(
+                wei_md.get_size() / sizeof(float), wei_iter, 0.f, 0.1f);
+        fill_data<float>(bias_md.get_size() / sizeof(float), bias, 0.f, 0.5f);
+
+        std::vector<memory> dst_layer, dst_iter, dst_iter_c;
+        for (int nthr : {1, 4}) {
+            primitive_attr attr;
+            attr.set_num_threads(nthr);
+            dst_layer.push_back(test::make_memory(dst_layer_md, eng));
+            dst_iter.push_back(test::make_memory(src_iter_md, eng));
+            dst_iter_c.push_back(test::make_memory(src_iter_md, eng));
+
+            primitive prim;
+            if (is_lstm) {
+                lstm_forward::desc op_d(prop_kind::forward_inference,
+                        p.direction, src_layer_md, src_iter_md, src_iter_md,
+                        wei_md, wei_md, bias_md, dst_layer_md, src_iter_md,
+                        src_iter_md);
+                prim = lstm_forward(
+                        lstm_forward::primitive_desc(op_d, attr, eng));
+            } else {
+                gru_forward::desc op_d(prop_kind::forward_inference,
+                        p.direction, src_layer_md, src_iter_md, wei_md, wei_md,
+                        bias_md, dst_layer_md, src_iter_md);
+                prim = gru_forward(
+                        gru_forward::primitive_desc(op_d, attr, eng));
+            }
+            std::unordered_map<int, memory> args
+                    = {{DNNL_ARG_SRC_LAYER, src_layer},
+                            {DNNL_ARG_SRC_ITER, src_iter},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bias},
+                            {DNNL_ARG_DST_LAYER, dst_layer.back()},
+                            {DNNL_ARG_DST_ITER, dst_iter.back()}};
+            if (is_lstm) {
+                args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+                args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c.back()});
+            }
+            prim.execute(strm, args);
+            strm.wait();
+        }
+
+        compare_data<float>(dst_layer[0], dst_layer[1], 1e-5f);
+        compare_data<float>(dst_iter[0], dst_iter[1], 1e-5f);
+        if (is_lstm) compare_data<float>(dst_iter_c[0], dst_iter_c[1], 1e-5f);
+    }
+};
+
+TEST_P(rnn_wavefront_test_t, TestsWavefront) {}
+CPU_INSTANTIATE_TEST_SUITE_P(TestRnnWavefront, rnn_wavefront_test_t,
+        ::testing::Values(
+                rnn_wavefront_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::unidirectional_left2right, 3, 5, 1},
+                rnn_wavefront_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::unidirectional_right2left, 4, 3, 2},
+                rnn_wavefront_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::bidirectional_concat, 3, 6, 3},
+                rnn_wavefront_params_t {algorithm::vanilla_lstm,
+                        rnn_direction::bidirectional_sum, 2, 4, 1},
+                rnn_wavefront_params_t {algorithm::vanilla_gru,
+                        rnn_direction::unidirectional_left2right, 4, 7, 2},
+                rnn_wavefront_params_t {algorithm::vanilla_gru,
+                        rnn_direction::bidirectional_concat, 2, 5, 1},
+                rnn_wavefront_params_t {algorithm::vanilla_gru,
+                        rnn_direction::bidirectional_sum, 3, 3, 4}));
+
 } // namespace dnnl
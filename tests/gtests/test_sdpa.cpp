@@ -0,0 +1,245 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct sdpa_test_params_t {
+    sdpa_mask_kind mask_kind;
+    memory::dims q_dims;
+    memory::dims k_dims;
+    memory::dims v_dims;
+    memory::dims mask_dims;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class sdpa_test_t : public ::testing::TestWithParam<sdpa_test_params_t> {
+private:
+    sdpa_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<sdpa_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using dt = memory::data_type;
+        using op_desc_t = sdpa_forward::desc;
+        using pd_t = sdpa_forward::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = (int)p.q_dims.size();
+        memory::dims dst_dims = p.q_dims;
+        dst_dims[ndims - 1] = p.v_dims[ndims - 1];
+
+        auto q_md = memory::desc(p.q_dims, dt::f32, plain_tag(ndims));
+        auto k_md = memory::desc(p.k_dims, dt::f32, plain_tag(ndims));
+        auto v_md = memory::desc(p.v_dims, dt::f32, plain_tag(ndims));
+        auto dst_md = memory::desc(dst_dims, dt::f32, plain_tag(ndims));
+
+        const bool with_mask_buffer = p.mask_kind == sdpa_mask_kind::buffer;
+        const float scale = 1.f / std::sqrt((float)p.q_dims[ndims - 1]);
+
+        memory::desc mask_md;
+        auto op_desc = op_desc_t();
+        if (with_mask_buffer) {
+            mask_md = memory::desc(p.mask_dims, dt::f32, plain_tag(ndims));
+            op_desc = op_desc_t(prop_kind::forward_inference, q_md, k_md,
+                    v_md, mask_md, dst_md, scale);
+        } else {
+            op_desc = op_desc_t(prop_kind::forward_inference, q_md, k_md,
+                    v_md, dst_md, scale, p.mask_kind);
+        }
+
+        auto pd = pd_t();
+        ASSERT_NO_THROW(pd = pd_t(op_desc, eng));
+        test_fwd_pd_constructors<op_desc_t, pd_t>(
+                op_desc, pd, allowed_attributes);
+
+        EXPECT_ANY_THROW(sdpa_forward(pd, {}));
+        auto prim = sdpa_forward(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_QUERIES)
+                == pd.queries_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_KEYS)
+                == pd.keys_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_VALUES)
+                == pd.values_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+
+        auto q = test::make_memory(pd.queries_desc(), eng);
+        auto k = test::make_memory(pd.keys_desc(), eng);
+        auto v = test::make_memory(pd.values_desc(), eng);
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+
+        fill_data<float>(q_md.get_size() / sizeof(float), q);
+        fill_data<float>(k_md.get_size() / sizeof(float), k);
+        fill_data<float>(v_md.get_size() / sizeof(float), v);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q},
+                {DNNL_ARG_KEYS, k}, {DNNL_ARG_VALUES, v}, {DNNL_ARG_DST, dst}};
+
+        memory mask;
+        if (with_mask_buffer) {
+            ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_ATTN_MASK)
+                    == pd.mask_desc());
+            mask = test::make_memory(pd.mask_desc(), eng);
+            fill_data<float>(mask_md.get_size() / sizeof(float), mask);
+            args.insert({DNNL_ARG_ATTN_MASK, mask});
+        }
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check_result(q, k, v, mask, dst, scale);
+    }
+
+    void check_result(const memory &q, const memory &k, const memory &v,
+            const memory &mask, const memory &dst, float scale) {
+        const int ndims = (int)p.q_dims.size();
+        const memory::dim Sq = p.q_dims[ndims - 2];
+        const memory::dim Sk = p.k_dims[ndims - 2];
+        const memory::dim D = p.q_dims[ndims - 1];
+        const memory::dim Dv = p.v_dims[ndims - 1];
+        memory::dim MB = 1;
+        for (int d = 0; d < ndims - 2; d++)
+            MB *= p.q_dims[d];
+
+        const bool with_mask_buffer = p.mask_kind == sdpa_mask_kind::buffer;
+        const bool with_causal_mask = p.mask_kind == sdpa_mask_kind::causal;
+
+        auto q_ptr = map_memory<const float>(q);
+        auto k_ptr = map_memory<const float>(k);
+        auto v_ptr = map_memory<const float>(v);
+        auto dst_ptr = map_memory<const float>(dst);
+
+        auto mask_ptr = with_mask_buffer ? map_memory<const float>(mask)
+                                         : mapped_ptr_t<const float>(nullptr);
+
+        std::vector<float> scores(Sk);
+        for (memory::dim mb = 0; mb < MB; mb++) {
+            // Broadcast of the mask over the leading dimensions
+            memory::dim mask_mb = 0;
+            if (with_mask_buffer) {
+                memory::dim rem = mb, stride = 1;
+                for (int d = ndims - 3; d >= 0; d--) {
+                    const memory::dim pos = rem % p.q_dims[d];
+                    rem /= p.q_dims[d];
+                    if (p.mask_dims[d] != 1) mask_mb += pos * stride;
+                    stride *= p.mask_dims[d];
+                }
+            }
+            for (memory::dim i = 0; i < Sq; i++) {
+                const memory::dim n_keys
+                        = with_causal_mask ? std::min(i + 1, Sk) : Sk;
+                float max_score = -INFINITY;
+                for (memory::dim j = 0; j < n_keys; j++) {
+                    float s = 0.f;
+                    for (memory::dim d = 0; d < D; d++)
+                        s += q_ptr[(mb * Sq + i) * D + d]
+                                * k_ptr[(mb * Sk + j) * D + d];
+                    s *= scale;
+                    if (with_mask_buffer)
+                        s += mask_ptr[(mask_mb * Sq + i) * Sk + j];
+                    scores[j] = s;
+                    max_score = std::max(max_score, s);
+                }
+                float denom = 0.f;
+                for (memory::dim j = 0; j < n_keys; j++) {
+                    scores[j] = std::exp(scores[j] - max_score);
+                    denom += scores[j];
+                }
+                for (memory::dim dv = 0; dv < Dv; dv++) {
+                    float ref = 0.f;
+                    for (memory::dim j = 0; j < n_keys; j++)
+                        ref += scores[j] * v_ptr[(mb * Sk + j) * Dv + dv];
+                    ref /= denom;
+                    const float got = dst_ptr[(mb * Sq + i) * Dv + dv];
+                    ASSERT_NEAR(got, ref, 1e-4f * std::max(1.f, std::abs(ref)))
+                            << "mb: " << mb << " i: " << i << " dv: " << dv;
+                }
+            }
+        }
+    }
+
+    static memory::format_tag plain_tag(int ndims) {
+        using tag = memory::format_tag;
+        switch (ndims) {
+            case 2: return tag::ab;
+            case 3: return tag::abc;
+            case 4: return tag::abcd;
+            default: return tag::undef;
+        }
+    }
+};
+
+using mask_kind = sdpa_mask_kind;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // head sizes of queries and keys don't match
+            sdpa_test_params_t {mask_kind::none, {2, 8, 16}, {2, 8, 32},
+                    {2, 8, 16}, {}, true, dnnl_invalid_arguments},
+            // numbers of keys and values don't match
+            sdpa_test_params_t {mask_kind::none, {2, 8, 16}, {2, 8, 16},
+                    {2, 4, 16}, {}, true, dnnl_invalid_arguments},
+            // batch dimensions don't match
+            sdpa_test_params_t {mask_kind::none, {2, 8, 16}, {3, 8, 16},
+                    {3, 8, 16}, {}, true, dnnl_invalid_arguments},
+            // mask is not broadcastable
+            sdpa_test_params_t {mask_kind::buffer, {2, 8, 16}, {2, 4, 16},
+                    {2, 4, 16}, {2, 8, 8}, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            sdpa_test_params_t {mask_kind::none, {1, 1, 16}, {1, 1, 16},
+                    {1, 1, 16}},
+            sdpa_test_params_t {mask_kind::none, {2, 3, 37, 24},
+                    {2, 3, 75, 24}, {2, 3, 75, 40}},
+            sdpa_test_params_t {mask_kind::causal, {2, 64, 32}, {2, 64, 32},
+                    {2, 64, 32}},
+            sdpa_test_params_t {mask_kind::causal, {1, 2, 19, 8},
+                    {1, 2, 130, 8}, {1, 2, 130, 8}},
+            sdpa_test_params_t {mask_kind::buffer, {2, 4, 33, 16},
+                    {2, 4, 70, 16}, {2, 4, 70, 16}, {2, 1, 33, 70}},
+            sdpa_test_params_t {mask_kind::buffer, {3, 17, 64}, {3, 17, 64},
+                    {3, 17, 64}, {1, 17, 17}});
+};
+
+TEST_P(sdpa_test_t, TestsSdpa) {}
+INSTANTIATE_TEST_SUITE_P(TestSdpaEF, sdpa_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestSdpaSimple, sdpa_test_t, simple_cases());
+
+} // namespace dnnl
@@ -0,0 +1,230 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct sparse_weights_params_t {
+    bool is_matmul;
+    memory::dim M, N, K;
+    // Dimensions of a block along N and K
+    memory::dim n_blk, k_blk;
+    bool with_bias, with_eltwise;
+};
+
+class sparse_weights_test_t
+    : public ::testing::TestWithParam<sparse_weights_params_t> {
+protected:
+    void SetUp() override {
+        bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
+                || (get_test_engine_kind() != engine::kind::cpu);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+        skip_test = skip_test || !dnnl::mayiuse(cpu_isa::avx2);
+#endif
+        SKIP_IF(skip_test,
+                "Sparse weights are supported only on avx2 CPU and newer.");
+        Test();
+    }
+
+    void Test() {
+        const auto p = GetParam();
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        // Inner product weights are [N][K] with block rows along the 1st
+        // dimension, matmul weights are [K][N] with block rows along the 2nd
+        const int n_dim = p.is_matmul ? 1 : 0;
+        const int k_dim = 1 - n_dim;
+        memory::dims wei_dims(2), block_dims(2);
+        wei_dims[n_dim] = p.N;
+        wei_dims[k_dim] = p.K;
+        block_dims[n_dim] = p.n_blk;
+        block_dims[k_dim] = p.k_blk;
+
+        memory::desc src_md({p.M, p.K}, dt::f32, tag::ab);
+        memory::desc wei_md(wei_dims, dt::f32, tag::ab);
+        memory::desc bias_md = p.is_matmul
+                ? memory::desc({1, p.N}, dt::f32, tag::ab)
+                : memory::desc({p.N}, dt::f32, tag::a);
+        memory::desc dst_md({p.M, p.N}, dt::f32, tag::ab);
+        memory::desc sparse_md(wei_dims, dt::f32,
+                memory::sparse_encoding::bcsr_bitmask, block_dims, n_dim);
+        ASSERT_EQ(sparse_md.data.format_kind, dnnl_format_kind_sparse);
+
+        // Every 3rd block is non-zero and the 2nd block row is empty
+        const memory::dim nb_n = (p.N + p.n_blk - 1) / p.n_blk;
+        const memory::dim nb_k = (p.K + p.k_blk - 1) / p.k_blk;
+        auto is_zero_blk = [&](memory::dim n, memory::dim k) {
+            const memory::dim nb = n / p.n_blk, kb = k / p.k_blk;
+            return (nb == 1 && nb_n > 1) || (nb * nb_k + kb) % 3 != 0;
+        };
+        std::vector<float> wei_vals(p.N * p.K);
+        for_(memory::dim n = 0; n < p.N; n++)
+        for (memory::dim k = 0; k < p.K; k++)
+            wei_vals[n * p.K + k] = is_zero_blk(n, k)
+                    ? 0.f
+                    : (float)((n * 7 + k * 3) % 11) - 5.f;
+        std::vector<float> src_vals(p.M * p.K);
+        std::vector<float> bias_vals(p.N);
+        for (size_t i = 0; i < src_vals.size(); i++)
+            src_vals[i] = (float)((i * 5) % 9) - 4.f;
+        for (size_t i = 0; i < bias_vals.size(); i++)
+            bias_vals[i] = 0.5f * (float)(i % 7) - 1.f;
+
+        auto src = test::make_memory(src_md, eng);
+        auto wei = test::make_memory(wei_md, eng);
+        auto bias = test::make_memory(bias_md, eng);
+        auto dst = test::make_memory(dst_md, eng);
+        fill_memory(src, src_vals);
+        fill_memory(bias, bias_vals);
+        {
+            auto ptr = map_memory<float>(wei);
+            for_(memory::dim n = 0; n < p.N; n++)
+            for (memory::dim k = 0; k < p.K; k++) {
+                const memory::dim off
+                        = p.is_matmul ? k * p.N + n : n * p.K + k;
+                ptr[off] = wei_vals[n * p.K + k];
+            }
+        }
+
+        auto reorder_pd = reorder::primitive_desc(eng, wei_md, eng, sparse_md);
+        ASSERT_EQ(std::string(reorder_pd.impl_info_str()), "simple:sparse");
+        auto sparse_wei = test::make_memory(sparse_md, eng);
+        reorder(reorder_pd).execute(strm, wei, sparse_wei);
+
+        post_ops ops;
+        if (p.with_eltwise)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        const memory::desc any_src_md({p.M, p.K}, dt::f32, tag::any);
+        const memory::desc any_dst_md({p.M, p.N}, dt::f32, tag::any);
+        const memory::desc no_bias_md;
+        primitive prim;
+        std::string impl_name;
+        if (p.is_matmul) {
+            auto pd = matmul::primitive_desc(
+                    matmul::desc(any_src_md, sparse_md,
+                            p.with_bias ? bias_md : no_bias_md, any_dst_md),
+                    attr, eng, true);
+            ASSERT_TRUE(pd);
+            ASSERT_TRUE(pd.src_desc() == src_md);
+            ASSERT_TRUE(pd.weights_desc() == sparse_md);
+            impl_name = pd.impl_info_str();
+            prim = matmul(pd);
+        } else {
+            auto pd = inner_product_forward::primitive_desc(
+                    inner_product_forward::desc(prop_kind::forward_inference,
+                            any_src_md, sparse_md,
+                            p.with_bias ? bias_md : no_bias_md, any_dst_md),
+                    attr, eng, true);
+            ASSERT_TRUE(pd);
+            ASSERT_TRUE(pd.src_desc() == src_md);
+            ASSERT_TRUE(pd.weights_desc() == sparse_md);
+            impl_name = pd.impl_info_str();
+            prim = inner_product_forward(pd);
+        }
+        ASSERT_NE(impl_name.find("sparse"), std::string::npos);
+
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, sparse_wei}, {DNNL_ARG_DST, dst}};
+        if (p.with_bias) args.insert({DNNL_ARG_BIAS, bias});
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst);
+        for_(memory::dim m = 0; m < p.M; m++)
+        for (memory::dim n = 0; n < p.N; n++) {
+            double ref = p.with_bias ? bias_vals[n] : 0.;
+            for (memory::dim k = 0; k < p.K; k++)
+                ref += (double)src_vals[m * p.K + k] * wei_vals[n * p.K + k];
+            if (p.with_eltwise) ref = std::max(ref, 0.);
+            ASSERT_NEAR(dst_ptr[m * p.N + n], ref, 1e-4 * (1 + std::fabs(ref)))
+                    << "m: " << m << " n: " << n;
+        }
+    }
+
+    void fill_memory(const memory &mem, const std::vector<float> &vals) {
+        auto ptr = map_memory<float>(mem);
+        for (size_t i = 0; i < vals.size(); i++)
+            ptr[i] = vals[i];
+    }
+};
+
+TEST(sparse_weights_desc_test_t, TestDesc) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sparse weights are supported on CPU only.");
+
+    const memory::desc md({64, 100}, dt::f32,
+            memory::sparse_encoding::bcsr_bitmask, {16, 1}, 0);
+    // The size accounts for all the blocks being non-zero
+    ASSERT_GE(md.get_size(), 64 * 100 * sizeof(float));
+    ASSERT_TRUE(md == memory::desc(md.data));
+    ASSERT_TRUE(md
+            != memory::desc({64, 100}, dt::f32,
+                    memory::sparse_encoding::bcsr_bitmask, {32, 4}, 0));
+
+    EXPECT_ANY_THROW(memory::desc({64, 100, 3}, dt::f32,
+            memory::sparse_encoding::bcsr_bitmask, {16, 1, 1}, 0));
+    EXPECT_ANY_THROW(memory::desc({64, 100}, dt::f32,
+            memory::sparse_encoding::bcsr_bitmask, {16, 0}, 0));
+    EXPECT_ANY_THROW(memory::desc({64, 100}, dt::f32,
+            memory::sparse_encoding::bcsr_bitmask, {16, 1}, 2));
+
+    // Implementations without sparse weights support must not accept them
+    auto eng = get_test_engine();
+    const memory::desc src_md({8, 100}, dt::f32, tag::ab);
+    const memory::desc dst_md({8, 64}, dt::f32, tag::ab);
+    post_ops ops;
+    ops.append_sum();
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    EXPECT_ANY_THROW(inner_product_forward::primitive_desc(
+            inner_product_forward::desc(
+                    prop_kind::forward_inference, src_md, md, dst_md),
+            attr, eng));
+}
+
+TEST_P(sparse_weights_test_t, TestsSparseWeights) {}
+
+INSTANTIATE_TEST_SUITE_P(TestSparseWeights, sparse_weights_test_t,
+        ::testing::Values(
+                sparse_weights_params_t {false, 10, 50, 70, 16, 1, true, true},
+                sparse_weights_params_t {
+                        false, 100, 64, 128, 32, 4, false, false},
+                sparse_weights_params_t {false, 1, 16, 16, 16, 1, true, false},
+                sparse_weights_params_t {true, 3, 40, 130, 16, 4, true, true},
+                sparse_weights_params_t {true, 65, 64, 64, 32, 4, false, true},
+                sparse_weights_params_t {true, 7, 20, 3, 16, 4, true, false},
+                sparse_weights_params_t {
+                        true, 5, 33, 200, 8, 2, false, false}));
+
+} // namespace dnnl
@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+// The library scratchpad of a primitive is taken from the stream it is
+// executed on. The test runs one primitive concurrently on several streams,
+// and on a single stream from several threads, with different inputs and
+// checks that the executions do not corrupt the scratchpad of each other.
+class stream_scratchpad_test_t : public ::testing::Test {
+protected:
+    static constexpr int n_threads = 4;
+    static constexpr int n_iters = 8;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "The stream scratchpad is used on CPU only.");
+
+        eng_ = get_test_engine();
+        // Primitives using the global scratchpad (e.g. gemm-based
+        // convolutions) cannot be executed concurrently unless the library is
+        // built with DNNL_ENABLE_CONCURRENT_EXEC. The brgemm matmul takes its
+        // scratchpad from the stream and uses it for the copy of plain B.
+        memory::desc src_md({32, 64}, dt::f32, tag::ab);
+        memory::desc wei_md({64, 48}, dt::f32, tag::ab);
+        memory::desc dst_md({32, 48}, dt::f32, tag::ab);
+        auto matmul_d = matmul::desc(src_md, wei_md, dst_md);
+
+        // The scratchpad size is reported only in the user scratchpad mode
+        primitive_attr attr;
+        attr.set_scratchpad_mode(scratchpad_mode::user);
+        auto user_pd = matmul::primitive_desc(matmul_d, attr, eng_);
+        const std::string impl_name = user_pd.impl_info_str();
+        SKIP_IF(impl_name.find("brg") == std::string::npos
+                        || user_pd.scratchpad_desc().get_size() == 0,
+                "The implementation does not use the stream scratchpad.");
+        prim_ = matmul(matmul::primitive_desc(matmul_d, eng_));
+
+        wei_ = test::make_memory(wei_md, eng_);
+        fill_data<float>(wei_md.get_size() / sizeof(float), wei_, 0.f, 1.f);
+
+        // Reference results computed with sequential executions
+        auto strm = make_stream(eng_);
+        for (int i = 0; i < n_threads; i++) {
+            srcs_.push_back(test::make_memory(src_md, eng_));
+            fill_data<float>(src_md.get_size() / sizeof(float), srcs_[i],
+                    (float)i, 1.f);
+            ref_dsts_.push_back(test::make_memory(dst_md, eng_));
+            execute(strm, i, ref_dsts_[i]);
+        }
+        strm.wait();
+        dst_md_ = dst_md;
+    }
+
+    void execute(const stream &strm, int i, const memory &dst) const {
+        prim_.execute(strm,
+                {{DNNL_ARG_SRC, srcs_[i]}, {DNNL_ARG_WEIGHTS, wei_},
+                        {DNNL_ARG_DST, dst}});
+    }
+
+    void run(bool shared_stream) {
+        // The test is skipped in SetUp()
+        if (!prim_) return;
+
+        std::vector<stream> strms;
+        for (int i = 0; i < (shared_stream ? 1 : n_threads); i++)
+            strms.push_back(make_stream(eng_));
+
+        std::vector<memory> dsts;
+        for (int i = 0; i < n_threads; i++)
+            dsts.push_back(test::make_memory(dst_md_, eng_));
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < n_threads; i++) {
+            threads.emplace_back([&, i]() {
+                auto &strm = strms[shared_stream ? 0 : i];
+                for (int iter = 0; iter < n_iters; iter++) {
+                    execute(strm, i, dsts[i]);
+                    strm.wait();
+                }
+            });
+        }
+        for (auto &t : threads)
+            t.join();
+
+        for (int i = 0; i < n_threads; i++)
+            compare_data<float>(ref_dsts_[i], dsts[i]);
+    }
+
+    engine eng_;
+    primitive prim_;
+    memory wei_;
+    memory::desc dst_md_;
+    std::vector<memory> srcs_;
+    std::vector<memory> ref_dsts_;
+};
+
+TEST_F(stream_scratchpad_test_t, TestSeveralStreams) {
+    run(false);
+}
+
+TEST_F(stream_scratchpad_test_t, TestSharedStream) {
+    run(true);
+}
+
+} // namespace dnnl
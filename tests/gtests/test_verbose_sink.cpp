@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/verbose_sink.hpp"
+
+namespace dnnl {
+
+namespace {
+const char *info = "cpu,eltwise,jit:avx2,forward_inference,"
+                   "src_f32::blocked:a:f0 dst_f32::blocked:a:f0,,"
+                   "alg:eltwise_relu alpha:0 beta:0,\"x\\y\",1x2";
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+} // namespace
+
+TEST(verbose_sink_test_t, TestFormatCsv) {
+    // Every field is quoted, the quotes inside are doubled, and the commas of
+    // the last field are kept
+    EXPECT_EQ(impl::verbose_sink_format_event(true, 1.5, 0.25, info),
+            "1.500,\"cpu\",\"eltwise\",\"jit:avx2\",\"forward_inference\","
+            "\"src_f32::blocked:a:f0 dst_f32::blocked:a:f0\",\"\","
+            "\"alg:eltwise_relu alpha:0 beta:0\",\"\"\"x\\y\"\",1x2\","
+            "0.25\n");
+
+    // Missing fields are written empty
+    EXPECT_EQ(impl::verbose_sink_format_event(true, 0., 1., "cpu,sum"),
+            "0.000,\"cpu\",\"sum\",\"\",\"\",\"\",\"\",\"\",\"\",1\n");
+
+    // Control characters don't break the row
+    EXPECT_EQ(impl::verbose_sink_format_event(true, 0., 1., "cpu\n,a\tb"),
+            "0.000,\"cpu \",\"a b\",\"\",\"\",\"\",\"\",\"\",\"\",1\n");
+}
+
+TEST(verbose_sink_test_t, TestFormatJson) {
+    // Quotes and backslashes are escaped
+    EXPECT_EQ(impl::verbose_sink_format_event(false, 1.5, 0.25, info),
+            "{\"timestamp\":1.500,\"engine\":\"cpu\",\"primitive\":"
+            "\"eltwise\",\"implementation\":\"jit:avx2\",\"prop_kind\":"
+            "\"forward_inference\",\"memory_descriptors\":"
+            "\"src_f32::blocked:a:f0 dst_f32::blocked:a:f0\","
+            "\"attributes\":\"\",\"auxiliary\":"
+            "\"alg:eltwise_relu alpha:0 beta:0\",\"problem_desc\":"
+            "\"\\\"x\\\\y\\\",1x2\",\"exec_time\":0.25}\n");
+
+    // Missing fields are skipped
+    EXPECT_EQ(impl::verbose_sink_format_event(false, 0., 1., "cpu,sum"),
+            "{\"timestamp\":0.000,\"engine\":\"cpu\",\"primitive\":\"sum\","
+            "\"exec_time\":1}\n");
+}
+
+// The sink reads the environment once, at the first execution of a primitive
+// in the process, so this test must stay the only one executing primitives.
+TEST(verbose_sink_test_t, TestRecord) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test checks CPU primitives only.");
+    const std::string path = "dnnl_test_verbose_sink.jsonl";
+    std::remove(path.c_str());
+    custom_setenv("ONEDNN_VERBOSE_SINK", path.c_str(), 1);
+    custom_setenv("ONEDNN_VERBOSE_SINK_KINDS", "eltwise", 1);
+    custom_setenv("ONEDNN_VERBOSE_SINK_RING_SIZE", "3", 1);
+
+    if (!impl::verbose_sink_enabled()) {
+        // The library is built without the verbose support
+        std::remove(path.c_str());
+        return;
+    }
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+    memory::desc md({2, 16}, memory::data_type::f32, memory::format_tag::ab);
+    memory src = test::make_memory(md, eng);
+    memory dst = test::make_memory(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), src);
+
+    auto relu = eltwise_forward(eltwise_forward::primitive_desc(
+            eltwise_forward::desc(prop_kind::forward_inference,
+                    algorithm::eltwise_relu, md, 0.f, 0.f),
+            eng));
+    auto sum = dnnl::sum(dnnl::sum::primitive_desc({1.f, 1.f}, {md, md}, eng));
+    relu.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    sum.execute(strm,
+            {{DNNL_ARG_MULTIPLE_SRC, src}, {DNNL_ARG_MULTIPLE_SRC + 1, src},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    // The events are written by a background thread
+    std::string line;
+    for (int i = 0; i < 500 && line.empty(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::ifstream f(path);
+        std::getline(f, line);
+    }
+    ASSERT_FALSE(line.empty());
+    EXPECT_EQ(line.find("{\"timestamp\":"), 0u);
+    EXPECT_NE(line.find("\"primitive\":\"eltwise\""), std::string::npos);
+    EXPECT_NE(line.find("\"exec_time\":"), std::string::npos);
+
+    // The sum primitive is filtered out
+    std::ifstream f(path);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    EXPECT_EQ(ss.str().find("\"primitive\":\"sum\""), std::string::npos);
+}
+
+} // namespace dnnl